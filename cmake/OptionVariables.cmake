@@ -7,17 +7,18 @@
 
 # ---- Options Summary ----
 
-# ----------------------------------------------------------------------------------------------------------------
-# | Option                    | Availability  | Default                                                          |
-# |===========================|===============|==================================================================|
-# | BUILD_SHARED_LIBS         | Top-Level     | OFF                                                              |
-# | BUILD_TESTING             | Top-Level     | OFF                                                              |
-# | CMAKE_INSTALL_CMAKEDIR    | Top-Level     | ${CMAKE_INSTALL_LIBDIR}/cmake/${package_name}-${PROJECT_VERSION} |
-# | CMAKE_INSTALL_INCLUDEDIR  | Top-Level     | include/${package_name}-${PROJECT_VERSION}                       |
-# |---------------------------|---------------|------------------------------------------------------------------|
-# | PATOMIC_BUILD_SHARED_LIBS | Always        | ${BUILD_SHARED_LIBS}                                             |
-# | PATOMIC_BUILD_TESTING     | Always        | ${BUILD_TESTING} AND ${PROJECT_IS_TOP_LEVEL}                     |
-# ----------------------------------------------------------------------------------------------------------------
+# -----------------------------------------------------------------------------------------------------------------------
+# | Option                           | Availability  | Default                                                          |
+# |==================================|===============|==================================================================|
+# | BUILD_SHARED_LIBS                | Top-Level     | OFF                                                              |
+# | BUILD_TESTING                    | Top-Level     | OFF                                                              |
+# | CMAKE_INSTALL_CMAKEDIR           | Top-Level     | ${CMAKE_INSTALL_LIBDIR}/cmake/${package_name}-${PROJECT_VERSION} |
+# | CMAKE_INSTALL_INCLUDEDIR         | Top-Level     | include/${package_name}-${PROJECT_VERSION}                       |
+# |----------------------------------|---------------|------------------------------------------------------------------|
+# | PATOMIC_BUILD_SHARED_LIBS        | Always        | ${BUILD_SHARED_LIBS}                                             |
+# | PATOMIC_BUILD_TESTING            | Always        | ${BUILD_TESTING} AND ${PROJECT_IS_TOP_LEVEL}                     |
+# | PATOMIC_ENABLE_CMPXCHG_HISTOGRAM | Always        | OFF                                                              |
+# -----------------------------------------------------------------------------------------------------------------------
 
 
 # ---- Build Shared ----
@@ -62,6 +63,21 @@ unset(build_testing)
 mark_as_advanced(PATOMIC_BUILD_TESTING)
 
 
+# ---- Cmpxchg Histogram ----
+
+# Operations emulated with a cmpxchg loop can optionally record how many
+# iterations each call took into per-thread histograms.
+# This is off by default since it adds overhead to every emulated operation,
+# and is intended for diagnosing contention rather than for production builds.
+# The value is exposed to the source code through the generated config header.
+option(
+    PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    "Record iteration counts of cmpxchg loops in ${package_name}"
+    OFF
+)
+mark_as_advanced(PATOMIC_ENABLE_CMPXCHG_HISTOGRAM)
+
+
 # ---- Install Include Directory ----
 
 # Adds an extra directory to the include path by default, so that when you link
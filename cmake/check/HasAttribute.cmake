@@ -3,13 +3,14 @@
 
 # ---- Has Attribute ----
 
-# -------------------------------------------------------------------------------------------------
-# | Variable                   | Check                                                            |
-# |============================|==================================================================|
-# | COMPILER_HAS_NORETURN      | '_Noreturn' is available as a function attribute                 |
-# | COMPILER_HAS_NORETURN_ATTR | '__attribute__((noreturn))' is available as a function attribute |
-# | COMPILER_HAS_NORETURN_DSPC | '__declspec(noreturn)' is available as a function attribute      |
-# -------------------------------------------------------------------------------------------------
+# -----------------------------------------------------------------------------------------------------
+# | Variable                       | Check                                                            |
+# |================================|==================================================================|
+# | COMPILER_HAS_NORETURN          | '_Noreturn' is available as a function attribute                 |
+# | COMPILER_HAS_NORETURN_ATTR     | '__attribute__((noreturn))' is available as a function attribute |
+# | COMPILER_HAS_NORETURN_DSPC     | '__declspec(noreturn)' is available as a function attribute      |
+# | COMPILER_HAS_THREAD_LOCAL_DSPC | '__declspec(thread)' is available as a variable attribute        |
+# -----------------------------------------------------------------------------------------------------
 
 
 # '_Noreturn' is available as a function attribute
@@ -38,3 +39,12 @@ check_c_source_compiles_or_zero(
     OUTPUT_VARIABLE
         COMPILER_HAS_NORETURN_DSPC
 )
+
+# '__declspec(thread)' is available as a variable attribute
+check_c_source_compiles_or_zero(
+    SOURCE
+        "static __declspec(thread) int x = 0; \n\
+         int main(void) { return x; }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_THREAD_LOCAL_DSPC
+)
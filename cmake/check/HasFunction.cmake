@@ -8,6 +8,7 @@
 # |==================================|==========================================================================================================|
 # | COMPILER_HAS_MS_ASSUME           | '__assume(int)' is available as a function                                                               |
 # | COMPILER_HAS_BUILTIN_UNREACHABLE | '__builtin_unreachable(void)' is available as a function                                                 |
+# | COMPILER_HAS_BUILTIN_PREFETCH    | '__builtin_prefetch(const void*)' is available as a function                                             |
 # | COMPILER_HAS_WCHAR_FWIDE         | '<wchar.h>' header is available and makes 'fwide(FILE*, int)' available as a function                    |
 # | COMPILER_HAS_WCHAR_FWPRINTF      | '<wchar.h>' header is available and makes 'fwprintf(FILE*, const wchar_t*, ...)' available as a function |
 # | COMPILER_HAS_C23_ALIGNOF         | 'alignof(T)' is available as a function                                                                  |
@@ -18,6 +19,11 @@
 # | COMPILER_HAS_MS_ALIGNOF_EXTN     | '__extension__ __alignof(T)' is available as a function                                                  |
 # | COMPILER_HAS_GNU_ALIGNOF         | '__alignof__(T)' is available as a function                                                              |
 # | COMPILER_HAS_GNU_ALIGNOF_EXTN    | '__extension__ __alignof__(T)' is available as a function                                                |
+# | COMPILER_HAS_LINUX_FUTEX         | 'syscall(SYS_futex, ...)' and 'clock_gettime(CLOCK_MONOTONIC, ...)' are available as functions           |
+# | COMPILER_HAS_C11_ATOMIC_MINMAX   | '__c11_atomic_fetch_{min,max}(volatile _Atomic(T)*, T, int)' are available as functions                  |
+# | COMPILER_HAS_C11_ATOMIC_FADD     | '__c11_atomic_fetch_{add,sub}(volatile _Atomic(F)*, F, int)' are available for F as float and double     |
+# | COMPILER_HAS_SYSCONF_L1_DCACHE   | 'sysconf(_SC_LEVEL1_DCACHE_LINESIZE)' is available as a function                                         |
+# | COMPILER_HAS_MADV_HUGEPAGE       | 'madvise(void*, size_t, MADV_HUGEPAGE)' is available as a function                                       |
 # -----------------------------------------------------------------------------------------------------------------------------------------------
 
 
@@ -43,6 +49,17 @@ check_c_source_compiles_or_zero(
         COMPILER_HAS_BUILTIN_UNREACHABLE
 )
 
+# '__builtin_prefetch(const void*)' is available as a function
+check_c_source_compiles_or_zero(
+    SOURCE
+        "int main(int argc, char **argv) { \n\
+             __builtin_prefetch(argv[0]);  \n\
+             return argc - 1;              \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_BUILTIN_PREFETCH
+)
+
 # '<wchar.h>' header is available and makes 'fwide(FILE*, int)' available as a function
 check_c_source_compiles_or_zero(
     SOURCE
@@ -150,3 +167,74 @@ check_c_source_compiles_or_zero(
     WILL_FAIL_IF_ANY_NOT
         ${COMPILER_HAS_EXTN}
 )
+
+# 'syscall(SYS_futex, ...)' and 'clock_gettime(CLOCK_MONOTONIC, ...)' are available as functions
+check_c_source_compiles_or_zero(
+    SOURCE
+        "#define _DEFAULT_SOURCE 1                                           \n\
+         #include <linux/futex.h>                                           \n\
+         #include <sys/syscall.h>                                           \n\
+         #include <time.h>                                                  \n\
+         #include <unistd.h>                                                \n\
+         int main(void) {                                                   \n\
+             static int word = 0;                                           \n\
+             struct timespec ts;                                            \n\
+             if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) { return 1; }    \n\
+             return (int) syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, 1); \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_LINUX_FUTEX
+)
+
+# '__c11_atomic_fetch_{min,max}(volatile _Atomic(T)*, T, int)' are available as functions
+check_c_source_compiles_or_zero(
+    SOURCE
+        "int main(void) {                                          \n\
+             static volatile _Atomic(int) obj = 0;                 \n\
+             int res = __c11_atomic_fetch_min(&obj, 1, 5);         \n\
+             return res + __c11_atomic_fetch_max(&obj, 1, 5) - 1;  \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_C11_ATOMIC_MINMAX
+    WILL_FAIL_IF_ANY_NOT
+        ${COMPILER_HAS_ATOMIC}
+)
+
+# '__c11_atomic_fetch_{add,sub}(volatile _Atomic(F)*, F, int)' are available for F as float and double
+check_c_source_compiles_or_zero(
+    SOURCE
+        "int main(void) {                                      \n\
+             static volatile _Atomic(float) f = 0.0f;          \n\
+             static volatile _Atomic(double) d = 0.0;          \n\
+             float fr = __c11_atomic_fetch_add(&f, 1.0f, 5);   \n\
+             double dr = __c11_atomic_fetch_sub(&d, 1.0, 5);   \n\
+             return (int) (fr + (float) dr);                   \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_C11_ATOMIC_FADD
+    WILL_FAIL_IF_ANY_NOT
+        ${COMPILER_HAS_ATOMIC}
+)
+
+# 'sysconf(_SC_LEVEL1_DCACHE_LINESIZE)' is available as a function
+check_c_source_compiles_or_zero(
+    SOURCE
+        "#include <unistd.h>                                           \n\
+         int main(void) {                                             \n\
+             return (int) (sysconf(_SC_LEVEL1_DCACHE_LINESIZE) < 0l); \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_SYSCONF_L1_DCACHE
+)
+
+# 'madvise(void*, size_t, MADV_HUGEPAGE)' is available as a function
+check_c_source_compiles_or_zero(
+    SOURCE
+        "#define _DEFAULT_SOURCE 1                              \n\
+         #include <sys/mman.h>                                 \n\
+         int main(void) {                                      \n\
+             return madvise((void *) 0, 0u, MADV_HUGEPAGE);    \n\
+         }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_MADV_HUGEPAGE
+)
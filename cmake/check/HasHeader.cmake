@@ -6,12 +6,22 @@
 # ----------------------------------------------------------------
 # | Variable                 | Check                             |
 # |==========================|===================================|
+# | COMPILER_HAS_IMMINTRIN_H | <immintrin.h> header is available |
 # | COMPILER_HAS_STDATOMIC_H | <stdatomic.h> header is available |
 # | COMPILER_HAS_STDINT_H    | <stdint.h> header is available    |
 # | COMPILER_HAS_WCHAR_H     | <wchar.h> header is available     |
 # ----------------------------------------------------------------
 
 
+# <immintrin.h> header is available
+check_c_source_compiles_or_zero(
+    SOURCE
+        "#include <immintrin.h> \n\
+         int main(void) {}"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_IMMINTRIN_H
+)
+
 # <stdatomic.h> header is available
 check_c_source_compiles_or_zero(
     SOURCE
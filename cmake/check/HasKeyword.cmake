@@ -3,15 +3,17 @@
 
 # ---- Has Keyword ----
 
-# -------------------------------------------------------------------------
-# | Variable                  | Check                                     |
-# |===========================|===========================================|
-# | COMPILER_HAS_EXTN         | '__extension__' is available as a keyword |
-# | COMPILER_HAS_RESTRICT     | 'restrict' is available as a keyword      |
-# | COMPILER_HAS_MS_RESTRICT  | '__restrict' is available as a keyword    |
-# | COMPILER_HAS_GNU_RESTRICT | '__restrict__' is available as a keyword  |
-# | COMPILER_HAS_ATOMIC       | '_Atomic' is available as a keyword       |
-# -------------------------------------------------------------------------
+# ---------------------------------------------------------------------------------
+# | Variable                      | Check                                         |
+# |===============================|===============================================|
+# | COMPILER_HAS_EXTN             | '__extension__' is available as a keyword     |
+# | COMPILER_HAS_RESTRICT         | 'restrict' is available as a keyword          |
+# | COMPILER_HAS_MS_RESTRICT      | '__restrict' is available as a keyword        |
+# | COMPILER_HAS_GNU_RESTRICT     | '__restrict__' is available as a keyword      |
+# | COMPILER_HAS_ATOMIC           | '_Atomic' is available as a keyword           |
+# | COMPILER_HAS_THREAD_LOCAL     | '_Thread_local' is available as a keyword     |
+# | COMPILER_HAS_GNU_THREAD_LOCAL | '__thread' is available as a keyword          |
+# ---------------------------------------------------------------------------------
 
 
 # '__extension__' is available as a keyword
@@ -74,3 +76,21 @@ check_c_source_compiles_or_zero(
     WILL_FAIL_IF_ANY_NOT
         ${COMPILER_HAS_STDATOMIC_H}
 )
+
+# '_Thread_local' is available as a keyword
+check_c_source_compiles_or_zero(
+    SOURCE
+        "static _Thread_local int x = 0; \n\
+         int main(void) { return x; }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_THREAD_LOCAL
+)
+
+# '__thread' is available as a keyword
+check_c_source_compiles_or_zero(
+    SOURCE
+        "static __thread int x = 0; \n\
+         int main(void) { return x; }"
+    OUTPUT_VARIABLE
+        COMPILER_HAS_GNU_THREAD_LOCAL
+)
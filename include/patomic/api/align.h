@@ -104,6 +104,11 @@ typedef struct {
  *   Returns the runtime upper bound of the cache line size for the target
  *   platform; may provide a more accurate value than the corresponding macro.
  *
+ * @details
+ *   The cache line size is detected the first time this is called, where the
+ *   platform provides a way to do so, and the result is cached. If it cannot
+ *   be detected, the value of the unstable macro is returned.
+ *
  * @warning
  *   This value is only required to be valid for platforms for which this
  *   library supports operations. If used on a platform where no operations are
@@ -121,6 +126,52 @@ PATOMIC_EXPORT size_t
 patomic_cache_line_size(void);
 
 
+/**
+ * @addtogroup align
+ *
+ * @brief
+ *   Returns the runtime minimum offset between two objects required to avoid
+ *   false sharing, equivalent to C++17's
+ *   std::hardware_destructive_interference_size.
+ *
+ * @details
+ *   This is usually the cache line size, but may be larger on platforms which
+ *   prefetch multiple cache lines together, such as x86.
+ *
+ * @note
+ *   The value will not return a value larger than its unstable macro
+ *   equivalent but may return a smaller value.
+ *
+ * @note
+ *   The value returned is always a power of 2.
+ */
+PATOMIC_EXPORT size_t
+patomic_destructive_interference_size(void);
+
+
+/**
+ * @addtogroup align
+ *
+ * @brief
+ *   Returns the runtime maximum size of contiguous memory which is likely to
+ *   share a cache line, equivalent to C++17's
+ *   std::hardware_constructive_interference_size.
+ *
+ * @details
+ *   Objects which are accessed together should fit within a buffer of this
+ *   size and alignment, so that they are transferred between caches together.
+ *
+ * @note
+ *   The value will not return a value larger than
+ *   patomic_destructive_interference_size().
+ *
+ * @note
+ *   The value returned is always a power of 2.
+ */
+PATOMIC_EXPORT size_t
+patomic_constructive_interference_size(void);
+
+
 /**
  * @addtogroup align
  *
@@ -0,0 +1,174 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_ALLOC_H
+#define PATOMIC_API_ALLOC_H
+
+#include <patomic/api/align.h>
+#include <patomic/api/export.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup alloc
+ *
+ * @brief
+ *   Enum constants which modify how storage for atomic objects is allocated.
+ *
+ * @note
+ *   Flags can be combined with bitwise OR.
+ */
+typedef enum {
+
+    /** @brief Allocate storage meeting the recommended alignment. */
+    patomic_alloc_NONE = 0x0
+
+    /** @brief Place each object at the start of its own region of
+     *         patomic_destructive_interference_size() bytes, so that no two
+     *         objects, or an object and unrelated data, share a cache line. */
+    ,patomic_alloc_ISOLATE = 0x1
+
+    /** @brief Hint that large allocations should be backed by huge pages,
+     *         reducing TLB misses when accessing large arrays of objects.
+     *  @note  This is ignored if the platform does not support it. */
+    ,patomic_alloc_HUGE_PAGES = 0x2
+
+} patomic_alloc_flag_t;
+
+
+/**
+ * @addtogroup alloc
+ *
+ * @brief
+ *   Returns the distance in bytes between consecutive objects in an array
+ *   allocated with patomic_alloc_array when it is passed a stride of 0.
+ *
+ * @param align
+ *   Alignment requirements of the objects, usually obtained from
+ *   patomic_create. Only "recommended" is used.
+ *
+ * @param width
+ *   Size in bytes of each object.
+ *
+ * @param flags
+ *   Combination of patomic_alloc_flag_t values.
+ *
+ * @returns
+ *   The value of "width" rounded up to a multiple of "align.recommended", or
+ *   to a multiple of patomic_destructive_interference_size() if "flags"
+ *   contains patomic_alloc_ISOLATE. Returns 0 if "width" is 0, or if
+ *   "align.recommended" is not a positive power of 2.
+ */
+PATOMIC_EXPORT size_t
+patomic_alloc_stride(
+    patomic_align_t align,
+    size_t width,
+    unsigned int flags
+);
+
+
+/**
+ * @addtogroup alloc
+ *
+ * @brief
+ *   Allocates storage for a single atomic object which meets the recommended
+ *   alignment of "align".
+ *
+ * @param align
+ *   Alignment requirements of the object, usually obtained from
+ *   patomic_create. Only "recommended" is used.
+ *
+ * @param width
+ *   Size in bytes of the object.
+ *
+ * @param flags
+ *   Combination of patomic_alloc_flag_t values.
+ *
+ * @returns
+ *   Pointer to uninitialized storage of at least "width" bytes, which must be
+ *   released with patomic_free, or NULL if the allocation failed or the
+ *   parameters are invalid.
+ *
+ * @note
+ *   Equivalent to patomic_alloc_array with a count of 1 and a stride of 0.
+ */
+PATOMIC_EXPORT void *
+patomic_alloc(
+    patomic_align_t align,
+    size_t width,
+    unsigned int flags
+);
+
+
+/**
+ * @addtogroup alloc
+ *
+ * @brief
+ *   Allocates storage for an array of atomic objects, each of which meets the
+ *   recommended alignment of "align".
+ *
+ * @details
+ *   Object "i" starts "i * stride" bytes after the returned pointer. If
+ *   "flags" contains patomic_alloc_ISOLATE, the stride is additionally rounded
+ *   up to a multiple of patomic_destructive_interference_size(), and the
+ *   storage is aligned to it.
+ *
+ * @param align
+ *   Alignment requirements of the objects, usually obtained from
+ *   patomic_create. Only "recommended" is used.
+ *
+ * @param width
+ *   Size in bytes of each object.
+ *
+ * @param count
+ *   Number of objects in the array.
+ *
+ * @param stride
+ *   Distance in bytes between consecutive objects. Must be 0, or not less
+ *   than "width" and a multiple of "align.recommended". If it is 0, the value
+ *   returned by patomic_alloc_stride is used.
+ *
+ * @param flags
+ *   Combination of patomic_alloc_flag_t values.
+ *
+ * @returns
+ *   Pointer to uninitialized storage of at least "count * stride" bytes,
+ *   which must be released with patomic_free, or NULL if the allocation
+ *   failed or the parameters are invalid.
+ */
+PATOMIC_EXPORT void *
+patomic_alloc_array(
+    patomic_align_t align,
+    size_t width,
+    size_t count,
+    size_t stride,
+    unsigned int flags
+);
+
+
+/**
+ * @addtogroup alloc
+ *
+ * @brief
+ *   Releases storage allocated with patomic_alloc or patomic_alloc_array.
+ *
+ * @param ptr
+ *   Pointer returned from patomic_alloc or patomic_alloc_array. If it is
+ *   NULL, no action is taken.
+ */
+PATOMIC_EXPORT void
+patomic_free(
+    void *ptr
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_ALLOC_H */
@@ -59,12 +59,39 @@ typedef enum {
     /** @brief Transaction specific raw operations. */
     patomic_opcat_TRAW = 0x200,
 
+    /** @brief Wait and notify operations. Not included in any "opcats" label,
+     *         since transaction ops structs have no such operations. */
+    patomic_opcat_WAIT = 0x400,
+
+    /** @brief Batched void operations. Not included in any "opcats" label,
+     *         since transaction ops structs have no such operations. */
+    patomic_opcat_BATCH_V = 0x800,
+
+    /** @brief Batched fetch operations. Not included in any "opcats" label,
+     *         since transaction ops structs have no such operations. */
+    patomic_opcat_BATCH_F = 0x1000,
+
+    /** @brief Floating-point void (non-fetch) operations. Not included in any
+     *         "opcats" label, since transaction ops structs have no such
+     *         operations. */
+    patomic_opcat_FLT_V = 0x2000,
+
+    /** @brief Floating-point fetch operations. Not included in any "opcats"
+     *         label, since transaction ops structs have no such operations. */
+    patomic_opcat_FLT_F = 0x4000,
+
     /** @brief Binary operations. */
     patomic_opcats_BIN = patomic_opcat_BIN_V | patomic_opcat_BIN_F,
 
     /** @brief Arithmetic operations. */
     patomic_opcats_ARI = patomic_opcat_ARI_V | patomic_opcat_ARI_F,
 
+    /** @brief Batched operations. */
+    patomic_opcats_BATCH = patomic_opcat_BATCH_V | patomic_opcat_BATCH_F,
+
+    /** @brief Floating-point operations. */
+    patomic_opcats_FLT = patomic_opcat_FLT_V | patomic_opcat_FLT_F,
+
     /** @brief All implicit operations. */
     patomic_opcats_IMPLICIT = patomic_opcat_LDST |
                               patomic_opcat_XCHG |
@@ -128,10 +155,14 @@ typedef enum {
     /** @brief opcat_XCHG: compare-exchange strong operation. */
     patomic_opkind_CMPXCHG_STRONG = 0x4,
 
+    /** @brief opcat_XCHG: fetch_update operation. */
+    patomic_opkind_FETCH_UPDATE = 0x8,
+
     /** @brief opcat_XCHG: all operations. */
-    patomic_opkinds_XCHG = patomic_opkind_EXCHANGE     |
-                           patomic_opkind_CMPXCHG_WEAK |
-                           patomic_opkind_CMPXCHG_STRONG,
+    patomic_opkinds_XCHG = patomic_opkind_EXCHANGE       |
+                           patomic_opkind_CMPXCHG_WEAK   |
+                           patomic_opkind_CMPXCHG_STRONG |
+                           patomic_opkind_FETCH_UPDATE,
 
     /** @brief opcat_BIT or opcat_TFLAG: test operation. */
     patomic_opkind_TEST = 0x1,
@@ -192,12 +223,44 @@ typedef enum {
     /** @brief opcats_ARI: negation operation. */
     patomic_opkind_NEG = 0x10,
 
+    /** @brief opcats_ARI: signed minimum operation. */
+    patomic_opkind_MIN = 0x20,
+
+    /** @brief opcats_ARI: signed maximum operation. */
+    patomic_opkind_MAX = 0x40,
+
+    /** @brief opcats_ARI: unsigned minimum operation. */
+    patomic_opkind_UMIN = 0x80,
+
+    /** @brief opcats_ARI: unsigned maximum operation. */
+    patomic_opkind_UMAX = 0x100,
+
+    /** @brief opcats_ARI: signed saturating addition operation. */
+    patomic_opkind_ADD_SAT = 0x200,
+
+    /** @brief opcats_ARI: signed saturating subtraction operation. */
+    patomic_opkind_SUB_SAT = 0x400,
+
+    /** @brief opcats_ARI: unsigned saturating addition operation. */
+    patomic_opkind_UADD_SAT = 0x800,
+
+    /** @brief opcats_ARI: unsigned saturating subtraction operation. */
+    patomic_opkind_USUB_SAT = 0x1000,
+
     /** @brief opcats_ARI: all operations. */
-    patomic_opkinds_ARI = patomic_opkind_ADD |
-                          patomic_opkind_SUB |
-                          patomic_opkind_INC |
-                          patomic_opkind_DEC |
-                          patomic_opkind_NEG,
+    patomic_opkinds_ARI = patomic_opkind_ADD      |
+                          patomic_opkind_SUB      |
+                          patomic_opkind_INC      |
+                          patomic_opkind_DEC      |
+                          patomic_opkind_NEG      |
+                          patomic_opkind_MIN      |
+                          patomic_opkind_MAX      |
+                          patomic_opkind_UMIN     |
+                          patomic_opkind_UMAX     |
+                          patomic_opkind_ADD_SAT  |
+                          patomic_opkind_SUB_SAT  |
+                          patomic_opkind_UADD_SAT |
+                          patomic_opkind_USUB_SAT,
 
     /** @brief opcat_TSPEC: double compare-exchange operation. */
     patomic_opkind_DOUBLE_CMPXCHG = 0x1,
@@ -211,11 +274,19 @@ typedef enum {
     /** @brief opcat_TSPEC: generic operation with fallback. */
     patomic_opkind_GENERIC_WFB = 0x8,
 
+    /** @brief opcat_TSPEC: multi load operation. */
+    patomic_opkind_MULTI_LOAD = 0x10,
+
+    /** @brief opcat_TSPEC: multi operation. */
+    patomic_opkind_MULTI_OP = 0x20,
+
     /** @brief opcat_TSPEC: all operations. */
     patomic_opkinds_TSPEC = patomic_opkind_DOUBLE_CMPXCHG |
                             patomic_opkind_MULTI_CMPXCHG  |
                             patomic_opkind_GENERIC        |
-                            patomic_opkind_GENERIC_WFB,
+                            patomic_opkind_GENERIC_WFB    |
+                            patomic_opkind_MULTI_LOAD     |
+                            patomic_opkind_MULTI_OP,
 
     /** @brief opcat_TRAW: transaction start operation. */
     patomic_opkind_TBEGIN = 0x1,
@@ -241,7 +312,73 @@ typedef enum {
                            patomic_opkind_TABORT_ALL    |
                            patomic_opkind_TABORT_SINGLE |
                            patomic_opkind_TTEST         |
-                           patomic_opkind_TDEPTH
+                           patomic_opkind_TDEPTH,
+
+    /** @brief opcat_WAIT: wait operation. */
+    patomic_opkind_WAIT = 0x1,
+
+    /** @brief opcat_WAIT: timed wait operation. */
+    patomic_opkind_WAIT_TIMED = 0x2,
+
+    /** @brief opcat_WAIT: notify one operation. */
+    patomic_opkind_NOTIFY_ONE = 0x4,
+
+    /** @brief opcat_WAIT: notify all operation. */
+    patomic_opkind_NOTIFY_ALL = 0x8,
+
+    /** @brief opcat_WAIT: all operations. */
+    patomic_opkinds_WAIT = patomic_opkind_WAIT       |
+                           patomic_opkind_WAIT_TIMED |
+                           patomic_opkind_NOTIFY_ONE |
+                           patomic_opkind_NOTIFY_ALL,
+
+    /** @brief opcats_BATCH: batched addition operation. */
+    patomic_opkind_ADD_N = 0x1,
+
+    /** @brief opcats_BATCH: batched subtraction operation. */
+    patomic_opkind_SUB_N = 0x2,
+
+    /** @brief opcats_BATCH: batched binary OR operation. */
+    patomic_opkind_OR_N = 0x4,
+
+    /** @brief opcats_BATCH: batched binary XOR operation. */
+    patomic_opkind_XOR_N = 0x8,
+
+    /** @brief opcats_BATCH: batched binary AND operation. */
+    patomic_opkind_AND_N = 0x10,
+
+    /** @brief opcat_BATCH_F: batched exchange operation. */
+    patomic_opkind_EXCHANGE_N = 0x20,
+
+    /** @brief opcat_BATCH_F: batched strong compare-exchange operation. */
+    patomic_opkind_CMPXCHG_N = 0x40,
+
+    /** @brief opcat_BATCH_V: bulk store operation over a contiguous array. */
+    patomic_opkind_STORE_ARRAY = 0x80,
+
+    /** @brief opcat_BATCH_F: bulk load operation over a contiguous array. */
+    patomic_opkind_LOAD_ARRAY = 0x100,
+
+    /** @brief opcats_BATCH: all operations. */
+    patomic_opkinds_BATCH = patomic_opkind_ADD_N       |
+                            patomic_opkind_SUB_N       |
+                            patomic_opkind_OR_N        |
+                            patomic_opkind_XOR_N       |
+                            patomic_opkind_AND_N       |
+                            patomic_opkind_EXCHANGE_N  |
+                            patomic_opkind_CMPXCHG_N   |
+                            patomic_opkind_STORE_ARRAY |
+                            patomic_opkind_LOAD_ARRAY,
+
+    /** @brief opcats_FLT: floating-point addition operation. */
+    patomic_opkind_FADD = 0x1,
+
+    /** @brief opcats_FLT: floating-point subtraction operation. */
+    patomic_opkind_FSUB = 0x2,
+
+    /** @brief opcats_FLT: all operations. */
+    patomic_opkinds_FLT = patomic_opkind_FADD |
+                          patomic_opkind_FSUB
 
 } patomic_opkind_t;
 
@@ -551,6 +688,192 @@ patomic_feature_check_leaf_transaction(
 );
 
 
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Number of patomic_opcat_t labels with a single bit set.
+ *
+ * @warning
+ *   This value increases whenever an opcat is added, without a major version
+ *   bump. Types whose layout depends on it are marked as ABI unstable.
+ */
+#undef PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE
+#define PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE 15
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Struct containing the result of every feature check on an ops struct,
+ *   computed once so that later checks are a single bitwise operation.
+ *
+ * @details
+ *   The struct is a snapshot, and does not change if the ops struct it was
+ *   created from is modified afterwards.
+ *
+ * @warning
+ *   The layout of this type depends on
+ *   PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE, and may change without a
+ *   major version bump.
+ */
+typedef struct {
+
+    /** @brief Opcats where at least one operation is supported. */
+    unsigned int opcats_any;
+
+    /** @brief Opcats where every operation is supported. */
+    unsigned int opcats_all;
+
+    /** @brief Supported opkinds for each opcat, indexed by the position of the
+     *         opcat's single set bit. */
+    unsigned int opkinds[PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE];
+
+} patomic_feature_caps_abi_unstable_t;
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Computes the capabilities of the given implicit ops struct.
+ *
+ * @param ops
+ *   Pointer to a set of atomic operations with implicit memory ordering.
+ *
+ * @returns
+ *   Capabilities which give the same results as calling the feature check
+ *   functions directly on "ops".
+ */
+PATOMIC_EXPORT patomic_feature_caps_abi_unstable_t
+patomic_feature_caps(
+    const patomic_ops_t *ops
+);
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Computes the capabilities of the given explicit ops struct.
+ *
+ * @param ops
+ *   Pointer to a set of atomic operations with explicit memory ordering.
+ *
+ * @returns
+ *   Capabilities which give the same results as calling the feature check
+ *   functions directly on "ops".
+ */
+PATOMIC_EXPORT patomic_feature_caps_abi_unstable_t
+patomic_feature_caps_explicit(
+    const patomic_ops_explicit_t *ops
+);
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Computes the capabilities of the given transaction ops struct.
+ *
+ * @param ops
+ *   Pointer to a set of atomic operations implemented using a sequentially
+ *   consistent transaction, as well as transaction specific operations
+ *
+ * @returns
+ *   Capabilities which give the same results as calling the feature check
+ *   functions directly on "ops".
+ */
+PATOMIC_EXPORT patomic_feature_caps_abi_unstable_t
+patomic_feature_caps_transaction(
+    const patomic_ops_transaction_t *ops
+);
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Equivalent to the patomic_feature_check_all variant for the ops struct
+ *   that "caps" was computed from, without inspecting the ops struct.
+ *
+ * @param caps
+ *   Pointer to capabilities computed from an ops struct.
+ *
+ * @param opcats
+ *   One or more patomic_opcat_t flags combined.
+ *
+ * @returns
+ *   The input "opcats" value where each bit corresponding to a supported opcat
+ *   has been cleared. An opcat is supported if all of its operations are
+ *   supported.
+ */
+PATOMIC_EXPORT unsigned int
+patomic_feature_caps_check_all(
+    const patomic_feature_caps_abi_unstable_t *caps,
+    unsigned int opcats
+);
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Equivalent to the patomic_feature_check_any variant for the ops struct
+ *   that "caps" was computed from, without inspecting the ops struct.
+ *
+ * @param caps
+ *   Pointer to capabilities computed from an ops struct.
+ *
+ * @param opcats
+ *   One or more patomic_opcat_t flags combined.
+ *
+ * @returns
+ *   The input "opcats" value where each bit corresponding to a supported opcat
+ *   has been cleared. An opcat is supported if any of its operations are
+ *   supported.
+ */
+PATOMIC_EXPORT unsigned int
+patomic_feature_caps_check_any(
+    const patomic_feature_caps_abi_unstable_t *caps,
+    unsigned int opcats
+);
+
+
+/**
+ * @addtogroup feature_check
+ *
+ * @brief
+ *   Equivalent to the patomic_feature_check_leaf variant for the ops struct
+ *   that "caps" was computed from, without inspecting the ops struct.
+ *
+ * @param caps
+ *   Pointer to capabilities computed from an ops struct.
+ *
+ * @param opcat
+ *   Any single patomic_opcat_t flag that has a single bit set.
+ *
+ * @param opkinds
+ *   One or more patomic_opkind_t flags combined.
+ *
+ * @returns
+ *   The input "opkinds" value interpreted according to "opcat" where each bit
+ *   corresponding to a supported opkind has been cleared.
+ *
+ * @warning
+ *   The "opcat" value MUST have exactly 1 valid bit set. This means that labels
+ *   such as patomic_opcat_NONE and patomic_opcats_* are not allowed. This will
+ *   always be asserted (even if NDEBUG is defined).
+ */
+PATOMIC_EXPORT unsigned int
+patomic_feature_caps_check_leaf(
+    const patomic_feature_caps_abi_unstable_t *caps,
+    patomic_opcat_t opcat,
+    unsigned int opkinds
+);
+
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -0,0 +1,113 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_FENCE_H
+#define PATOMIC_API_FENCE_H
+
+#include <patomic/api/export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup fence
+ *
+ * @brief
+ *   Function signature for a memory fence.
+ *
+ * @details
+ *   Establishes memory synchronization ordering of non-atomic and relaxed
+ *   atomic accesses, as instructed by order, without an associated atomic
+ *   operation.
+ *
+ * @param order
+ *   Memory order of the fence. A relaxed fence has no effect.
+ *
+ * @note
+ *   This allows many relaxed operations to be ordered by a single fence,
+ *   rather than performing every operation with a stronger memory order.
+ */
+typedef void (* patomic_opsig_fence_t) (
+    int order
+);
+
+
+/**
+ * @addtogroup fence
+ *
+ * @brief
+ *   Struct containing memory fences provided by an implementation.
+ *
+ * @details
+ *   If a function pointer is NULL, the fence is not supported. Either both
+ *   fences are supported, or neither is.
+ */
+typedef struct {
+
+    /** @brief Orders memory accesses between threads, equivalent to C11's
+     *         atomic_thread_fence. */
+    patomic_opsig_fence_t fp_thread_fence;
+
+    /** @brief Orders memory accesses between a thread and a signal handler
+     *         executed in the same thread, equivalent to C11's
+     *         atomic_signal_fence. This only inhibits compiler reordering. */
+    patomic_opsig_fence_t fp_signal_fence;
+
+} patomic_fence_t;
+
+
+/**
+ * @addtogroup fence
+ *
+ * @brief
+ *   Performs a thread fence using the fence provided by the most efficient
+ *   implementation supporting fences.
+ *
+ * @param order
+ *   Memory order of the fence.
+ *
+ * @note
+ *   The implementation is looked up on the first call and cached for all
+ *   subsequent calls.
+ *
+ * @warning
+ *   If no implementation supports fences, the program is aborted. Use
+ *   patomic_create_fence to check for support.
+ */
+PATOMIC_EXPORT void
+patomic_thread_fence(
+    int order
+);
+
+
+/**
+ * @addtogroup fence
+ *
+ * @brief
+ *   Performs a signal fence using the fence provided by the most efficient
+ *   implementation supporting fences.
+ *
+ * @param order
+ *   Memory order of the fence.
+ *
+ * @note
+ *   The implementation is looked up on the first call and cached for all
+ *   subsequent calls.
+ *
+ * @warning
+ *   If no implementation supports fences, the program is aborted. Use
+ *   patomic_create_fence to check for support.
+ */
+PATOMIC_EXPORT void
+patomic_signal_fence(
+    int order
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_FENCE_H */
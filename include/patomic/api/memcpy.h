@@ -0,0 +1,190 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_MEMCPY_H
+#define PATOMIC_API_MEMCPY_H
+
+#include <patomic/api/export.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup memcpy
+ *
+ * @brief
+ *   Function signature for an atomic memcpy from shared memory.
+ *
+ * @details
+ *   Copies "byte_count" bytes from "src" to "dst", where every byte of "src"
+ *   is read with a relaxed atomic load. Bytes are read in chunks using the
+ *   widest atomic loads available, so a single byte is never torn, but there
+ *   is no guarantee that the whole buffer is read atomically.
+ *
+ *   If "order" is not relaxed, the copy is followed by a fence with "order",
+ *   so that it synchronizes with a release operation whose value was observed
+ *   by any of the loads.
+ *
+ * @param dst
+ *   Pointer to non-shared buffer into which to write the copied bytes.
+ *
+ * @param src
+ *   Pointer to shared buffer from which to copy bytes. May have any alignment.
+ *
+ * @param byte_count
+ *   Number of bytes to copy. If it is zero, "dst" and "src" are not accessed.
+ *
+ * @param order
+ *   Memory order of the copy. Must be a valid load memory order.
+ *
+ * @note
+ *   This is intended for reading the payload protected by a seqlock, where the
+ *   payload may be written concurrently and the copy is discarded if so.
+ */
+typedef void (* patomic_opsig_load_memcpy_t) (
+    void *dst,
+    const volatile void *src,
+    size_t byte_count,
+    int order
+);
+
+
+/**
+ * @addtogroup memcpy
+ *
+ * @brief
+ *   Function signature for an atomic memcpy to shared memory.
+ *
+ * @details
+ *   Copies "byte_count" bytes from "src" to "dst", where every byte of "dst"
+ *   is written with a relaxed atomic store. Bytes are written in chunks using
+ *   the widest atomic stores available, so a single byte is never torn, but
+ *   there is no guarantee that the whole buffer is written atomically.
+ *
+ *   If "order" is not relaxed, the copy is preceded by a fence with "order",
+ *   so that an acquire operation which observes any of the stores
+ *   synchronizes with it.
+ *
+ * @param dst
+ *   Pointer to shared buffer into which to write the copied bytes. May have
+ *   any alignment.
+ *
+ * @param src
+ *   Pointer to non-shared buffer from which to copy bytes.
+ *
+ * @param byte_count
+ *   Number of bytes to copy. If it is zero, "dst" and "src" are not accessed.
+ *
+ * @param order
+ *   Memory order of the copy. Must be a valid store memory order.
+ */
+typedef void (* patomic_opsig_store_memcpy_t) (
+    volatile void *dst,
+    const void *src,
+    size_t byte_count,
+    int order
+);
+
+
+/**
+ * @addtogroup memcpy
+ *
+ * @brief
+ *   Struct containing atomic memcpy operations provided by an implementation.
+ *
+ * @details
+ *   If a function pointer is NULL, the operation is not supported. Either both
+ *   operations are supported, or neither is.
+ */
+typedef struct {
+
+    /** @brief Copies from a shared buffer using relaxed atomic loads. */
+    patomic_opsig_load_memcpy_t fp_load_memcpy;
+
+    /** @brief Copies to a shared buffer using relaxed atomic stores. */
+    patomic_opsig_store_memcpy_t fp_store_memcpy;
+
+} patomic_memcpy_t;
+
+
+/**
+ * @addtogroup memcpy
+ *
+ * @brief
+ *   Performs an atomic memcpy from shared memory using the operation provided
+ *   by the most efficient implementation supporting it.
+ *
+ * @param dst
+ *   Pointer to non-shared buffer into which to write the copied bytes.
+ *
+ * @param src
+ *   Pointer to shared buffer from which to copy bytes.
+ *
+ * @param byte_count
+ *   Number of bytes to copy.
+ *
+ * @param order
+ *   Memory order of the copy. Must be a valid load memory order.
+ *
+ * @note
+ *   The implementation is looked up on the first call and cached for all
+ *   subsequent calls.
+ *
+ * @warning
+ *   If no implementation supports atomic memcpy, the program is aborted. Use
+ *   patomic_create_memcpy to check for support.
+ */
+PATOMIC_EXPORT void
+patomic_atomic_load_memcpy(
+    void *dst,
+    const volatile void *src,
+    size_t byte_count,
+    int order
+);
+
+
+/**
+ * @addtogroup memcpy
+ *
+ * @brief
+ *   Performs an atomic memcpy to shared memory using the operation provided
+ *   by the most efficient implementation supporting it.
+ *
+ * @param dst
+ *   Pointer to shared buffer into which to write the copied bytes.
+ *
+ * @param src
+ *   Pointer to non-shared buffer from which to copy bytes.
+ *
+ * @param byte_count
+ *   Number of bytes to copy.
+ *
+ * @param order
+ *   Memory order of the copy. Must be a valid store memory order.
+ *
+ * @note
+ *   The implementation is looked up on the first call and cached for all
+ *   subsequent calls.
+ *
+ * @warning
+ *   If no implementation supports atomic memcpy, the program is aborted. Use
+ *   patomic_create_memcpy to check for support.
+ */
+PATOMIC_EXPORT void
+patomic_atomic_store_memcpy(
+    volatile void *dst,
+    const void *src,
+    size_t byte_count,
+    int order
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_MEMCPY_H */
@@ -0,0 +1,167 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_MUTEX_H
+#define PATOMIC_API_MUTEX_H
+
+#include <patomic/api/export.h>
+#include <patomic/api/ops/transaction.h>
+#include <patomic/api/transaction.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup mutex
+ *
+ * @brief
+ *   A mutex whose critical sections are executed inside a transaction where
+ *   possible, so that critical sections which do not conflict run in parallel.
+ *
+ * @details
+ *   Locking first attempts to start a transaction which reads the lock flag,
+ *   leaving the critical section to run inside the transaction, which is
+ *   committed on unlock. If the flag is set, or transactions keep aborting,
+ *   the flag is acquired as a spinlock instead. Acquiring the flag aborts all
+ *   transactions which have read it, so the two paths are mutually exclusive.  \n
+ *   The number of transaction attempts and the decision whether to retry an
+ *   abort are governed by a patomic_transaction_policy_t.                      \n
+ *   If raw transactions are not supported, the mutex behaves as a spinlock.
+ *
+ * @warning
+ *   The layout of this type depends on PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE,
+ *   which may change without notice, causing an ABI break with this type.
+ *
+ * @note
+ *   All members must only be accessed through the patomic_elided_mutex_*
+ *   functions. Members which are written by every lock or unlock are kept on
+ *   separate cache lines from those which are read inside transactions.
+ */
+typedef struct {
+
+    /** @brief The lock flag, which is set while the mutex is held without a
+     *         transaction. */
+    patomic_transaction_padded_flag_holder_abi_unstable_t holder;
+
+    /** @brief Raw transaction operations used to elide the lock. */
+    patomic_ops_transaction_raw_t raw_ops;
+
+    /** @brief Flag operations used to acquire and release the lock. */
+    patomic_ops_transaction_flag_t flag_ops;
+
+    /** @brief Keeps the members below off the cache lines read inside
+     *         transactions. */
+    unsigned char _padding[PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE];
+
+    /** @brief Policy deciding how many transaction attempts to make. */
+    patomic_transaction_policy_t policy;
+
+    /** @brief Number of critical sections executed inside a transaction. */
+    unsigned long elided_count;
+
+    /** @brief Number of critical sections executed holding the lock flag. */
+    unsigned long fallback_count;
+
+} patomic_elided_mutex_abi_unstable_t;
+
+
+/**
+ * @addtogroup mutex
+ *
+ * @brief
+ *   Initializes an elided mutex in the unlocked state, using the raw
+ *   transaction and flag operations of the most efficient implementation
+ *   supporting them.
+ *
+ * @param mutex
+ *   Non-null pointer to the mutex to initialize.
+ *
+ * @param attempts
+ *   Maximum number of transaction attempts to make on each lock before
+ *   acquiring the lock flag. If zero, the lock is never elided.
+ *
+ * @returns
+ *   A non-zero value if the mutex can be used, otherwise the value 0 if no
+ *   implementation supports flag operations.
+ */
+PATOMIC_EXPORT int
+patomic_elided_mutex_init(
+    patomic_elided_mutex_abi_unstable_t *mutex,
+    unsigned long attempts
+);
+
+
+/**
+ * @addtogroup mutex
+ *
+ * @brief
+ *   Locks an elided mutex, either by starting a transaction or by acquiring
+ *   the lock flag.
+ *
+ * @param mutex
+ *   Non-null pointer to an initialized mutex.
+ *
+ * @warning
+ *   If the lock is elided, the critical section runs inside a transaction,
+ *   so it must not perform operations which always abort a transaction (such
+ *   as system calls), or the lock will never be elided.
+ */
+PATOMIC_EXPORT void
+patomic_elided_mutex_lock(
+    patomic_elided_mutex_abi_unstable_t *mutex
+);
+
+
+/**
+ * @addtogroup mutex
+ *
+ * @brief
+ *   Unlocks an elided mutex, either by committing the transaction or by
+ *   releasing the lock flag.
+ *
+ * @param mutex
+ *   Non-null pointer to a mutex locked by the calling thread.
+ */
+PATOMIC_EXPORT void
+patomic_elided_mutex_unlock(
+    patomic_elided_mutex_abi_unstable_t *mutex
+);
+
+
+/**
+ * @addtogroup mutex
+ *
+ * @brief
+ *   Reads how many critical sections of an elided mutex were executed inside
+ *   a transaction and how many were executed holding the lock flag.
+ *
+ * @param mutex
+ *   Non-null pointer to an initialized mutex.
+ *
+ * @param elided
+ *   Non-null pointer to the object to write the number of elided critical
+ *   sections to.
+ *
+ * @param fallback
+ *   Non-null pointer to the object to write the number of critical sections
+ *   which acquired the lock flag to.
+ *
+ * @note
+ *   If atomics are not available when building this library, nothing is
+ *   counted and both values are zero.
+ */
+PATOMIC_EXPORT void
+patomic_elided_mutex_stats(
+    const patomic_elided_mutex_abi_unstable_t *mutex,
+    unsigned long *elided,
+    unsigned long *fallback
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_MUTEX_H */
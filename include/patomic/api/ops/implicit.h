@@ -4,6 +4,10 @@
 #ifndef PATOMIC_API_OPS_IMPLICIT_H
 #define PATOMIC_API_OPS_IMPLICIT_H
 
+#include "update.h"
+
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -130,6 +134,51 @@ typedef int (* patomic_opsig_cmpxchg_t) (
 );
 
 
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for an atomic fetch_update operation with implicit
+ *   memory order.
+ *
+ * @details
+ *   Atomically replaces the value of an object with a value computed by a
+ *   user provided callback from its current value, and returns the value the
+ *   object held previously, in a single read-modify-write atomic operation. If
+ *   the callback declines to modify the object, this is a single atomic read
+ *   (load) operation.
+ *
+ * @param obj
+ *   Pointer to object whose value to atomically update.
+ *
+ * @param fn
+ *   Callback computing the desired value from the current value of "obj".
+ *
+ * @param ctx
+ *   Context pointer passed to each call of "fn".
+ *
+ * @param ret
+ *   Pointer to object into which to write the existing value held by "obj".
+ *
+ * @returns
+ *   The value 1 if "obj" was modified, otherwise the value 0 if "fn" declined
+ *   to modify it.
+ *
+ * @note
+ *   The callback is called inside a compare-exchange loop, and may be called
+ *   multiple times if "obj" is concurrently modified.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef int (* patomic_opsig_fetch_update_t) (
+    volatile void *obj,
+    patomic_update_fn_t fn,
+    void *ctx,
+    void *ret
+);
+
+
 /**
  * @addtogroup ops.implicit
  *
@@ -307,6 +356,279 @@ typedef void (* patomic_opsig_void_noarg_t) (
 );
 
 
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for an atomic wait operation with implicit memory
+ *   order.
+ *
+ * @details
+ *   Repeatedly atomically loads the value of an object, and blocks the calling
+ *   thread until the loaded value no longer compares equal to an old value.
+ *   The thread is unblocked by a notify operation on the same object, or
+ *   spuriously, after which the value is loaded and compared again.
+ *
+ * @param obj
+ *   Pointer to object whose value will be atomically loaded.
+ *
+ * @param old
+ *   Pointer to object holding the value to compare against.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_wait_t) (
+    const volatile void *obj,
+    const void *old
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for an atomic timed wait operation with implicit memory
+ *   order.
+ *
+ * @details
+ *   Behaves as patomic_opsig_wait_t, except that the calling thread stops
+ *   waiting once the timeout has elapsed.
+ *
+ * @param obj
+ *   Pointer to object whose value will be atomically loaded.
+ *
+ * @param old
+ *   Pointer to object holding the value to compare against.
+ *
+ * @param timeout_us
+ *   Maximum time to wait for, in microseconds, measured with a monotonic
+ *   clock.
+ *
+ * @returns
+ *   The value 1 if the loaded value no longer compares equal to the old value,
+ *   otherwise the value 0 if the timeout elapsed first.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef int (* patomic_opsig_wait_timed_t) (
+    const volatile void *obj,
+    const void *old,
+    unsigned long timeout_us
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for an atomic notify operation.
+ *
+ * @details
+ *   Unblocks threads blocked in a wait operation on an object. Notify
+ *   operations do not access the object, and do not take a memory order.
+ *
+ * @param obj
+ *   Pointer to object on which threads may be waiting.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_notify_t) (
+    const volatile void *obj
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for a batch of atomic binary operations with implicit
+ *   memory order.
+ *
+ * @details
+ *   For each index i less than "count", atomically loads objs[i], performs an
+ *   implicitly known binary operation on the value, and stores the result in
+ *   a single atomic read-modify-write operation. The operations are performed
+ *   in index order, but the batch as a whole is not atomic.
+ *
+ * @param objs
+ *   Array of "count" pointers to objects whose values will be atomically
+ *   modified, and passed as first parameter in each binary operation.
+ *
+ * @param args
+ *   Pointer to contiguous array of "count" objects whose values are passed as
+ *   the second parameter in each binary operation.
+ *
+ * @param count
+ *   Number of operations in the batch. May be zero, in which case no other
+ *   parameter is accessed.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_void_n_t) (
+    volatile void *const *objs,
+    const void *args,
+    size_t count
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for a batch of atomic fetch binary operations with
+ *   implicit memory order.
+ *
+ * @details
+ *   For each index i less than "count", atomically loads objs[i], performs an
+ *   implicitly known binary operation on the value, and stores the result in
+ *   a single atomic read-modify-write operation. The operations are performed
+ *   in index order, but the batch as a whole is not atomic.
+ *
+ * @param objs
+ *   Array of "count" pointers to objects whose values will be atomically
+ *   modified, and passed as first parameter in each binary operation.
+ *
+ * @param args
+ *   Pointer to contiguous array of "count" objects whose values are passed as
+ *   the second parameter in each binary operation.
+ *
+ * @param rets
+ *   Pointer to contiguous array of "count" objects into which to write the
+ *   original value of each object in "objs" before modification.
+ *
+ * @param count
+ *   Number of operations in the batch. May be zero, in which case no other
+ *   parameter is accessed.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_fetch_n_t) (
+    volatile void *const *objs,
+    const void *args,
+    void *rets,
+    size_t count
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for a batch of atomic compare-exchange (cmpxchg)
+ *   operations with implicit memory order.
+ *
+ * @details
+ *   For each index i less than "count", performs a cmpxchg operation on
+ *   objs[i] with the i-th expected and desired values, as if by
+ *   patomic_opsig_cmpxchg_t. The operations are performed in index order,
+ *   but the batch as a whole is not atomic.
+ *
+ * @param objs
+ *   Array of "count" pointers to objects whose values to atomically cmpxchg.
+ *
+ * @param expecteds
+ *   Pointer to contiguous array of "count" objects whose values are compared
+ *   against the existing values of the objects in "objs", and into which the
+ *   existing values will be stored if the comparison fails.
+ *
+ * @param desireds
+ *   Pointer to contiguous array of "count" objects whose values will replace
+ *   the existing values of the objects in "objs".
+ *
+ * @param count
+ *   Number of operations in the batch. May be zero, in which case no other
+ *   parameter is accessed.
+ *
+ * @returns
+ *   The number of operations in the batch which succeeded.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef size_t (* patomic_opsig_cmpxchg_n_t) (
+    volatile void *const *objs,
+    void *expecteds,
+    const void *desireds,
+    size_t count
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for a bulk atomic store operation over a contiguous
+ *   array of objects with implicit memory order.
+ *
+ * @details
+ *   For each index i less than "count", atomically stores the i-th desired
+ *   value in the i-th object of "objs". Each store is atomic, but the array as
+ *   a whole is not stored atomically, and stores may be performed in any
+ *   order.
+ *
+ * @param objs
+ *   Pointer to contiguous array of "count" objects whose values will be
+ *   atomically replaced. Each object must be suitably aligned for an atomic
+ *   operation.
+ *
+ * @param desireds
+ *   Pointer to contiguous array of "count" objects whose values will be
+ *   stored in the objects in "objs".
+ *
+ * @param count
+ *   Number of objects in the array. May be zero, in which case no other
+ *   parameter is accessed.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_store_array_t) (
+    volatile void *objs,
+    const void *desireds,
+    size_t count
+);
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Function signature for a bulk atomic load operation over a contiguous
+ *   array of objects with implicit memory order.
+ *
+ * @details
+ *   For each index i less than "count", atomically loads the value of the
+ *   i-th object of "objs". Each load is atomic, but the array as a whole is
+ *   not loaded atomically, and loads may be performed in any order.
+ *
+ * @param objs
+ *   Pointer to contiguous array of "count" objects from which values will be
+ *   atomically loaded. Each object must be suitably aligned for an atomic
+ *   operation.
+ *
+ * @param rets
+ *   Pointer to contiguous array of "count" objects into which to write the
+ *   atomically loaded values.
+ *
+ * @param count
+ *   Number of objects in the array. May be zero, in which case no other
+ *   parameter is accessed.
+ *
+ * @note
+ *   Width of all objects is the same, and is known implicitly.
+ */
+typedef void (* patomic_opsig_load_array_t) (
+    const volatile void *objs,
+    void *rets,
+    size_t count
+);
+
+
 /**
  * @addtogroup ops.implicit
  *
@@ -336,6 +658,46 @@ typedef struct {
      *         implicit memory order. There is no undefined behaviour. */
     patomic_opsig_void_noarg_t fp_neg;
 
+    /** @brief Atomic minimum of signed values using two's complement
+     *         representation with implicit memory order. There is no undefined
+     *         behaviour. */
+    patomic_opsig_void_t fp_min;
+
+    /** @brief Atomic maximum of signed values using two's complement
+     *         representation with implicit memory order. There is no undefined
+     *         behaviour. */
+    patomic_opsig_void_t fp_max;
+
+    /** @brief Atomic minimum of unsigned values with implicit memory order.
+     *         There is no undefined behaviour. */
+    patomic_opsig_void_t fp_umin;
+
+    /** @brief Atomic maximum of unsigned values with implicit memory order.
+     *         There is no undefined behaviour. */
+    patomic_opsig_void_t fp_umax;
+
+    /** @brief Atomic saturating addition of signed values using two's
+     *         complement representation with implicit memory order, clamping
+     *         the result to the range of the signed type. There is no
+     *         undefined behaviour. */
+    patomic_opsig_void_t fp_add_sat;
+
+    /** @brief Atomic saturating subtraction of signed values using two's
+     *         complement representation with implicit memory order, clamping
+     *         the result to the range of the signed type. There is no
+     *         undefined behaviour. */
+    patomic_opsig_void_t fp_sub_sat;
+
+    /** @brief Atomic saturating addition of unsigned values with implicit
+     *         memory order, clamping the result to the range of the unsigned
+     *         type. There is no undefined behaviour. */
+    patomic_opsig_void_t fp_uadd_sat;
+
+    /** @brief Atomic saturating subtraction of unsigned values with implicit
+     *         memory order, clamping the result to the range of the unsigned
+     *         type. There is no undefined behaviour. */
+    patomic_opsig_void_t fp_usub_sat;
+
     /** @brief Atomic addition using two's complement representation with
      *         implicit memory order, returning original value from before
      *         operation. There is no undefined behaviour. */
@@ -361,6 +723,50 @@ typedef struct {
      *         operation. There is no undefined behaviour. */
     patomic_opsig_fetch_noarg_t fp_fetch_neg;
 
+    /** @brief Atomic minimum of signed values using two's complement
+     *         representation with implicit memory order, returning original
+     *         value from before operation. There is no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_min;
+
+    /** @brief Atomic maximum of signed values using two's complement
+     *         representation with implicit memory order, returning original
+     *         value from before operation. There is no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_max;
+
+    /** @brief Atomic minimum of unsigned values with implicit memory order,
+     *         returning original value from before operation. There is no
+     *         undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_umin;
+
+    /** @brief Atomic maximum of unsigned values with implicit memory order,
+     *         returning original value from before operation. There is no
+     *         undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_umax;
+
+    /** @brief Atomic saturating addition of signed values using two's
+     *         complement representation with implicit memory order, clamping
+     *         the result to the range of the signed type, returning original
+     *         value from before operation. There is no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_add_sat;
+
+    /** @brief Atomic saturating subtraction of signed values using two's
+     *         complement representation with implicit memory order, clamping
+     *         the result to the range of the signed type, returning original
+     *         value from before operation. There is no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_sub_sat;
+
+    /** @brief Atomic saturating addition of unsigned values with implicit
+     *         memory order, clamping the result to the range of the unsigned
+     *         type, returning original value from before operation. There is
+     *         no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_uadd_sat;
+
+    /** @brief Atomic saturating subtraction of unsigned values with implicit
+     *         memory order, clamping the result to the range of the unsigned
+     *         type, returning original value from before operation. There is
+     *         no undefined behaviour. */
+    patomic_opsig_fetch_t fp_fetch_usub_sat;
+
 } patomic_ops_arithmetic_t;
 
 
@@ -453,9 +859,163 @@ typedef struct {
      *         will never spuriously fail. */
     patomic_opsig_cmpxchg_t fp_cmpxchg_strong;
 
+    /** @brief Atomic fetch_update with implicit memory order, running a user
+     *         provided callback inside a compare-exchange loop. */
+    patomic_opsig_fetch_update_t fp_fetch_update;
+
 } patomic_ops_xchg_t;
 
 
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Set of function pointers for atomic wait and notify operations with
+ *   implicit memory order. Pointers are NULL if operation is not supported.
+ *
+ * @details
+ *   A value must be modified before notifying waiting threads, otherwise they
+ *   may not observe the change and continue to block.
+ */
+typedef struct {
+
+    /** @brief Atomic wait with implicit memory order. */
+    patomic_opsig_wait_t fp_wait;
+
+    /** @brief Atomic wait with implicit memory order, which gives up after a
+     *         timeout. */
+    patomic_opsig_wait_timed_t fp_wait_timed;
+
+    /** @brief Unblocks at least one thread waiting on an object, if any are
+     *         waiting. More threads may be unblocked. */
+    patomic_opsig_notify_t fp_notify_one;
+
+    /** @brief Unblocks all threads waiting on an object. */
+    patomic_opsig_notify_t fp_notify_all;
+
+} patomic_ops_wait_t;
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Set of function pointers for batches of atomic operations with implicit
+ *   memory order. Pointers are NULL if operation is not supported.
+ *
+ * @details
+ *   Each operation performs the same work as calling the corresponding single
+ *   object operation once per element, but with a single indirect call for
+ *   the whole batch. Bulk loads and stores may additionally use vector
+ *   instructions where the architecture guarantees that each element is
+ *   accessed atomically.
+ */
+typedef struct {
+
+    /** @brief Batch of atomic additions using two's complement representation
+     *         with implicit memory order. */
+    patomic_opsig_void_n_t fp_add_n;
+
+    /** @brief Batch of atomic subtractions using two's complement
+     *         representation with implicit memory order. */
+    patomic_opsig_void_n_t fp_sub_n;
+
+    /** @brief Batch of atomic ORs with implicit memory order. */
+    patomic_opsig_void_n_t fp_or_n;
+
+    /** @brief Batch of atomic XORs with implicit memory order. */
+    patomic_opsig_void_n_t fp_xor_n;
+
+    /** @brief Batch of atomic ANDs with implicit memory order. */
+    patomic_opsig_void_n_t fp_and_n;
+
+    /** @brief Batch of atomic additions using two's complement representation
+     *         with implicit memory order, returning original values from
+     *         before operation. */
+    patomic_opsig_fetch_n_t fp_fetch_add_n;
+
+    /** @brief Batch of atomic subtractions using two's complement
+     *         representation with implicit memory order, returning original
+     *         values from before operation. */
+    patomic_opsig_fetch_n_t fp_fetch_sub_n;
+
+    /** @brief Batch of atomic ORs with implicit memory order, returning
+     *         original values from before operation. */
+    patomic_opsig_fetch_n_t fp_fetch_or_n;
+
+    /** @brief Batch of atomic XORs with implicit memory order, returning
+     *         original values from before operation. */
+    patomic_opsig_fetch_n_t fp_fetch_xor_n;
+
+    /** @brief Batch of atomic ANDs with implicit memory order, returning
+     *         original values from before operation. */
+    patomic_opsig_fetch_n_t fp_fetch_and_n;
+
+    /** @brief Batch of atomic exchanges with implicit memory order, returning
+     *         original values from before operation. */
+    patomic_opsig_fetch_n_t fp_exchange_n;
+
+    /** @brief Batch of atomic compare-exchanges with implicit memory order.
+     *         Operations will never spuriously fail. */
+    patomic_opsig_cmpxchg_n_t fp_cmpxchg_n;
+
+    /** @brief Bulk atomic store over a contiguous array of objects with
+     *         implicit memory order. */
+    patomic_opsig_store_array_t fp_store_array;
+
+    /** @brief Bulk atomic load over a contiguous array of objects with
+     *         implicit memory order. */
+    patomic_opsig_load_array_t fp_load_array;
+
+} patomic_ops_batch_t;
+
+
+/**
+ * @addtogroup ops.implicit
+ *
+ * @brief
+ *   Set of function pointers for atomic floating-point arithmetic operations
+ *   with implicit memory order. Pointers are NULL if operation is not
+ *   supported.
+ *
+ * @details
+ *   Objects are of type "float" if the width passed to patomic_create is equal
+ *   to sizeof(float), otherwise of type "double" if it is equal to
+ *   sizeof(double). No other widths support these operations.
+ *
+ * @details
+ *   The new value is computed as "cur + arg" or "cur - arg" with IEEE
+ *   arithmetic in the floating-point environment of the calling thread. A
+ *   NaN operand produces a NaN result. The sum of -0.0 and +0.0 is +0.0.
+ *
+ * @details
+ *   Where the compiler provides atomic floating-point addition and
+ *   subtraction (such as clang's __c11_atomic_fetch_add), operations use it
+ *   directly, which compiles to a single instruction on architectures that
+ *   have one. Otherwise, operations are implemented with a compare-exchange
+ *   loop which compares object representations, so an object holding a NaN
+ *   does not cause the loop to livelock, and -0.0 and +0.0 are treated as
+ *   distinct values. Which is used can be checked with patomic_describe.
+ */
+typedef struct {
+
+    /** @brief Atomic floating-point addition with implicit memory order. */
+    patomic_opsig_void_t fp_add;
+
+    /** @brief Atomic floating-point subtraction with implicit memory order. */
+    patomic_opsig_void_t fp_sub;
+
+    /** @brief Atomic floating-point addition with implicit memory order,
+     *         returning original value from before operation. */
+    patomic_opsig_fetch_t fp_fetch_add;
+
+    /** @brief Atomic floating-point subtraction with implicit memory order,
+     *         returning original value from before operation. */
+    patomic_opsig_fetch_t fp_fetch_sub;
+
+} patomic_ops_float_t;
+
+
 /**
  * @addtogroup ops.implicit
  *
@@ -485,6 +1045,18 @@ typedef struct {
      *         representation with implicit memory order. */
     patomic_ops_arithmetic_t arithmetic_ops;
 
+    /** @brief Set of atomic wait and notify operations with implicit memory
+     *         order. */
+    patomic_ops_wait_t wait_ops;
+
+    /** @brief Set of batched atomic read-modify-write operations with
+     *         implicit memory order. */
+    patomic_ops_batch_t batch_ops;
+
+    /** @brief Set of atomic floating-point arithmetic operations with
+     *         implicit memory order. */
+    patomic_ops_float_t float_ops;
+
 } patomic_ops_t;
 
 
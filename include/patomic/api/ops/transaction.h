@@ -4,6 +4,7 @@
 #ifndef PATOMIC_API_OPS_TRANSACTION_H
 #define PATOMIC_API_OPS_TRANSACTION_H
 
+#include "update.h"
 #include "../transaction.h"
 
 #include <stddef.h>
@@ -278,6 +279,57 @@ typedef int (* patomic_opsig_transaction_cmpxchg_t) (
 );
 
 
+/**
+ * @addtogroup ops.transaction
+ *
+ * @brief
+ *   Function signature for an atomic fetch_update operation implemented using
+ *   a sequentially consistent transaction.
+ *
+ * @details
+ *   Atomically replaces the value of bytes with a value computed by a user
+ *   provided callback from their current value, and returns the value the
+ *   bytes held previously, in a single read-modify-write atomic operation,
+ *   however the transaction may fail. If the callback declines to modify the
+ *   bytes, they are not modified.
+ *
+ * @param obj
+ *   Pointer to bytes whose value to atomically update.
+ *
+ * @param fn
+ *   Callback computing the desired value from the current value of "obj".
+ *
+ * @param ctx
+ *   Context pointer passed to each call of "fn".
+ *
+ * @param ret
+ *   Pointer to bytes into which to write the existing value held by "obj".
+ *
+ * @param config
+ *   Configuration for transaction.
+ *
+ * @param result
+ *   Pointer to object holding result of transaction, including the status and
+ *   attempts made.
+ *
+ * @returns
+ *   The value 1 if "obj" was modified, otherwise the value 0 if "fn" declined
+ *   to modify it or the transaction failed.
+ *
+ * @note
+ *   Parameters and config checks behave the same as for
+ *   patomic_opsig_transaction_exchange_t.
+ */
+typedef int (* patomic_opsig_transaction_fetch_update_t) (
+    volatile void *obj,
+    patomic_update_fn_t fn,
+    void *ctx,
+    void *ret,
+    patomic_transaction_config_t config,
+    patomic_transaction_result_t *result
+);
+
+
 /**
  * @addtogroup ops.transaction
  *
@@ -807,6 +859,166 @@ typedef int (* patomic_opsig_transaction_multi_cmpxchg_t) (
 );
 
 
+/**
+ * @addtogroup ops.transaction
+ *
+ * @brief
+ *   Function signature for an atomic multi load operation implemented using a
+ *   sequentially consistent read-only transaction.
+ *
+ * @details
+ *   Equivalent to performing N load operations in a single atomic
+ *   transaction, so that all N values form a consistent snapshot. No object
+ *   is written to, so the cache lines holding the objects are not taken
+ *   exclusively by the reading thread.
+ *
+ * @param lds_buf
+ *   Array of objects holding the memory locations to read and the buffers
+ *   into which to write their values.
+ *
+ * @param lds_len
+ *   The number of elements in the lds_buf array.
+ *
+ * @param config
+ *   Configuration for transaction.
+ *
+ * @param result
+ *   Pointer to object holding result of transaction, including the status and
+ *   attempts made.
+ *
+ * @note
+ *   The "ret" buffers are only guaranteed to hold a consistent snapshot if the
+ *   status is TSUCCESS. Otherwise their contents are unspecified.
+ *
+ * @note
+ *   If config.attempts == 0, the transaction will not be attempted. The status
+ *   will be set to { .code=TABORT_EXPLICIT, .info=TINFO_ZERO_ATTEMPTS,
+ *   .reason=0 }, and attempts_made to 0.
+ *   Parameters (except for "config" and "result") will not be accessed and may
+ *   be passed a default value of 0 or NULL.
+ *
+ * @note
+ *   If config.width == 0, the transaction will not be attempted. The status
+ *   will be set to TSUCCESS, and attempts_made to 1. Parameters (except for
+ *   "config" and "result") will not be accessed and may be passed a default
+ *   value of 0 or NULL.
+ *
+ * @note
+ *   The value of config.flag_nullable (when non-null) is read from at the
+ *   start of every transaction attempt. If its value is non-zero, the
+ *   transaction is aborted and not retried. The status will be set to
+ *   { .code=TABORT_EXPLICIT, .info=TINFO_FLAG_SET, .reason=0 }.
+ *
+ * @note
+ *   The check for config.attempts == 0 takes precedence over the check for
+ *   config.width == 0.
+ */
+typedef void (* patomic_opsig_transaction_multi_load_t) (
+    const patomic_transaction_load_t *lds_buf,
+    size_t lds_len,
+    patomic_transaction_config_t config,
+    patomic_transaction_result_t *result
+);
+
+
+/**
+ * @addtogroup ops.transaction
+ *
+ * @brief
+ *   Function signature for an atomic multi operation implemented using a
+ *   sequentially consistent transaction.
+ *
+ * @details
+ *   Equivalent to performing N heterogeneous store, exchange, cmpxchg,
+ *   arithmetic and bitwise operations in a single atomic transaction, where
+ *   the primary read-modify-write transaction only succeeds if all CMPXCHG
+ *   comparisons succeed. The primary transaction may fail, in which case the
+ *   fallback read-only (load) transaction is tried. If either transaction
+ *   path fails, 0 is returned.                                                 \n
+ *   Operations are applied in order, so a later operation on the same object
+ *   observes the result of an earlier one. All CMPXCHG comparisons are made
+ *   against the values of the objects before any operation is applied.
+ *
+ * @param ops_buf
+ *   Array of objects describing each operation to perform.
+ *
+ * @param ops_len
+ *   The number of elements in the ops_buf array.
+ *
+ * @param config
+ *   Configuration for transaction.
+ *
+ * @param result
+ *   Pointer to object holding result of transaction, including the status and
+ *   attempts made.
+ *
+ * @returns
+ *   The value 1 if all N operations were applied, otherwise the value 0. If
+ *   either transaction fails, 0 is returned.
+ *
+ * @note
+ *   If the primary transaction succeeds, the "ret" member of each element
+ *   (when non-null, and except for CMPXCHG) holds the value of its object
+ *   immediately before its operation was applied. If the fallback transaction
+ *   succeeds, the "ret" member of each element (when non-null, including for
+ *   CMPXCHG) holds a consistent snapshot of the current value of its object.
+ *
+ * @note
+ *   If config.attempts == 0, the primary transaction will not be attempted.
+ *   The status will be set to { .code=TABORT_EXPLICIT,
+ *   .info=TINFO_ZERO_ATTEMPTS, .reason=0 }, and attempts_made to 0.
+ *   The "arg" member of all elements of parameter "ops_buf" will not be
+ *   accessed and may be passed a default value of 0 or NULL. Execution will
+ *   pass to the fallback transaction.
+ *
+ * @note
+ *   If config.fallback_attempts == 0 and execution passes to the fallback
+ *   transaction, the fallback transaction will not be attempted. The
+ *   fallback_status will be set to { .code=TABORT_EXPLICIT,
+ *   .info=TINFO_ZERO_ATTEMPTS, .reason=0 }, and fallback_attempts_made to 0.
+ *   If config.attempts also == 0, then parameters (except for "config" and
+ *   "result") will not be accessed and may be passed a default value of 0 or
+ *   NULL.
+ *
+ * @note
+ *   If config.width == 0, the primary or fallback transaction (whichever is
+ *   about to be executed when the check takes place) will not be attempted.
+ *   The status or fallback_status will be set to TSUCCESS, attempts_made or
+ *   fallback_attempts_made will be set to 1. Parameters will not be accessed
+ *   in the same manner as with zero attempts or fallback_attempts.
+ *
+ * @note
+ *   The value of config.flag_nullable (when non-null) is read from at the
+ *   start of every primary transaction attempt. If its value is non-zero, the
+ *   transaction is aborted and execution passes to the fallback transaction.
+ *   The status will be set to { .code=TABORT_EXPLICIT, .info=TINFO_FLAG_SET,
+ *   .reason=0 }.
+ *
+ * @note
+ *   The value of config.fallback_flag_nullable (when non-null) is read from at
+ *   the start of every fallback transaction attempt. If its value is non-zero,
+ *   the transaction is aborted and not retried. The fallback_status will be
+ *   set to { .code=TABORT_EXPLICIT, .info=TINFO_FLAG_SET, .reason=0 }.
+ *
+ * @note
+ *   The check for config.width == 0 only takes place after either
+ *   config.attempts > 0 or config.fallback_attempts > 0, and the check for
+ *   the value of config.fallback_attempts only takes place if the primary
+ *   transaction has failed.
+ *
+ * @note
+ *   If the primary transaction succeeds, then execution will not pass to
+ *   the fallback transaction, and the value of fallback_status and
+ *   fallback_attempts_made is unspecified.
+ */
+typedef int (* patomic_opsig_transaction_multi_op_t) (
+    const patomic_transaction_op_t *ops_buf,
+    size_t ops_len,
+    patomic_transaction_config_wfb_t config,
+    patomic_transaction_result_wfb_t *result
+);
+
+
 /**
  * @addtogroup ops.transaction
  *
@@ -1040,6 +1252,13 @@ typedef void (* patomic_opsig_transaction_flag_clear_t) (
  *   More information can be obtained from the status using the
  *   patomic_transaction_status_* functions or the
  *   PATOMIC_TRANSACTION_STATUS_* macros.
+ *
+ * @warning
+ *   If transactions are emulated with a lock (see
+ *   patomic_option_TRANSACTION_LOCK), memory accessed between tbegin and
+ *   tcommit is accessed non-atomically. It must not be accessed concurrently
+ *   by any operation outside of a transaction, including atomic operations
+ *   from patomic_ops_t, otherwise the behaviour is undefined.
  */
 typedef unsigned long (* patomic_opsig_transaction_tbegin_t) (
     void
@@ -1167,6 +1386,50 @@ typedef struct {
      *         undefined behaviour. */
     patomic_opsig_transaction_void_noarg_t fp_neg;
 
+    /** @brief Atomic minimum of signed values using two's complement
+     *         representation implemented using a sequentially consistent
+     *         transaction. There is no undefined behaviour. */
+    patomic_opsig_transaction_void_t fp_min;
+
+    /** @brief Atomic maximum of signed values using two's complement
+     *         representation implemented using a sequentially consistent
+     *         transaction. There is no undefined behaviour. */
+    patomic_opsig_transaction_void_t fp_max;
+
+    /** @brief Atomic minimum of unsigned values implemented using a
+     *         sequentially consistent transaction. There is no undefined
+     *         behaviour. */
+    patomic_opsig_transaction_void_t fp_umin;
+
+    /** @brief Atomic maximum of unsigned values implemented using a
+     *         sequentially consistent transaction. There is no undefined
+     *         behaviour. */
+    patomic_opsig_transaction_void_t fp_umax;
+
+    /** @brief Atomic saturating addition of signed values using two's
+     *         complement representation implemented using a sequentially
+     *         consistent transaction, clamping the result to the range of the
+     *         signed type. There is no undefined behaviour. */
+    patomic_opsig_transaction_void_t fp_add_sat;
+
+    /** @brief Atomic saturating subtraction of signed values using two's
+     *         complement representation implemented using a sequentially
+     *         consistent transaction, clamping the result to the range of the
+     *         signed type. There is no undefined behaviour. */
+    patomic_opsig_transaction_void_t fp_sub_sat;
+
+    /** @brief Atomic saturating addition of unsigned values implemented using
+     *         a sequentially consistent transaction, clamping the result to
+     *         the range of the unsigned type. There is no undefined
+     *         behaviour. */
+    patomic_opsig_transaction_void_t fp_uadd_sat;
+
+    /** @brief Atomic saturating subtraction of unsigned values implemented
+     *         using a sequentially consistent transaction, clamping the result
+     *         to the range of the unsigned type. There is no undefined
+     *         behaviour. */
+    patomic_opsig_transaction_void_t fp_usub_sat;
+
     /** @brief Atomic addition using two's complement representation implemented
      *         using a sequentially consistent transaction, returning original
      *         value from before operation. There is no undefined behaviour. */
@@ -1195,6 +1458,54 @@ typedef struct {
      *         value from before operation. There is no undefined behaviour. */
     patomic_opsig_transaction_fetch_noarg_t fp_fetch_neg;
 
+    /** @brief Atomic minimum of signed values using two's complement
+     *         representation implemented using a sequentially consistent
+     *         transaction, returning original value from before operation.
+     *         There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_min;
+
+    /** @brief Atomic maximum of signed values using two's complement
+     *         representation implemented using a sequentially consistent
+     *         transaction, returning original value from before operation.
+     *         There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_max;
+
+    /** @brief Atomic minimum of unsigned values implemented using a
+     *         sequentially consistent transaction, returning original value
+     *         from before operation. There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_umin;
+
+    /** @brief Atomic maximum of unsigned values implemented using a
+     *         sequentially consistent transaction, returning original value
+     *         from before operation. There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_umax;
+
+    /** @brief Atomic saturating addition of signed values using two's
+     *         complement representation implemented using a sequentially
+     *         consistent transaction, clamping the result to the range of the
+     *         signed type, returning original value from before operation.
+     *         There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_add_sat;
+
+    /** @brief Atomic saturating subtraction of signed values using two's
+     *         complement representation implemented using a sequentially
+     *         consistent transaction, clamping the result to the range of the
+     *         signed type, returning original value from before operation.
+     *         There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_sub_sat;
+
+    /** @brief Atomic saturating addition of unsigned values implemented using
+     *         a sequentially consistent transaction, clamping the result to
+     *         the range of the unsigned type, returning original value from
+     *         before operation. There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_uadd_sat;
+
+    /** @brief Atomic saturating subtraction of unsigned values implemented
+     *         using a sequentially consistent transaction, clamping the result
+     *         to the range of the unsigned type, returning original value from
+     *         before operation. There is no undefined behaviour. */
+    patomic_opsig_transaction_fetch_t fp_fetch_usub_sat;
+
 } patomic_ops_transaction_arithmetic_t;
 
 
@@ -1302,6 +1613,14 @@ typedef struct {
      *        fail. It is kept for consistency with implicit/explicit ops. */
     patomic_opsig_transaction_cmpxchg_t fp_cmpxchg_strong;
 
+    /** @brief Atomic fetch_update implemented using a sequentially consistent
+     *         transaction.
+     *
+     *  @note This will always be NULL as an arbitrary callback cannot safely
+     *        be run inside a transaction. It is kept for consistency with
+     *        implicit/explicit ops. */
+    patomic_opsig_transaction_fetch_update_t fp_fetch_update;
+
 } patomic_ops_transaction_xchg_t;
 
 
@@ -1331,6 +1650,14 @@ typedef struct {
      *         a sequentially consistent transaction. */
     patomic_opsig_transaction_generic_wfb_t fp_generic_wfb;
 
+    /** @brief Atomic multi load implemented using a sequentially consistent
+     *         read-only transaction. */
+    patomic_opsig_transaction_multi_load_t fp_multi_load;
+
+    /** @brief Atomic multi operation implemented using a sequentially
+     *         consistent transaction. */
+    patomic_opsig_transaction_multi_op_t fp_multi_op;
+
 } patomic_ops_transaction_special_t;
 
 
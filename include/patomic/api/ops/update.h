@@ -0,0 +1,63 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_OPS_UPDATE_H
+#define PATOMIC_API_OPS_UPDATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup ops.update
+ *
+ * @brief
+ *   Function signature for a user provided callback which computes the new
+ *   value of an object in an atomic fetch_update operation.
+ *
+ * @details
+ *   Computes a desired value from the current value of an object. The
+ *   callback may decline to modify the object, in which case the fetch_update
+ *   operation completes without modifying the object.
+ *
+ * @param current
+ *   Pointer to a copy of the current value of the object.
+ *
+ * @param desired
+ *   Pointer to object into which to write the value which will replace the
+ *   current value of the object.
+ *
+ * @param ctx
+ *   User provided context pointer, passed through unmodified by the
+ *   fetch_update operation.
+ *
+ * @returns
+ *   A non-zero value if the object should be replaced with the value of
+ *   "desired", otherwise the value 0.
+ *
+ * @note
+ *   The callback may be called multiple times in a single fetch_update
+ *   operation if the object is concurrently modified, so it should not have
+ *   side effects other than writing to "desired".
+ *
+ * @note
+ *   The callback must not call any atomic operation on the same object, and
+ *   should be cheap since the object may be modified while it runs.
+ *
+ * @note
+ *   Width of "current" and "desired" is the same as the object, and is known
+ *   implicitly.
+ */
+typedef int (* patomic_update_fn_t) (
+    const void *current,
+    void *desired,
+    void *ctx
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_OPS_UPDATE_H */
@@ -32,7 +32,8 @@ extern "C" {
  *
  * @note
  *   Options are merely hints to an implementation; they may be completely
- *   ignored.
+ *   ignored. The only exception is patomic_option_PROCESS_SHARED, which is
+ *   always respected.
  *
  * @note
  *   Each "option" label has a single bit set (except for NONE which has no
@@ -43,6 +44,38 @@ typedef enum {
     /** @brief The empty option hinting nothing */
     patomic_option_NONE = 0x0
 
+    /** @brief Hint that operations should count how often they are called,
+     *         readable with patomic_profile_snapshot.
+     *  @note  This adds a small overhead to each operation, and is ignored if
+     *         patomic_profile_is_supported returns 0.
+     *  @note  Only a limited number of distinct sets of operations can be
+     *         profiled (PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE and
+     *         PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT_ABI_UNSTABLE), after
+     *         which this option is ignored. Use the is_profiled member from
+     *         patomic_describe to check whether operations are profiled. */
+    ,patomic_option_PROFILE = 0x1
+
+    /** @brief Hint that transaction operations should be emulated with a
+     *         global reentrant lock if they are not otherwise supported.
+     *  @note  Emulated transactions never abort, so operations run exactly
+     *         once, but they are serialized rather than concurrent.
+     *  @warning Emulated transactions are only isolated from each other, not
+     *           from non-transactional operations. Objects accessed inside an
+     *           emulated transaction must not be concurrently accessed by any
+     *           operation outside of a transaction, including atomic
+     *           operations from patomic_ops_t, otherwise the behaviour is
+     *           undefined. */
+    ,patomic_option_TRANSACTION_LOCK = 0x2
+
+    /** @brief Require that every operation is address-free, so that it can be
+     *         used on objects in memory shared between processes, such as a
+     *         MAP_SHARED mapping.
+     *  @note  Operations and implementations which rely on process-local
+     *         state (such as wait operations or emulated transactions) are not
+     *         provided when this is set, so fewer operations may be
+     *         supported. */
+    ,patomic_option_PROCESS_SHARED = 0x4
+
 } patomic_option_t;
 
 
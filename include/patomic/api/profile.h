@@ -0,0 +1,385 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_PROFILE_H
+#define PATOMIC_API_PROFILE_H
+
+#include <patomic/api/export.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Enum constants identifying each operation slot in the implicit and
+ *   explicit operation tables for which profiling counters are maintained.
+ *
+ * @details
+ *   Counters for an operation obtained from patomic_create and from
+ *   patomic_create_explicit are aggregated into the same slot.
+ *
+ * @note
+ *   Slot values are contiguous starting from zero, and are always less than
+ *   PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE. New slots may be added in the
+ *   future, increasing that count.
+ */
+typedef enum {
+
+    /* ldst */
+    patomic_profile_slot_STORE
+    ,patomic_profile_slot_LOAD
+
+    /* xchg */
+    ,patomic_profile_slot_EXCHANGE
+    ,patomic_profile_slot_CMPXCHG_WEAK
+    ,patomic_profile_slot_CMPXCHG_STRONG
+    ,patomic_profile_slot_FETCH_UPDATE
+
+    /* bitwise */
+    ,patomic_profile_slot_TEST
+    ,patomic_profile_slot_TEST_COMPL
+    ,patomic_profile_slot_TEST_SET
+    ,patomic_profile_slot_TEST_RESET
+
+    /* binary - void */
+    ,patomic_profile_slot_OR
+    ,patomic_profile_slot_XOR
+    ,patomic_profile_slot_AND
+    ,patomic_profile_slot_NOT
+
+    /* binary - fetch */
+    ,patomic_profile_slot_FETCH_OR
+    ,patomic_profile_slot_FETCH_XOR
+    ,patomic_profile_slot_FETCH_AND
+    ,patomic_profile_slot_FETCH_NOT
+
+    /* arithmetic - void */
+    ,patomic_profile_slot_ADD
+    ,patomic_profile_slot_SUB
+    ,patomic_profile_slot_INC
+    ,patomic_profile_slot_DEC
+    ,patomic_profile_slot_NEG
+    ,patomic_profile_slot_MIN
+    ,patomic_profile_slot_MAX
+    ,patomic_profile_slot_UMIN
+    ,patomic_profile_slot_UMAX
+    ,patomic_profile_slot_ADD_SAT
+    ,patomic_profile_slot_SUB_SAT
+    ,patomic_profile_slot_UADD_SAT
+    ,patomic_profile_slot_USUB_SAT
+
+    /* arithmetic - fetch */
+    ,patomic_profile_slot_FETCH_ADD
+    ,patomic_profile_slot_FETCH_SUB
+    ,patomic_profile_slot_FETCH_INC
+    ,patomic_profile_slot_FETCH_DEC
+    ,patomic_profile_slot_FETCH_NEG
+    ,patomic_profile_slot_FETCH_MIN
+    ,patomic_profile_slot_FETCH_MAX
+    ,patomic_profile_slot_FETCH_UMIN
+    ,patomic_profile_slot_FETCH_UMAX
+    ,patomic_profile_slot_FETCH_ADD_SAT
+    ,patomic_profile_slot_FETCH_SUB_SAT
+    ,patomic_profile_slot_FETCH_UADD_SAT
+    ,patomic_profile_slot_FETCH_USUB_SAT
+
+    /* float - void */
+    ,patomic_profile_slot_FADD
+    ,patomic_profile_slot_FSUB
+
+    /* float - fetch */
+    ,patomic_profile_slot_FETCH_FADD
+    ,patomic_profile_slot_FETCH_FSUB
+
+} patomic_profile_slot_t;
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   The number of patomic_profile_slot_t values.
+ *
+ * @warning
+ *   This value increases whenever a slot is added, without a major version
+ *   bump. Types whose layout depends on it are marked as ABI unstable.
+ */
+#undef PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE
+#define PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE 48
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   The maximum number of distinct sets of implicit operations which can be
+ *   profiled over the lifetime of the process.
+ *
+ * @details
+ *   Each distinct set of operations returned by patomic_create (which depends
+ *   on the width, memory order, and implementations) uses up one instance the
+ *   first time it is profiled, and instances are never released. Once every
+ *   instance is in use, the patomic_option_PROFILE option is ignored for any
+ *   new set of operations. Whether an operation is profiled can be checked
+ *   with the is_profiled member of the result of patomic_describe.
+ *
+ * @warning
+ *   This value may change without a major version bump.
+ */
+#undef PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE
+#define PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE 32
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   The maximum number of distinct sets of explicit operations which can be
+ *   profiled over the lifetime of the process.
+ *
+ * @details
+ *   Behaves the same as PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE, but for
+ *   operations returned by patomic_create_explicit, which can be checked with
+ *   patomic_describe_explicit.
+ *
+ * @warning
+ *   This value may change without a major version bump.
+ */
+#undef PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT_ABI_UNSTABLE
+#define PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT_ABI_UNSTABLE 8
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Aggregated profiling counters for a single operation slot.
+ *
+ * @note
+ *   Counters are unsigned and wrap around on overflow. To measure activity
+ *   over an interval, take the difference between two snapshots.
+ */
+typedef struct {
+
+    /** @brief Number of calls made through profiled operations. */
+    unsigned long calls;
+
+    /** @brief Number of calls which reported failure. This is only non-zero
+     *         for compare-exchange slots, where it is the number of calls
+     *         which returned zero. */
+    unsigned long failures;
+
+} patomic_profile_counters_t;
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Checks whether the patomic_option_PROFILE option is honoured by this build
+ *   of the library.
+ *
+ * @details
+ *   Profiling requires C11 atomics to be available when building this
+ *   library. If it is not supported, the option is silently ignored and all
+ *   counters remain zero.
+ *
+ * @returns
+ *   Returns 1 if profiling is supported, otherwise 0.
+ */
+PATOMIC_EXPORT int
+patomic_profile_is_supported(void);
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Reads the counters for an operation slot, summed over all threads.
+ *
+ * @details
+ *   Only calls made through operations obtained by passing the
+ *   patomic_option_PROFILE option to patomic_create or patomic_create_explicit
+ *   are counted, and only if a profiling instance was available for them (see
+ *   PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE).
+ *
+ * @warning
+ *   Counters are read individually with relaxed ordering, so the snapshot is
+ *   not a consistent view if operations are being made concurrently.
+ *
+ * @returns
+ *   The aggregated counters for the slot, or zero counters if the slot is not
+ *   a valid patomic_profile_slot_t value.
+ */
+PATOMIC_EXPORT patomic_profile_counters_t
+patomic_profile_snapshot(
+    patomic_profile_slot_t slot
+);
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   A single entry in a report of the most contended sampled addresses.
+ *
+ * @warning
+ *   The layout of this type depends on PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE,
+ *   and may change without a major version bump.
+ */
+typedef struct {
+
+    /** @brief Address of the atomic object passed to the operations. */
+    const volatile void *address;
+
+    /** @brief Number of retained samples with this address for each
+     *         operation slot, indexed by patomic_profile_slot_t value. */
+    unsigned long slot_samples[PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE];
+
+    /** @brief Number of retained samples with this address. */
+    unsigned long samples;
+
+    /** @brief Number of retained samples with this address which reported
+     *         failure. */
+    unsigned long failures;
+
+} patomic_profile_hot_address_abi_unstable_t;
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Sets how often calls through profiled operations record the address of
+ *   the object they operate on.
+ *
+ * @details
+ *   Each thread records one in every 'interval' of its profiled calls into a
+ *   fixed size buffer, overwriting its oldest samples once full. An interval
+ *   of zero disables sampling, which is the default.
+ *
+ * @note
+ *   Has no effect if profiling is not supported.
+ */
+PATOMIC_EXPORT void
+patomic_profile_set_sample_interval(
+    unsigned int interval
+);
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Aggregates retained samples by address, and writes out the most contended
+ *   addresses in descending order.
+ *
+ * @details
+ *   Addresses are ordered by number of failures, then by number of samples.
+ *   At most 'count' entries are written to 'report'.
+ *
+ * @warning
+ *   Samples are read individually with relaxed ordering, so the report is not
+ *   a consistent view if operations are being sampled concurrently.
+ *
+ * @returns
+ *   The number of entries written to 'report'.
+ */
+PATOMIC_EXPORT size_t
+patomic_profile_hot_addresses(
+    patomic_profile_hot_address_abi_unstable_t *report,
+    size_t count
+);
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   The number of buckets in a patomic_profile_histogram_t.
+ *
+ * @note
+ *   Changing this value is an ABI break, and requires a major version bump.
+ */
+#undef PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT
+#define PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT 16
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Histogram of how many iterations of a cmpxchg loop calls to an operation
+ *   took before succeeding, using log2 sized buckets.
+ *
+ * @details
+ *   The bucket at index i counts calls which took between 2^i and 2^(i+1) - 1
+ *   iterations (inclusive). The final bucket also counts all calls which took
+ *   more iterations than that. Calls in the first bucket succeeded on their
+ *   first attempt.
+ */
+typedef struct {
+
+    /** @brief Number of calls falling into each bucket. */
+    unsigned long buckets[PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT];
+
+} patomic_profile_histogram_t;
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Checks whether this build of the library records cmpxchg loop iteration
+ *   counts.
+ *
+ * @details
+ *   Recording is enabled at compile time when building this library, and
+ *   requires C11 atomics to be available.
+ *
+ * @returns
+ *   Returns 1 if iteration counts are recorded, otherwise 0.
+ */
+PATOMIC_EXPORT int
+patomic_profile_histogram_is_enabled(void);
+
+
+/**
+ * @addtogroup profile
+ *
+ * @brief
+ *   Reads the histogram of cmpxchg loop iteration counts for an operation
+ *   slot and width, summed over all threads.
+ *
+ * @details
+ *   Only operations which an implementation emulates using a cmpxchg loop are
+ *   recorded, regardless of which options were used to obtain them. Natively
+ *   supported operations never contribute to any histogram.
+ *
+ * @warning
+ *   Buckets are read individually with relaxed ordering, so the histogram is
+ *   not a consistent view if operations are being made concurrently.
+ *
+ * @returns
+ *   The aggregated histogram, or a histogram with all buckets zero if
+ *   recording is not enabled, the slot is not valid, or the width is not a
+ *   power of 2 no larger than 16.
+ */
+PATOMIC_EXPORT patomic_profile_histogram_t
+patomic_profile_cmpxchg_histogram(
+    patomic_profile_slot_t slot,
+    size_t byte_width
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_PROFILE_H */
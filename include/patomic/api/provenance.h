@@ -0,0 +1,141 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_API_PROVENANCE_H
+#define PATOMIC_API_PROVENANCE_H
+
+#include "core.h"
+#include "feature_check.h"
+#include "ids.h"
+
+#include <patomic/api/export.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @addtogroup provenance
+ *
+ * @brief
+ *   Enum constants describing how an implementation provides an operation.
+ */
+typedef enum {
+
+    /** @brief The implementation does not report how the operation is
+     *         provided, or the operation is not supported. */
+    patomic_method_UNKN = 0
+
+    /** @brief The operation maps directly onto an equivalent primitive. */
+    ,patomic_method_DIRECT
+
+    /** @brief The operation is emulated with a compare-exchange loop, and may
+     *         retry under contention. */
+    ,patomic_method_CMPXCHG_LOOP
+
+} patomic_method_t;
+
+
+/**
+ * @addtogroup provenance
+ *
+ * @brief
+ *   Describes where a single operation in a set of combined operations came
+ *   from.
+ *
+ * @details
+ *   If the operation is not supported, or could not be traced back to an
+ *   implementation, the id is patomic_id_NULL, the kind is patomic_kind_UNKN,
+ *   the method is patomic_method_UNKN, and the byte width is zero.
+ */
+typedef struct {
+
+    /** @brief Id of the implementation which supplied the operation. */
+    patomic_id_t id;
+
+    /** @brief Kind of the implementation which supplied the operation. */
+    patomic_kind_t kind;
+
+    /** @brief How the implementation provides the operation. */
+    patomic_method_t method;
+
+    /** @brief Byte width the implementation created the operation for. */
+    size_t byte_width;
+
+    /** @brief Non-zero if the operation is wrapped by profiling, in which case
+     *         all other members describe the operation being wrapped. */
+    int is_profiled;
+
+} patomic_provenance_t;
+
+
+/**
+ * @addtogroup provenance
+ *
+ * @brief
+ *   Obtains the provenance of a single operation from a set of operations
+ *   with implicit memory order.
+ *
+ * @details
+ *   The implementation is found by re-creating operations from each
+ *   implementation for each power of 2 byte width up to 64 and each memory
+ *   order, and looking for the one with the same function. This is not cheap, and is intended for
+ *   diagnostics rather than for use on a hot path.
+ *
+ * @param obj
+ *   Non-null pointer to operations obtained from patomic_create.
+ *
+ * @param opcat
+ *   Any single patomic_opcat_t value with a single bit set.
+ *
+ * @param opkind
+ *   Any single patomic_opkind_t value with a single bit set, which is valid
+ *   for the given opcat.
+ */
+PATOMIC_EXPORT patomic_provenance_t
+patomic_describe(
+    const patomic_t *obj,
+    patomic_opcat_t opcat,
+    patomic_opkind_t opkind
+);
+
+
+/**
+ * @addtogroup provenance
+ *
+ * @brief
+ *   Obtains the provenance of a single operation from a set of operations
+ *   with explicit memory order.
+ *
+ * @details
+ *   The implementation is found by re-creating operations from each
+ *   implementation for each power of 2 byte width up to 64, and looking for
+ *   the one with the same function. This is not cheap, and is intended for diagnostics
+ *   rather than for use on a hot path.
+ *
+ * @param obj
+ *   Non-null pointer to operations obtained from patomic_create_explicit.
+ *
+ * @param opcat
+ *   Any single patomic_opcat_t value with a single bit set.
+ *
+ * @param opkind
+ *   Any single patomic_opkind_t value with a single bit set, which is valid
+ *   for the given opcat.
+ */
+PATOMIC_EXPORT patomic_provenance_t
+patomic_describe_explicit(
+    const patomic_explicit_t *obj,
+    patomic_opcat_t opcat,
+    patomic_opkind_t opkind
+);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* PATOMIC_API_PROVENANCE_H */
@@ -79,6 +79,138 @@ typedef struct {
 } patomic_transaction_cmpxchg_t;
 
 
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Used in the multi variant of load to pass multiple memory locations.
+ *
+ * @note
+ *   The byte width of all objects at all the memory locations is obtained
+ *   from an object of type patomic_transaction_config_t which is provided
+ *   separately.
+ */
+typedef struct {
+
+    /** @brief Object to read in transaction. */
+    const volatile void *obj;
+
+    /** @brief Buffer into which the value of obj is written if the
+     *         transaction succeeds. */
+    void *ret;
+
+} patomic_transaction_load_t;
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Enum constants specifying which operation an element passed to the multi
+ *   variant of op performs.
+ */
+typedef enum {
+
+    /** @brief Writes the value of arg to obj. */
+    patomic_transaction_op_STORE = 0x0,
+
+    /** @brief Writes the value of arg to obj. Identical to STORE, provided so
+     *         that intent is clear when the old value is read into ret. */
+    patomic_transaction_op_EXCHANGE = 0x1,
+
+    /** @brief Writes the value of arg to obj if obj compares equal to the
+     *         value of ret. */
+    patomic_transaction_op_CMPXCHG = 0x2,
+
+    /** @brief Adds the value of arg to obj. */
+    patomic_transaction_op_ADD = 0x3,
+
+    /** @brief Subtracts the value of arg from obj. */
+    patomic_transaction_op_SUB = 0x4,
+
+    /** @brief Bitwise ANDs the value of arg into obj. */
+    patomic_transaction_op_AND = 0x5,
+
+    /** @brief Bitwise ORs the value of arg into obj. */
+    patomic_transaction_op_OR = 0x6,
+
+    /** @brief Bitwise XORs the value of arg into obj. */
+    patomic_transaction_op_XOR = 0x7
+
+} patomic_transaction_op_kind_t;
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Used in the multi variant of op to pass multiple operations on multiple
+ *   memory locations.
+ *
+ * @note
+ *   The byte width of all objects at all the memory locations is obtained
+ *   from an object of type patomic_transaction_config_wfb_t which is provided
+ *   separately.
+ */
+typedef struct {
+
+    /** @brief Operation to perform, one of patomic_transaction_op_kind_t. */
+    int kind;
+
+    /** @brief Object on which to perform operation. */
+    volatile void *obj;
+
+    /** @brief Operand of operation, or the desired value for CMPXCHG. */
+    const void *arg;
+
+    /** @brief Buffer into which the original value of obj is written. For
+     *         CMPXCHG it holds the expected value, and must not be NULL.
+     *         Otherwise it may be NULL if the original value is not needed. */
+    void *ret;
+
+} patomic_transaction_op_t;
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Policy consulted by transaction operations to decide whether to retry
+ *   after an abort, and how many attempts to make, based on recent results.
+ *
+ * @details
+ *   After each aborted attempt on the primary path, the exit code and exit
+ *   info of the status decide whether another attempt is likely to succeed.
+ *   Aborts caused by capacity or debug traps go straight to the fallback
+ *   unless the implementation hints that a retry may succeed, and conflict
+ *   aborts are retried after backing off.                                      \n
+ *   The number of attempts made by each call is additionally limited to an
+ *   adaptive budget, which grows by one each time the primary path succeeds
+ *   and halves each time it fails for a reason other than an explicit abort.
+ *
+ * @note
+ *   A policy is intended to be shared by all calls from the same call site,
+ *   including from multiple threads. It must be initialized with
+ *   patomic_transaction_policy_init, and its members must not be modified
+ *   while it is in use.
+ */
+typedef struct {
+
+    /** @brief Upper bound on the adaptive budget of attempts. */
+    unsigned long max_attempts;
+
+    /** @brief Number of spin iterations to wait before retrying after a
+     *         conflict abort, doubled for each consecutive attempt. Zero
+     *         disables backoff. */
+    unsigned long backoff_spins;
+
+    /** @brief Current adaptive budget of attempts, updated by transaction
+     *         operations. */
+    unsigned long adaptive_attempts;
+
+} patomic_transaction_policy_t;
+
+
 /**
  * @addtogroup transaction
  *
@@ -88,7 +220,7 @@ typedef struct {
  *   by patomic_transaction_cmpxchg_t objects.
  *
  * @details
- *   The flag may be NULL.
+ *   The flag and the policy may be NULL.
  */
 typedef struct {
 
@@ -102,6 +234,11 @@ typedef struct {
      *         aborted if the value is non-zero. */
     const patomic_transaction_flag_t *flag_nullable;
 
+    /** @brief Consulted after each aborted transaction attempt to decide
+     *         whether to retry, and limits the number of attempts made. If
+     *         NULL, all attempts are made. */
+    patomic_transaction_policy_t *policy_nullable;
+
 } patomic_transaction_config_t;
 
 
@@ -115,6 +252,7 @@ typedef struct {
  *
  * @details
  *   The flag and fallback_flag may point to the same flag, or may be NULL.     \n
+ *   The policy may be NULL.                                                    \n
  *   The flag tends to guard a read-write code path, and the fallback flag tends
  *   to guard a read-only code path.                                            \n
  *   With this in mind, it is recommended to use flag as a unique writer lock
@@ -139,6 +277,12 @@ typedef struct {
      *         which is aborted if the value is non-zero. */
     const patomic_transaction_flag_t *fallback_flag_nullable;
 
+    /** @brief Consulted after each aborted transaction attempt to decide
+     *         whether to retry, and limits the number of attempts made. If
+     *         NULL, all attempts are made. Fallback attempts are not affected
+     *         by the policy. */
+    patomic_transaction_policy_t *policy_nullable;
+
 } patomic_transaction_config_wfb_t;
 
 
@@ -356,6 +500,185 @@ PATOMIC_EXPORT unsigned char
 patomic_transaction_status_abort_reason(unsigned long status);
 
 
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Aggregated outcomes of transaction operations, decoded from the status of
+ *   each path of each call.
+ *
+ * @details
+ *   Each call records the status of its primary path. Calls to operations
+ *   with a fallback path whose primary path did not succeed additionally
+ *   record the status of their fallback path.                                 \n
+ *   Only the status from the final attempt on each path is recorded.
+ *
+ * @note
+ *   Counters are unsigned and wrap around on overflow. To measure activity
+ *   over an interval, take the difference between two snapshots.
+ */
+typedef struct {
+
+    /** @brief Number of primary paths recorded. */
+    unsigned long calls;
+
+    /** @brief Total attempts made on primary paths. */
+    unsigned long attempts_made;
+
+    /** @brief Number of fallback paths recorded. */
+    unsigned long fallback_calls;
+
+    /** @brief Total attempts made on fallback paths. */
+    unsigned long fallback_attempts_made;
+
+    /** @brief Number of recorded statuses with each exit code, indexed by the
+     *         patomic_transaction_exit_code_t value. */
+    unsigned long exit_codes[256];
+
+    /** @brief Number of recorded statuses with each exit info bit set, where
+     *         index i counts the patomic_transaction_exit_info_t value
+     *         (1 << i). */
+    unsigned long exit_info[8];
+
+    /** @brief Number of recorded explicit aborts with each abort reason,
+     *         indexed by the abort reason. */
+    unsigned long abort_reasons[256];
+
+} patomic_transaction_stats_t;
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Reads the aggregated outcomes of all transaction operations provided by
+ *   this library, summed over all threads.
+ *
+ * @details
+ *   Outcomes are recorded without locking by each thread into its own set of
+ *   accumulators. If atomics are not available when building this library,
+ *   nothing is recorded and all counters remain zero.
+ *
+ * @warning
+ *   Counters are read individually with relaxed ordering, so the snapshot is
+ *   not a consistent view if transactions are being made concurrently.
+ *
+ * @param stats
+ *   Non-null pointer to the object to write the aggregated outcomes to.
+ */
+PATOMIC_EXPORT void
+patomic_transaction_stats_snapshot(
+    patomic_transaction_stats_t *stats
+);
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Initializes a transaction policy.
+ *
+ * @param policy
+ *   Non-null pointer to the policy to initialize.
+ *
+ * @param max_attempts
+ *   Upper bound on the adaptive budget of attempts, which starts at this
+ *   value. If zero, it is treated as one.
+ *
+ * @param backoff_spins
+ *   Number of spin iterations to wait before retrying after the first
+ *   conflict abort. Zero disables backoff.
+ */
+PATOMIC_EXPORT void
+patomic_transaction_policy_init(
+    patomic_transaction_policy_t *policy,
+    unsigned long max_attempts,
+    unsigned long backoff_spins
+);
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Obtains the number of attempts a call should make, limited by the
+ *   adaptive budget of the policy.
+ *
+ * @param policy
+ *   Pointer to the policy to consult. May be NULL.
+ *
+ * @param attempts
+ *   Number of attempts requested by the caller.
+ *
+ * @returns
+ *   The smaller of "attempts" and the adaptive budget, or "attempts" if the
+ *   policy is NULL.
+ */
+PATOMIC_EXPORT unsigned long
+patomic_transaction_policy_attempts(
+    const patomic_transaction_policy_t *policy,
+    unsigned long attempts
+);
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Decides whether to retry after an aborted transaction attempt, and backs
+ *   off before returning if the attempt aborted due to a conflict.
+ *
+ * @param policy
+ *   Pointer to the policy to consult. May be NULL.
+ *
+ * @param status
+ *   The non-zero status of the aborted attempt.
+ *
+ * @param attempts_made
+ *   The number of attempts made so far, including the aborted attempt.
+ *
+ * @returns
+ *   A non-zero value if another attempt should be made, otherwise the value
+ *   0. Always returns non-zero if the policy is NULL.
+ */
+PATOMIC_EXPORT int
+patomic_transaction_policy_retry(
+    const patomic_transaction_policy_t *policy,
+    unsigned long status,
+    unsigned long attempts_made
+);
+
+
+/**
+ * @addtogroup transaction
+ *
+ * @brief
+ *   Updates the adaptive budget of the policy with the final status of a
+ *   call's primary path.
+ *
+ * @details
+ *   The budget grows by one on success, up to max_attempts, and halves on
+ *   failure, down to one. Explicit aborts, including those caused by a set
+ *   flag or zero attempts, leave the budget unchanged.
+ *
+ * @param policy
+ *   Pointer to the policy to update. May be NULL, in which case this function
+ *   has no effect.
+ *
+ * @param status
+ *   The status from the final attempt on the primary path.
+ *
+ * @note
+ *   If atomics are not available when building this library, the budget is
+ *   never updated.
+ */
+PATOMIC_EXPORT void
+patomic_transaction_policy_record(
+    patomic_transaction_policy_t *policy,
+    unsigned long status
+);
+
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -5,13 +5,19 @@
 #define PATOMIC_PATOMIC_H
 
 #include "api/align.h"
+#include "api/alloc.h"
 #include "api/combine.h"
 #include "api/core.h"
 #include "api/feature_check.h"
+#include "api/fence.h"
 #include "api/ids.h"
+#include "api/memcpy.h"
 #include "api/memory_order.h"
+#include "api/mutex.h"
 #include "api/ops.h"
 #include "api/options.h"
+#include "api/profile.h"
+#include "api/provenance.h"
 #include "api/transaction.h"
 
 #include <patomic/api/export.h>
@@ -105,6 +111,131 @@ patomic_create_explicit(
 );
 
 
+/**
+ * @addtogroup patomic
+ *
+ * @brief
+ *   Behaves like patomic_create, except that only operations in both opcats
+ *   and opkinds are provided, and only implementations supporting at least one
+ *   such operation are combined.
+ *
+ * @details
+ *   Alignment requirements are only taken from implementations which provide
+ *   a requested operation, so they may be weaker than those returned by
+ *   patomic_create if the operations which need stricter alignment are not
+ *   requested.
+ *
+ * @param byte_width
+ *   Width in bytes of type to support.
+ *
+ * @param order
+ *   Memory order to implicitly use for all atomic operations. This must be a
+ *   valid memory order.
+ *
+ * @param options
+ *   One or more patomic_option_t flags combined. Passed on to each internal
+ *   implementation to be used in an unspecified manner.
+ *
+ * @param kinds
+ *   One or more patomic_kind_t flags combined.
+ *
+ * @param ids
+ *   One or more patomic_id_t flags combined.
+ *
+ * @param opcats
+ *   One or more patomic_opcat_t flags combined. Operations in any other opcat
+ *   are always NULL.
+ *
+ * @param opkinds
+ *   One or more patomic_opkind_t flags combined. Operations with any other
+ *   opkind are always NULL.
+ *
+ * @returns
+ *   Combined implementations matching both kinds and ids, with only the
+ *   requested operations. If no such implementations exist, the NULL
+ *   implementation is returned.
+ *
+ * @note
+ *   The same opkinds are applied to every opcat in opcats. Since opkind values
+ *   are reused across opcats, more operations than intended may be provided
+ *   when multiple opcats are requested.
+ *
+ * @note
+ *   Passing ~0u for both opcats and opkinds is equivalent to calling
+ *   patomic_create.
+ */
+PATOMIC_EXPORT patomic_t
+patomic_create_masked(
+    size_t byte_width,
+    patomic_memory_order_t order,
+    unsigned int options,
+    unsigned int kinds,
+    unsigned long ids,
+    unsigned int opcats,
+    unsigned int opkinds
+);
+
+
+/**
+ * @addtogroup patomic
+ *
+ * @brief
+ *   Behaves like patomic_create_explicit, except that only operations in both
+ *   opcats and opkinds are provided, and only implementations supporting at
+ *   least one such operation are combined.
+ *
+ * @details
+ *   Alignment requirements are only taken from implementations which provide
+ *   a requested operation, so they may be weaker than those returned by
+ *   patomic_create_explicit if the operations which need stricter alignment
+ *   are not requested.
+ *
+ * @param byte_width
+ *   Width in bytes of type to support.
+ *
+ * @param options
+ *   One or more patomic_option_t flags combined. Passed on to each internal
+ *   implementation to be used in an unspecified manner.
+ *
+ * @param kinds
+ *   One or more patomic_kind_t flags combined.
+ *
+ * @param ids
+ *   One or more patomic_id_t flags combined.
+ *
+ * @param opcats
+ *   One or more patomic_opcat_t flags combined. Operations in any other opcat
+ *   are always NULL.
+ *
+ * @param opkinds
+ *   One or more patomic_opkind_t flags combined. Operations with any other
+ *   opkind are always NULL.
+ *
+ * @returns
+ *   Combined implementations matching both kinds and ids, with only the
+ *   requested operations. If no such implementations exist, the NULL
+ *   implementation is returned.
+ *
+ * @note
+ *   The same opkinds are applied to every opcat in opcats. Since opkind values
+ *   are reused across opcats, more operations than intended may be provided
+ *   when multiple opcats are requested.
+ *
+ * @note
+ *   Passing ~0u for both opcats and opkinds is equivalent to calling
+ *   patomic_create_explicit.
+ */
+PATOMIC_EXPORT patomic_explicit_t
+patomic_create_explicit_masked(
+    size_t byte_width,
+    unsigned int options,
+    unsigned int kinds,
+    unsigned long ids,
+    unsigned int opcats,
+    unsigned int opkinds
+);
+
+
 /**
  * @addtogroup patomic
  *
@@ -143,6 +274,58 @@ patomic_create_transaction(
 );
 
 
+/**
+ * @addtogroup patomic
+ *
+ * @brief
+ *   Provides the memory fences of the implementation with the most efficient
+ *   kind that supports them. If multiple implementations fulfil these
+ *   requirements, the first one in the implementation register is returned.
+ *
+ * @param kinds
+ *   One or more patomic_kind_t flags combined.
+ *
+ * @param ids
+ *   One or more patomic_id_t flags combined.
+ *
+ * @returns
+ *   The fences of the implementation with the most efficient kind that
+ *   supports them. If no such implementation exists, both fences are NULL.
+ */
+PATOMIC_EXPORT patomic_fence_t
+patomic_create_fence(
+    unsigned int kinds,
+    unsigned long ids
+);
+
+
+/**
+ * @addtogroup patomic
+ *
+ * @brief
+ *   Provides the atomic memcpy operations of the implementation with the most
+ *   efficient kind that supports them. If multiple implementations fulfil
+ *   these requirements, the first one in the implementation register is
+ *   returned.
+ *
+ * @param kinds
+ *   One or more patomic_kind_t flags combined.
+ *
+ * @param ids
+ *   One or more patomic_id_t flags combined.
+ *
+ * @returns
+ *   The atomic memcpy operations of the implementation with the most
+ *   efficient kind that supports them. If no such implementation exists, both
+ *   operations are NULL.
+ */
+PATOMIC_EXPORT patomic_memcpy_t
+patomic_create_memcpy(
+    unsigned int kinds,
+    unsigned long ids
+);
+
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
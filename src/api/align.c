@@ -4,16 +4,118 @@
 #include <patomic/api/align.h>
 #include <patomic/internal/align.h>
 
+#include <patomic/config.h>
+
 #include <patomic/stdlib/math.h>
 #include <patomic/stdlib/stdint.h>
 
 #include <patomic/stdlib/assert.h>
 
+#if PATOMIC_HAS_SYSCONF_L1_DCACHE
+    #include <unistd.h>
+#endif
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+    #include <stdatomic.h>
+#endif
+
+
+/*
+ * CACHE LINE SIZE:
+ * - detected at runtime the first time it is needed, then cached
+ * - any detected value which is not a power of 2 no larger than the macro is
+ *   discarded in favour of the macro, so the documented guarantees hold
+ * - x86 prefetches cache lines in adjacent pairs, so objects need to be two
+ *   lines apart to avoid false sharing
+ */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define PATOMIC_DESTRUCTIVE_LINE_COUNT ((size_t) 2)
+#else
+    #define PATOMIC_DESTRUCTIVE_LINE_COUNT ((size_t) 1)
+#endif
+
+static size_t
+patomic_cache_line_size_detect(void)
+{
+    /* declarations */
+    size_t size = 0;
+
+    /* query os */
+#if PATOMIC_HAS_SYSCONF_L1_DCACHE
+    {
+        const long sc = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+        if (sc > 0l)
+        {
+            size = (size_t) sc;
+        }
+    }
+#endif
+
+    /* validate */
+    if (!patomic_unsigned_is_pow2(size) ||
+        size > PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE)
+    {
+        size = PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE;
+    }
+    return size;
+}
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+static atomic_size_t patomic_cache_line_size_cached;
+
 
 size_t
 patomic_cache_line_size(void)
 {
-    return PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE;
+    /* racing threads detect the same value, so relaxed is sufficient */
+    size_t size = atomic_load_explicit(
+        &patomic_cache_line_size_cached, memory_order_relaxed
+    );
+    if (size == 0)
+    {
+        size = patomic_cache_line_size_detect();
+        atomic_store_explicit(
+            &patomic_cache_line_size_cached, size, memory_order_relaxed
+        );
+    }
+    return size;
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+size_t
+patomic_cache_line_size(void)
+{
+    return patomic_cache_line_size_detect();
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+size_t
+patomic_destructive_interference_size(void)
+{
+    /* declarations */
+    const size_t size =
+        patomic_cache_line_size() * PATOMIC_DESTRUCTIVE_LINE_COUNT;
+
+    /* never exceed the macro */
+    return (size > PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE)
+        ? PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE
+        : size;
+}
+
+
+size_t
+patomic_constructive_interference_size(void)
+{
+    return patomic_cache_line_size();
 }
 
 
@@ -0,0 +1,204 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+/* needed for madvise, must precede all system headers */
+#ifndef _DEFAULT_SOURCE
+    #define _DEFAULT_SOURCE 1
+#endif
+
+#include <patomic/api/alloc.h>
+
+#include <patomic/config.h>
+
+#include <patomic/stdlib/math.h>
+#include <patomic/stdlib/stdint.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if PATOMIC_HAS_MADV_HUGEPAGE
+    #include <sys/mman.h>
+#endif
+
+
+/*
+ * LAYOUT:
+ * - storage is over-allocated with malloc, and the returned pointer is
+ *   rounded up to the requested alignment
+ * - the pointer returned by malloc is stored in the bytes immediately before
+ *   the returned pointer, so that patomic_free can release it
+ * - huge pages are only requested for allocations spanning at least one huge
+ *   page, which are then aligned to the huge page size
+ */
+#define PATOMIC_ALLOC_HUGE_PAGE_SIZE ((size_t) 2 * 1024u * 1024u)
+
+
+static size_t
+patomic_alloc_round_up(
+    const size_t value,
+    const size_t multiple
+)
+{
+    /* declarations */
+    const size_t rem = patomic_unsigned_mod_pow2(value, multiple);
+
+    /* returns 0 on overflow */
+    if (rem == 0)
+    {
+        return value;
+    }
+    else if (value > ((size_t) -1) - (multiple - rem))
+    {
+        return 0;
+    }
+    return value + (multiple - rem);
+}
+
+
+size_t
+patomic_alloc_stride(
+    const patomic_align_t align,
+    const size_t width,
+    const unsigned int flags
+)
+{
+    /* declarations */
+    size_t multiple = align.recommended;
+
+    /* check parameters */
+    if (width == 0 || !patomic_unsigned_is_pow2(align.recommended))
+    {
+        return 0;
+    }
+
+    /* isolate objects */
+    if (flags & patomic_alloc_ISOLATE)
+    {
+        const size_t line = patomic_destructive_interference_size();
+        multiple = (line > multiple) ? line : multiple;
+    }
+
+    /* stride */
+    return patomic_alloc_round_up(width, multiple);
+}
+
+
+void *
+patomic_alloc(
+    const patomic_align_t align,
+    const size_t width,
+    const unsigned int flags
+)
+{
+    return patomic_alloc_array(align, width, 1u, 0u, flags);
+}
+
+
+void *
+patomic_alloc_array(
+    const patomic_align_t align,
+    const size_t width,
+    const size_t count,
+    size_t stride,
+    const unsigned int flags
+)
+{
+    /* declarations */
+    size_t alignment = align.recommended;
+    size_t size;
+    size_t total;
+    unsigned char *raw;
+    patomic_intptr_unsigned_t addr;
+
+    /* check parameters */
+    if (width == 0 || count == 0 || !patomic_unsigned_is_pow2(alignment))
+    {
+        return NULL;
+    }
+
+    /* get stride */
+    if (stride == 0)
+    {
+        stride = patomic_alloc_stride(align, width, flags);
+    }
+    else if (stride < width || patomic_unsigned_mod_pow2(stride, alignment))
+    {
+        return NULL;
+    }
+    if (stride == 0 || count > ((size_t) -1) / stride)
+    {
+        return NULL;
+    }
+    size = count * stride;
+
+    /* get alignment (all values are powers of 2) */
+    if (flags & patomic_alloc_ISOLATE)
+    {
+        const size_t line = patomic_destructive_interference_size();
+        alignment = (line > alignment) ? line : alignment;
+        size = patomic_alloc_round_up(size, alignment);
+    }
+#if PATOMIC_HAS_MADV_HUGEPAGE
+    if ((flags & patomic_alloc_HUGE_PAGES) &&
+        size >= PATOMIC_ALLOC_HUGE_PAGE_SIZE &&
+        alignment < PATOMIC_ALLOC_HUGE_PAGE_SIZE)
+    {
+        alignment = PATOMIC_ALLOC_HUGE_PAGE_SIZE;
+    }
+#endif
+
+    /* allocate with room for alignment and the stored pointer */
+    if (size == 0 || size > ((size_t) -1) - alignment - sizeof(void *))
+    {
+        return NULL;
+    }
+    total = size + alignment + sizeof(void *);
+    raw = (unsigned char *) malloc(total);
+    if (raw == NULL)
+    {
+        return NULL;
+    }
+
+    /* align and store raw pointer before it */
+    addr = (patomic_intptr_unsigned_t) (raw + sizeof(void *));
+    if (patomic_unsigned_mod_pow2(addr, alignment) != 0)
+    {
+        addr += alignment - patomic_unsigned_mod_pow2(addr, alignment);
+    }
+    memcpy((unsigned char *) addr - sizeof(void *), &raw, sizeof(void *));
+
+    /* request huge pages for whole huge pages in the returned range */
+#if PATOMIC_HAS_MADV_HUGEPAGE
+    if (alignment == PATOMIC_ALLOC_HUGE_PAGE_SIZE &&
+        (flags & patomic_alloc_HUGE_PAGES))
+    {
+        const size_t length = size - patomic_unsigned_mod_pow2(
+            size, PATOMIC_ALLOC_HUGE_PAGE_SIZE
+        );
+        /* this is only a hint, so failure is ignored */
+        (void) madvise((void *) addr, length, MADV_HUGEPAGE);
+    }
+#endif
+
+    return (void *) addr;
+}
+
+
+void
+patomic_free(
+    void *const ptr
+)
+{
+    /* declarations */
+    void *raw;
+
+    /* free(NULL) semantics */
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    /* release raw pointer stored before ptr */
+    memcpy(&raw, (unsigned char *) ptr - sizeof(void *), sizeof(void *));
+    free(raw);
+}
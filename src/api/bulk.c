@@ -0,0 +1,166 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/internal/bulk.h>
+
+#include <patomic/macros/ignore_unused.h>
+
+#include <patomic/stdlib/assert.h>
+
+
+#if PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+
+
+#include <patomic/stdlib/stdint.h>
+
+#include <immintrin.h>
+
+
+void
+patomic_internal_bulk_vector_range(
+    const volatile void *const objs,
+    const size_t byte_width,
+    const size_t count,
+    size_t *const begin,
+    size_t *const end
+)
+{
+    /* declarations */
+    const size_t vector_size = PATOMIC_INTERNAL_BULK_VECTOR_SIZE;
+    const patomic_intptr_unsigned_t addr = (patomic_intptr_unsigned_t) objs;
+    const size_t misalign = (size_t) (addr % vector_size);
+    size_t head;
+    size_t vector_count;
+
+    /* assertions */
+    patomic_assert(byte_width != 0);
+    patomic_assert(addr % byte_width == 0);
+
+    /* elements must not straddle vectors */
+    *begin = count;
+    *end = count;
+    if (vector_size % byte_width != 0)
+    {
+        return;
+    }
+
+    /* elements before the first vector aligned address */
+    head = (misalign == 0) ? 0 : (vector_size - misalign) / byte_width;
+    if (head >= count)
+    {
+        return;
+    }
+
+    /* whole vectors after the head */
+    vector_count = ((count - head) * byte_width) / vector_size;
+    *begin = head;
+    *end = head + ((vector_count * vector_size) / byte_width);
+}
+
+
+void
+patomic_internal_bulk_load_vectors(
+    const volatile void *const src,
+    void *const dst,
+    const size_t byte_count
+)
+{
+    /* declarations */
+    const volatile __m128i *const vsrc = (const volatile __m128i *) src;
+    __m128i *const vdst = (__m128i *) dst;
+    const size_t vector_count = byte_count / PATOMIC_INTERNAL_BULK_VECTOR_SIZE;
+    size_t i;
+
+    /* assertions */
+    patomic_assert(byte_count % PATOMIC_INTERNAL_BULK_VECTOR_SIZE == 0);
+
+    /* volatile access forces a single aligned vector load for each vector */
+    for (i = 0; i < vector_count; ++i)
+    {
+        const __m128i v = vsrc[i];
+        _mm_storeu_si128(&vdst[i], v);
+    }
+}
+
+
+void
+patomic_internal_bulk_store_vectors(
+    volatile void *const dst,
+    const void *const src,
+    const size_t byte_count
+)
+{
+    /* declarations */
+    volatile __m128i *const vdst = (volatile __m128i *) dst;
+    const __m128i *const vsrc = (const __m128i *) src;
+    const size_t vector_count = byte_count / PATOMIC_INTERNAL_BULK_VECTOR_SIZE;
+    size_t i;
+
+    /* assertions */
+    patomic_assert(byte_count % PATOMIC_INTERNAL_BULK_VECTOR_SIZE == 0);
+
+    /* volatile access forces a single aligned vector store for each vector */
+    for (i = 0; i < vector_count; ++i)
+    {
+        vdst[i] = _mm_loadu_si128(&vsrc[i]);
+    }
+}
+
+
+#else  /* PATOMIC_INTERNAL_BULK_VECTOR_SIZE */
+
+
+void
+patomic_internal_bulk_vector_range(
+    const volatile void *const objs,
+    const size_t byte_width,
+    const size_t count,
+    size_t *const begin,
+    size_t *const end
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(objs);
+    PATOMIC_IGNORE_UNUSED(byte_width);
+
+    /* no elements can be accessed with vectors */
+    *begin = count;
+    *end = count;
+}
+
+
+void
+patomic_internal_bulk_load_vectors(
+    const volatile void *const src,
+    void *const dst,
+    const size_t byte_count
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(src);
+    PATOMIC_IGNORE_UNUSED(dst);
+    PATOMIC_IGNORE_UNUSED(byte_count);
+
+    /* vector range is always empty, so this is never called */
+    patomic_assert_always("vector loads are not supported" && 0);
+}
+
+
+void
+patomic_internal_bulk_store_vectors(
+    volatile void *const dst,
+    const void *const src,
+    const size_t byte_count
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(dst);
+    PATOMIC_IGNORE_UNUSED(src);
+    PATOMIC_IGNORE_UNUSED(byte_count);
+
+    /* vector range is always empty, so this is never called */
+    patomic_assert_always("vector stores are not supported" && 0);
+}
+
+
+#endif  /* PATOMIC_INTERNAL_BULK_VECTOR_SIZE */
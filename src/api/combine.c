@@ -48,49 +48,94 @@
     while (0)
 
 
-#define PATOMIC_COMBINE_OPS(i, core, other_core)                                    \
-    do {                                                                            \
-        /* base */                                                                  \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.fp_store);                    \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.fp_load);                     \
-                                                                                    \
-        /* xchg */                                                                  \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_exchange);        \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_cmpxchg_weak);    \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_cmpxchg_strong);  \
-                                                                                    \
-        /* bitwise */                                                               \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test);         \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_compl);   \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_set);     \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_reset);   \
-                                                                                    \
-        /* binary - void */                                                         \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_or);            \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_xor);           \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_and);           \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_not);           \
-                                                                                    \
-        /* binary - fetch */                                                        \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_or);      \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_xor);     \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_and);     \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_not);     \
-                                                                                    \
-        /* arithmetic - void */                                                     \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_add);       \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_sub);       \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_inc);       \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_dec);       \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_neg);       \
-                                                                                    \
-        /* arithmetic - fetch */                                                    \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_add); \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_sub); \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_inc); \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_dec); \
-        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_neg); \
-    }                                                                               \
+#define PATOMIC_COMBINE_OPS(i, core, other_core)                                         \
+    do {                                                                                 \
+        /* base */                                                                       \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.fp_store);                         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.fp_load);                          \
+                                                                                         \
+        /* xchg */                                                                       \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_exchange);             \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_cmpxchg_weak);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_cmpxchg_strong);       \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.xchg_ops.fp_fetch_update);         \
+                                                                                         \
+        /* bitwise */                                                                    \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test);              \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_compl);        \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_set);          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.bitwise_ops.fp_test_reset);        \
+                                                                                         \
+        /* binary - void */                                                              \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_or);                 \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_xor);                \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_and);                \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_not);                \
+                                                                                         \
+        /* binary - fetch */                                                             \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_or);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_xor);          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_and);          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.binary_ops.fp_fetch_not);          \
+                                                                                         \
+        /* arithmetic - void */                                                          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_add);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_sub);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_inc);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_dec);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_neg);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_min);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_max);            \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_umin);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_umax);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_add_sat);        \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_sub_sat);        \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_uadd_sat);       \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_usub_sat);       \
+                                                                                         \
+        /* arithmetic - fetch */                                                         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_add);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_sub);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_inc);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_dec);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_neg);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_min);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_max);      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_umin);     \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_umax);     \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_add_sat);  \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_sub_sat);  \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_uadd_sat); \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.arithmetic_ops.fp_fetch_usub_sat); \
+                                                                                         \
+        /* wait */                                                                       \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.wait_ops.fp_wait);                 \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.wait_ops.fp_wait_timed);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.wait_ops.fp_notify_one);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.wait_ops.fp_notify_all);           \
+                                                                                         \
+        /* batch */                                                                      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_add_n);               \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_sub_n);               \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_or_n);                \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_xor_n);               \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_and_n);               \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_fetch_add_n);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_fetch_sub_n);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_fetch_or_n);          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_fetch_xor_n);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_fetch_and_n);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_exchange_n);          \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_cmpxchg_n);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_store_array);         \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.batch_ops.fp_load_array);          \
+                                                                                         \
+        /* float */                                                                      \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.float_ops.fp_add);                 \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.float_ops.fp_sub);                 \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.float_ops.fp_fetch_add);           \
+        PATOMIC_COPY_IF_NULL(i, core, other_core, ops.float_ops.fp_fetch_sub);           \
+    }                                                                                    \
     while (0)
 
 
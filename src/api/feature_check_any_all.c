@@ -22,7 +22,8 @@
         if ((cats & patomic_opcat_XCHG)                          \
             && ((ops->xchg_ops.fp_exchange       != NULL) and_or \
                 (ops->xchg_ops.fp_cmpxchg_weak   != NULL) and_or \
-                (ops->xchg_ops.fp_cmpxchg_strong != NULL)))      \
+                (ops->xchg_ops.fp_cmpxchg_strong != NULL) and_or \
+                (ops->xchg_ops.fp_fetch_update   != NULL)))      \
         {                                                        \
             cats ^= patomic_opcat_XCHG;                          \
         }                                                        \
@@ -64,18 +65,26 @@
     PATOMIC_UNSET_OPCAT_BIN(ops, cats, and_or, F, _fetch_)
 
 
-#define PATOMIC_UNSET_OPCAT_ARI(ops, cats, and_or, vf, fp_sep)       \
-    do {                                                             \
-        if ((cats & patomic_opcat_ARI_##vf)                          \
-            && ((ops->arithmetic_ops.fp##fp_sep##add != NULL) and_or \
-                (ops->arithmetic_ops.fp##fp_sep##sub != NULL) and_or \
-                (ops->arithmetic_ops.fp##fp_sep##inc != NULL) and_or \
-                (ops->arithmetic_ops.fp##fp_sep##dec != NULL) and_or \
-                (ops->arithmetic_ops.fp##fp_sep##neg != NULL)))      \
-        {                                                            \
-            cats ^= patomic_opcat_ARI_##vf;                          \
-        }                                                            \
-    }                                                                \
+#define PATOMIC_UNSET_OPCAT_ARI(ops, cats, and_or, vf, fp_sep)            \
+    do {                                                                  \
+        if ((cats & patomic_opcat_ARI_##vf)                               \
+            && ((ops->arithmetic_ops.fp##fp_sep##add      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##sub      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##inc      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##dec      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##neg      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##min      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##max      != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##umin     != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##umax     != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##add_sat  != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##sub_sat  != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##uadd_sat != NULL) and_or \
+                (ops->arithmetic_ops.fp##fp_sep##usub_sat != NULL)))      \
+        {                                                                 \
+            cats ^= patomic_opcat_ARI_##vf;                               \
+        }                                                                 \
+    }                                                                     \
     while (0)
 
 #define PATOMIC_UNSET_OPCAT_ARI_V(ops, cats, and_or) \
@@ -91,7 +100,9 @@
             && ((ops->special_ops.fp_double_cmpxchg != NULL) and_or \
                 (ops->special_ops.fp_multi_cmpxchg  != NULL) and_or \
                 (ops->special_ops.fp_generic        != NULL) and_or \
-                (ops->special_ops.fp_generic_wfb    != NULL)))      \
+                (ops->special_ops.fp_generic_wfb    != NULL) and_or \
+                (ops->special_ops.fp_multi_load     != NULL) and_or \
+                (ops->special_ops.fp_multi_op       != NULL)))      \
         {                                                           \
             cats ^= patomic_opcat_TSPEC;                            \
         }                                                           \
@@ -128,6 +139,76 @@
     while (0)
 
 
+#define PATOMIC_UNSET_OPCAT_WAIT(ops, cats, and_or)          \
+    do {                                                     \
+        if ((cats & patomic_opcat_WAIT)                      \
+            && ((ops->wait_ops.fp_wait       != NULL) and_or \
+                (ops->wait_ops.fp_wait_timed != NULL) and_or \
+                (ops->wait_ops.fp_notify_one != NULL) and_or \
+                (ops->wait_ops.fp_notify_all != NULL)))      \
+        {                                                    \
+            cats ^= patomic_opcat_WAIT;                      \
+        }                                                    \
+    }                                                        \
+    while (0)
+
+
+#define PATOMIC_UNSET_OPCAT_BATCH_V(ops, cats, and_or)         \
+    do {                                                       \
+        if ((cats & patomic_opcat_BATCH_V)                     \
+            && ((ops->batch_ops.fp_add_n       != NULL) and_or \
+                (ops->batch_ops.fp_sub_n       != NULL) and_or \
+                (ops->batch_ops.fp_or_n        != NULL) and_or \
+                (ops->batch_ops.fp_xor_n       != NULL) and_or \
+                (ops->batch_ops.fp_and_n       != NULL) and_or \
+                (ops->batch_ops.fp_store_array != NULL)))      \
+        {                                                      \
+            cats ^= patomic_opcat_BATCH_V;                     \
+        }                                                      \
+    }                                                          \
+    while (0)
+
+#define PATOMIC_UNSET_OPCAT_BATCH_F(ops, cats, and_or)         \
+    do {                                                       \
+        if ((cats & patomic_opcat_BATCH_F)                     \
+            && ((ops->batch_ops.fp_fetch_add_n != NULL) and_or \
+                (ops->batch_ops.fp_fetch_sub_n != NULL) and_or \
+                (ops->batch_ops.fp_fetch_or_n  != NULL) and_or \
+                (ops->batch_ops.fp_fetch_xor_n != NULL) and_or \
+                (ops->batch_ops.fp_fetch_and_n != NULL) and_or \
+                (ops->batch_ops.fp_exchange_n  != NULL) and_or \
+                (ops->batch_ops.fp_cmpxchg_n   != NULL) and_or \
+                (ops->batch_ops.fp_load_array  != NULL)))      \
+        {                                                      \
+            cats ^= patomic_opcat_BATCH_F;                     \
+        }                                                      \
+    }                                                          \
+    while (0)
+
+
+#define PATOMIC_UNSET_OPCAT_FLT_V(ops, cats, and_or)   \
+    do {                                               \
+        if ((cats & patomic_opcat_FLT_V)               \
+            && ((ops->float_ops.fp_add != NULL) and_or \
+                (ops->float_ops.fp_sub != NULL)))      \
+        {                                              \
+            cats ^= patomic_opcat_FLT_V;               \
+        }                                              \
+    }                                                  \
+    while (0)
+
+#define PATOMIC_UNSET_OPCAT_FLT_F(ops, cats, and_or)         \
+    do {                                                     \
+        if ((cats & patomic_opcat_FLT_F)                     \
+            && ((ops->float_ops.fp_fetch_add != NULL) and_or \
+                (ops->float_ops.fp_fetch_sub != NULL)))      \
+        {                                                    \
+            cats ^= patomic_opcat_FLT_F;                     \
+        }                                                    \
+    }                                                        \
+    while (0)
+
+
 unsigned int
 patomic_feature_check_all(
     const patomic_ops_t *const ops,
@@ -148,6 +229,11 @@ patomic_feature_check_all(
     PATOMIC_UNSET_OPCAT_BIN_F(ops, opcats, &&);
     PATOMIC_UNSET_OPCAT_ARI_V(ops, opcats, &&);
     PATOMIC_UNSET_OPCAT_ARI_F(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_WAIT(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_BATCH_V(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_BATCH_F(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_FLT_V(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_FLT_F(ops, opcats, &&);
 
     /* return updated opcats */
     return opcats;
@@ -174,6 +260,11 @@ patomic_feature_check_all_explicit(
     PATOMIC_UNSET_OPCAT_BIN_F(ops, opcats, &&);
     PATOMIC_UNSET_OPCAT_ARI_V(ops, opcats, &&);
     PATOMIC_UNSET_OPCAT_ARI_F(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_WAIT(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_BATCH_V(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_BATCH_F(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_FLT_V(ops, opcats, &&);
+    PATOMIC_UNSET_OPCAT_FLT_F(ops, opcats, &&);
 
     /* return updated opcats */
     return opcats;
@@ -230,6 +321,11 @@ patomic_internal_feature_check_any(
     PATOMIC_UNSET_OPCAT_BIN_F(ops, opcats, ||);
     PATOMIC_UNSET_OPCAT_ARI_V(ops, opcats, ||);
     PATOMIC_UNSET_OPCAT_ARI_F(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_WAIT(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_BATCH_V(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_BATCH_F(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_FLT_V(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_FLT_F(ops, opcats, ||);
 
     /* return updated opcats */
     return opcats;
@@ -267,6 +363,11 @@ patomic_internal_feature_check_any_explicit(
     PATOMIC_UNSET_OPCAT_BIN_F(ops, opcats, ||);
     PATOMIC_UNSET_OPCAT_ARI_V(ops, opcats, ||);
     PATOMIC_UNSET_OPCAT_ARI_F(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_WAIT(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_BATCH_V(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_BATCH_F(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_FLT_V(ops, opcats, ||);
+    PATOMIC_UNSET_OPCAT_FLT_F(ops, opcats, ||);
 
     /* return updated opcats */
     return opcats;
@@ -0,0 +1,134 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/api/feature_check.h>
+
+#include <patomic/macros/static_assert.h>
+
+#include <patomic/stdlib/assert.h>
+#include <patomic/stdlib/math.h>
+
+
+#define PATOMIC_FEATURE_CAPS_OPCATS \
+    ((1u << PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE) - 1u)
+
+
+/* the count must cover exactly the opcats up to the last one */
+PATOMIC_STATIC_ASSERT(
+    feature_caps_opcat_count_matches_enum,
+    (1ul << (PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE - 1)) ==
+        (unsigned long) patomic_opcat_FLT_F
+);
+
+
+/*
+ * INDEX:
+ * - multiplying a power of 2 by a de Bruijn sequence puts a unique 5 bit
+ *   pattern in the top bits of the low 32 bits, which is mapped back to the
+ *   position of the set bit with a lookup table
+ * - this only holds for values with a single bit set in the low 32 bits
+ */
+static const unsigned char patomic_feature_caps_debruijn_index[32] = {
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+};
+
+#define PATOMIC_FEATURE_CAPS_INDEX(opcat)                               \
+    patomic_feature_caps_debruijn_index[                                \
+        (((unsigned long) (opcat) * 0x077CB531ul) & 0xFFFFFFFFul) >> 27 \
+    ]
+
+
+#define PATOMIC_DEFINE_FEATURE_CAPS(name, ops_type, any, all, leaf) \
+    patomic_feature_caps_abi_unstable_t                             \
+    name(                                                           \
+        const ops_type *const ops                                   \
+    )                                                               \
+    {                                                               \
+        /* declarations */                                          \
+        const unsigned int opcats = PATOMIC_FEATURE_CAPS_OPCATS;    \
+        patomic_feature_caps_abi_unstable_t caps;                   \
+        unsigned int opcat;                                         \
+        int index = 0;                                              \
+                                                                    \
+        /* opcats */                                                \
+        caps.opcats_any = opcats & ~any(ops, opcats);               \
+        caps.opcats_all = opcats & ~all(ops, opcats);               \
+                                                                    \
+        /* opkinds for each opcat */                                \
+        for (opcat = 1u; opcat & opcats; opcat <<= 1u, ++index)     \
+        {                                                           \
+            caps.opkinds[index] = ~leaf(                            \
+                ops, (patomic_opcat_t) opcat, ~0u                   \
+            );                                                      \
+        }                                                           \
+                                                                    \
+        return caps;                                                \
+    }
+
+
+PATOMIC_DEFINE_FEATURE_CAPS(
+    patomic_feature_caps,
+    patomic_ops_t,
+    patomic_feature_check_any,
+    patomic_feature_check_all,
+    patomic_feature_check_leaf
+)
+
+PATOMIC_DEFINE_FEATURE_CAPS(
+    patomic_feature_caps_explicit,
+    patomic_ops_explicit_t,
+    patomic_feature_check_any_explicit,
+    patomic_feature_check_all_explicit,
+    patomic_feature_check_leaf_explicit
+)
+
+PATOMIC_DEFINE_FEATURE_CAPS(
+    patomic_feature_caps_transaction,
+    patomic_ops_transaction_t,
+    patomic_feature_check_any_transaction,
+    patomic_feature_check_all_transaction,
+    patomic_feature_check_leaf_transaction
+)
+
+
+unsigned int
+patomic_feature_caps_check_all(
+    const patomic_feature_caps_abi_unstable_t *const caps,
+    const unsigned int opcats
+)
+{
+    return opcats & ~caps->opcats_all;
+}
+
+
+unsigned int
+patomic_feature_caps_check_any(
+    const patomic_feature_caps_abi_unstable_t *const caps,
+    const unsigned int opcats
+)
+{
+    return opcats & ~caps->opcats_any;
+}
+
+
+unsigned int
+patomic_feature_caps_check_leaf(
+    const patomic_feature_caps_abi_unstable_t *const caps,
+    const patomic_opcat_t opcat,
+    const unsigned int opkinds
+)
+{
+    /* declarations */
+    const unsigned int index = PATOMIC_FEATURE_CAPS_INDEX(opcat);
+
+    /* ensure that a single opcat is being checked */
+    patomic_assert_always(patomic_unsigned_is_pow2(opcat));
+
+    /* opcats without an index do not modify anything */
+    if (index >= PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE)
+    {
+        return opkinds;
+    }
+    return opkinds & ~caps->opkinds[index];
+}
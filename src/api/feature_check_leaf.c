@@ -19,76 +19,124 @@
     while (0)
 
 
-#define PATOMIC_UNSET_OPKINDS_LDST(ops, kinds)        \
-    PATOMIC_UNSET_OPKIND(ops->fp_load,  kinds, LOAD); \
-    PATOMIC_UNSET_OPKIND(ops->fp_store, kinds, STORE)
+#define PATOMIC_FOR_OPKINDS_LDST(ops, kinds, do_kind) \
+    do_kind(ops->fp_load,  kinds, LOAD);              \
+    do_kind(ops->fp_store, kinds, STORE)
+
+
+#define PATOMIC_FOR_OPKINDS_XCHG(ops, kinds, do_kind)                \
+    do_kind(ops->xchg_ops.fp_exchange,       kinds, EXCHANGE);       \
+    do_kind(ops->xchg_ops.fp_cmpxchg_weak,   kinds, CMPXCHG_WEAK);   \
+    do_kind(ops->xchg_ops.fp_cmpxchg_strong, kinds, CMPXCHG_STRONG); \
+    do_kind(ops->xchg_ops.fp_fetch_update,   kinds, FETCH_UPDATE)
 
 
-#define PATOMIC_UNSET_OPKINDS_XCHG(ops, kinds)                                  \
-    PATOMIC_UNSET_OPKIND(ops->xchg_ops.fp_exchange,       kinds, EXCHANGE);     \
-    PATOMIC_UNSET_OPKIND(ops->xchg_ops.fp_cmpxchg_weak,   kinds, CMPXCHG_WEAK); \
-    PATOMIC_UNSET_OPKIND(ops->xchg_ops.fp_cmpxchg_strong, kinds, CMPXCHG_STRONG)
+#define PATOMIC_FOR_OPKINDS_BIT(ops, kinds, do_kind)            \
+    do_kind(ops->bitwise_ops.fp_test,       kinds, TEST);       \
+    do_kind(ops->bitwise_ops.fp_test_compl, kinds, TEST_COMPL); \
+    do_kind(ops->bitwise_ops.fp_test_set,   kinds, TEST_SET);   \
+    do_kind(ops->bitwise_ops.fp_test_reset, kinds, TEST_RESET)
+
 
+#define PATOMIC_FOR_OPKINDS_BIN(ops, kinds, fp_sep, do_kind) \
+    do_kind(ops->binary_ops.fp##fp_sep##or,  kinds, OR);     \
+    do_kind(ops->binary_ops.fp##fp_sep##xor, kinds, XOR);    \
+    do_kind(ops->binary_ops.fp##fp_sep##and, kinds, AND);    \
+    do_kind(ops->binary_ops.fp##fp_sep##not, kinds, NOT)
 
-#define PATOMIC_UNSET_OPKINDS_BIT(ops, kinds)                                \
-    PATOMIC_UNSET_OPKIND(ops->bitwise_ops.fp_test,       kinds, TEST);       \
-    PATOMIC_UNSET_OPKIND(ops->bitwise_ops.fp_test_compl, kinds, TEST_COMPL); \
-    PATOMIC_UNSET_OPKIND(ops->bitwise_ops.fp_test_set,   kinds, TEST_SET);   \
-    PATOMIC_UNSET_OPKIND(ops->bitwise_ops.fp_test_reset, kinds, TEST_RESET)
+#define PATOMIC_FOR_OPKINDS_BIN_V(ops, kinds, do_kind) \
+    PATOMIC_FOR_OPKINDS_BIN(ops, kinds, _, do_kind)
 
+#define PATOMIC_FOR_OPKINDS_BIN_F(ops, kinds, do_kind)    \
+    PATOMIC_FOR_OPKINDS_BIN(ops, kinds, _fetch_, do_kind)
 
-#define PATOMIC_UNSET_OPKINDS_BIN(ops, kinds, fp_sep)                  \
-    PATOMIC_UNSET_OPKIND(ops->binary_ops.fp##fp_sep##or,  kinds, OR);  \
-    PATOMIC_UNSET_OPKIND(ops->binary_ops.fp##fp_sep##xor, kinds, XOR); \
-    PATOMIC_UNSET_OPKIND(ops->binary_ops.fp##fp_sep##and, kinds, AND); \
-    PATOMIC_UNSET_OPKIND(ops->binary_ops.fp##fp_sep##not, kinds, NOT)
 
-#define PATOMIC_UNSET_OPKINDS_BIN_V(ops, kinds) \
-    PATOMIC_UNSET_OPKINDS_BIN(ops, kinds, _)
+#define PATOMIC_FOR_OPKINDS_ARI(ops, kinds, fp_sep, do_kind)            \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##add,      kinds, ADD);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##sub,      kinds, SUB);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##inc,      kinds, INC);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##dec,      kinds, DEC);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##neg,      kinds, NEG);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##min,      kinds, MIN);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##max,      kinds, MAX);      \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##umin,     kinds, UMIN);     \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##umax,     kinds, UMAX);     \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##add_sat,  kinds, ADD_SAT);  \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##sub_sat,  kinds, SUB_SAT);  \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##uadd_sat, kinds, UADD_SAT); \
+    do_kind(ops->arithmetic_ops.fp##fp_sep##usub_sat, kinds, USUB_SAT)
 
-#define PATOMIC_UNSET_OPKINDS_BIN_F(ops, kinds) \
-    PATOMIC_UNSET_OPKINDS_BIN(ops, kinds, _fetch_)
+#define PATOMIC_FOR_OPKINDS_ARI_V(ops, kinds, do_kind) \
+    PATOMIC_FOR_OPKINDS_ARI(ops, kinds, _, do_kind)
 
+#define PATOMIC_FOR_OPKINDS_ARI_F(ops, kinds, do_kind)    \
+    PATOMIC_FOR_OPKINDS_ARI(ops, kinds, _fetch_, do_kind)
 
-#define PATOMIC_UNSET_OPKINDS_ARI(ops, kinds, fp_sep)                      \
-    PATOMIC_UNSET_OPKIND(ops->arithmetic_ops.fp##fp_sep##add, kinds, ADD); \
-    PATOMIC_UNSET_OPKIND(ops->arithmetic_ops.fp##fp_sep##sub, kinds, SUB); \
-    PATOMIC_UNSET_OPKIND(ops->arithmetic_ops.fp##fp_sep##inc, kinds, INC); \
-    PATOMIC_UNSET_OPKIND(ops->arithmetic_ops.fp##fp_sep##dec, kinds, DEC); \
-    PATOMIC_UNSET_OPKIND(ops->arithmetic_ops.fp##fp_sep##neg, kinds, NEG)
 
-#define PATOMIC_UNSET_OPKINDS_ARI_V(ops, kinds) \
-    PATOMIC_UNSET_OPKINDS_ARI(ops, kinds, _)
+#define PATOMIC_FOR_OPKINDS_TSPEC(ops, kinds, do_kind)                  \
+    do_kind(ops->special_ops.fp_double_cmpxchg, kinds, DOUBLE_CMPXCHG); \
+    do_kind(ops->special_ops.fp_multi_cmpxchg,  kinds, MULTI_CMPXCHG);  \
+    do_kind(ops->special_ops.fp_generic,        kinds, GENERIC);        \
+    do_kind(ops->special_ops.fp_generic_wfb,    kinds, GENERIC_WFB);    \
+    do_kind(ops->special_ops.fp_multi_load,     kinds, MULTI_LOAD);     \
+    do_kind(ops->special_ops.fp_multi_op,       kinds, MULTI_OP)
 
-#define PATOMIC_UNSET_OPKINDS_ARI_F(ops, kinds) \
-    PATOMIC_UNSET_OPKINDS_ARI(ops, kinds, _fetch_)
 
+#define PATOMIC_FOR_OPKINDS_TFLAG(ops, kinds, do_kind)   \
+    do_kind(ops->flag_ops.fp_test,     kinds, TEST);     \
+    do_kind(ops->flag_ops.fp_test_set, kinds, TEST_SET); \
+    do_kind(ops->flag_ops.fp_clear,    kinds, CLEAR)
 
-#define PATOMIC_UNSET_OPKINDS_TSPEC(ops, kinds)                                      \
-    PATOMIC_UNSET_OPKIND(ops->special_ops.fp_double_cmpxchg, kinds, DOUBLE_CMPXCHG); \
-    PATOMIC_UNSET_OPKIND(ops->special_ops.fp_multi_cmpxchg,  kinds, MULTI_CMPXCHG);  \
-    PATOMIC_UNSET_OPKIND(ops->special_ops.fp_generic,        kinds, GENERIC);        \
-    PATOMIC_UNSET_OPKIND(ops->special_ops.fp_generic_wfb,    kinds, GENERIC_WFB)
 
+#define PATOMIC_FOR_OPKINDS_TRAW(ops, kinds, do_kind)             \
+    do_kind(ops->raw_ops.fp_tbegin,        kinds, TBEGIN);        \
+    do_kind(ops->raw_ops.fp_tcommit,       kinds, TCOMMIT);       \
+    do_kind(ops->raw_ops.fp_tabort_all,    kinds, TABORT_ALL);    \
+    do_kind(ops->raw_ops.fp_tabort_single, kinds, TABORT_SINGLE); \
+    do_kind(ops->raw_ops.fp_ttest,         kinds, TTEST);         \
+    do_kind(ops->raw_ops.fp_tdepth,        kinds, TDEPTH)
 
-#define PATOMIC_UNSET_OPKINDS_TFLAG(ops, kinds)                       \
-    PATOMIC_UNSET_OPKIND(ops->flag_ops.fp_test,     kinds, TEST);     \
-    PATOMIC_UNSET_OPKIND(ops->flag_ops.fp_test_set, kinds, TEST_SET); \
-    PATOMIC_UNSET_OPKIND(ops->flag_ops.fp_clear,    kinds, CLEAR)
 
+#define PATOMIC_FOR_OPKINDS_WAIT(ops, kinds, do_kind)        \
+    do_kind(ops->wait_ops.fp_wait,       kinds, WAIT);       \
+    do_kind(ops->wait_ops.fp_wait_timed, kinds, WAIT_TIMED); \
+    do_kind(ops->wait_ops.fp_notify_one, kinds, NOTIFY_ONE); \
+    do_kind(ops->wait_ops.fp_notify_all, kinds, NOTIFY_ALL)
 
-#define PATOMIC_UNSET_OPKINDS_TRAW(ops, kinds)                                 \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_tbegin,        kinds, TBEGIN);        \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_tcommit,       kinds, TCOMMIT);       \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_tabort_all,    kinds, TABORT_ALL);    \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_tabort_single, kinds, TABORT_SINGLE); \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_ttest,         kinds, TTEST);         \
-    PATOMIC_UNSET_OPKIND(ops->raw_ops.fp_tdepth,        kinds, TDEPTH)
 
+#define PATOMIC_FOR_OPKINDS_BATCH_V(ops, kinds, do_kind)       \
+    do_kind(ops->batch_ops.fp_add_n,       kinds, ADD_N);      \
+    do_kind(ops->batch_ops.fp_sub_n,       kinds, SUB_N);      \
+    do_kind(ops->batch_ops.fp_or_n,        kinds, OR_N);       \
+    do_kind(ops->batch_ops.fp_xor_n,       kinds, XOR_N);      \
+    do_kind(ops->batch_ops.fp_and_n,       kinds, AND_N);      \
+    do_kind(ops->batch_ops.fp_store_array, kinds, STORE_ARRAY)
 
-#define PATOMIC_CASE_UNSET_OPKINDS(cat, ops, kinds) \
-    case patomic_opcat_##cat:                       \
-        PATOMIC_UNSET_OPKINDS_##cat(ops, opkinds);  \
+#define PATOMIC_FOR_OPKINDS_BATCH_F(ops, kinds, do_kind)       \
+    do_kind(ops->batch_ops.fp_fetch_add_n, kinds, ADD_N);      \
+    do_kind(ops->batch_ops.fp_fetch_sub_n, kinds, SUB_N);      \
+    do_kind(ops->batch_ops.fp_fetch_or_n,  kinds, OR_N);       \
+    do_kind(ops->batch_ops.fp_fetch_xor_n, kinds, XOR_N);      \
+    do_kind(ops->batch_ops.fp_fetch_and_n, kinds, AND_N);      \
+    do_kind(ops->batch_ops.fp_exchange_n,  kinds, EXCHANGE_N); \
+    do_kind(ops->batch_ops.fp_cmpxchg_n,   kinds, CMPXCHG_N);  \
+    do_kind(ops->batch_ops.fp_load_array,  kinds, LOAD_ARRAY)
+
+
+#define PATOMIC_FOR_OPKINDS_FLT(ops, kinds, fp_sep, do_kind) \
+    do_kind(ops->float_ops.fp##fp_sep##add, kinds, FADD);    \
+    do_kind(ops->float_ops.fp##fp_sep##sub, kinds, FSUB)
+
+#define PATOMIC_FOR_OPKINDS_FLT_V(ops, kinds, do_kind) \
+    PATOMIC_FOR_OPKINDS_FLT(ops, kinds, _, do_kind)
+
+#define PATOMIC_FOR_OPKINDS_FLT_F(ops, kinds, do_kind)    \
+    PATOMIC_FOR_OPKINDS_FLT(ops, kinds, _fetch_, do_kind)
+
+
+#define PATOMIC_CASE_UNSET_OPKINDS(cat, ops, kinds)                    \
+    case patomic_opcat_##cat:                                          \
+        PATOMIC_FOR_OPKINDS_##cat(ops, opkinds, PATOMIC_UNSET_OPKIND); \
         break
 
 
@@ -112,13 +160,18 @@ patomic_feature_check_leaf(
     switch (opcat)
     {
         /* unset bit for each opkind where op is present */
-        PATOMIC_CASE_UNSET_OPKINDS(LDST,  ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(XCHG,  ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIT,   ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIN_V, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIN_F, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(ARI_V, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(ARI_F, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(LDST,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(XCHG,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIT,     ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIN_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIN_F,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(ARI_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(ARI_F,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(WAIT,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BATCH_V, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BATCH_F, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(FLT_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(FLT_F,   ops, opkinds);
 
         /* unsupported opcats do not modify anything */
         case patomic_opcat_TSPEC:
@@ -131,6 +184,8 @@ patomic_feature_check_leaf(
         case patomic_opcat_NONE:
         case patomic_opcats_BIN:
         case patomic_opcats_ARI:
+        case patomic_opcats_BATCH:
+        case patomic_opcats_FLT:
         case patomic_opcats_IMPLICIT:
         /* case patomic_opcats_EXPLICIT: (==IMPLICIT) */
         case patomic_opcats_TRANSACTION:
@@ -165,13 +220,18 @@ patomic_feature_check_leaf_explicit(
     switch (opcat)
     {
         /* unset bit for each opkind where op is present */
-        PATOMIC_CASE_UNSET_OPKINDS(LDST,  ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(XCHG,  ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIT,   ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIN_V, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(BIN_F, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(ARI_V, ops, opkinds);
-        PATOMIC_CASE_UNSET_OPKINDS(ARI_F, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(LDST,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(XCHG,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIT,     ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIN_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BIN_F,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(ARI_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(ARI_F,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(WAIT,    ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BATCH_V, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(BATCH_F, ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(FLT_V,   ops, opkinds);
+        PATOMIC_CASE_UNSET_OPKINDS(FLT_F,   ops, opkinds);
 
         /* unsupported opcats do not modify anything */
         case patomic_opcat_TSPEC:
@@ -184,6 +244,8 @@ patomic_feature_check_leaf_explicit(
         case patomic_opcat_NONE:
         case patomic_opcats_BIN:
         case patomic_opcats_ARI:
+        case patomic_opcats_BATCH:
+        case patomic_opcats_FLT:
         case patomic_opcats_IMPLICIT:
         /* case patomic_opcats_EXPLICIT: (==IMPLICIT) */
         case patomic_opcats_TRANSACTION:
@@ -230,6 +292,11 @@ patomic_internal_feature_check_leaf_transaction(
         PATOMIC_CASE_UNSET_OPKINDS(TRAW,  ops, opkinds);
 
         /* unsupported opcats do not modify anything */
+        case patomic_opcat_WAIT:
+        case patomic_opcat_BATCH_V:
+        case patomic_opcat_BATCH_F:
+        case patomic_opcat_FLT_V:
+        case patomic_opcat_FLT_F:
         default:
             break;
 
@@ -237,6 +304,8 @@ patomic_internal_feature_check_leaf_transaction(
         case patomic_opcat_NONE:
         case patomic_opcats_BIN:
         case patomic_opcats_ARI:
+        case patomic_opcats_BATCH:
+        case patomic_opcats_FLT:
         case patomic_opcats_IMPLICIT:
         /* case patomic_opcats_EXPLICIT: (==IMPLICIT) */
         case patomic_opcats_TRANSACTION:
@@ -263,3 +332,73 @@ patomic_feature_check_leaf_transaction(
         ops, opcat, opkinds
     );
 }
+
+
+#define PATOMIC_MASK_OPKIND(fp_op, kinds, kind)                \
+    do {                                                       \
+        if (!((kinds) & (unsigned int) patomic_opkind_##kind)) \
+        {                                                      \
+            fp_op = NULL;                                      \
+        }                                                      \
+    }                                                          \
+    while (0)
+
+
+#define PATOMIC_MASK_OPCAT(cat, ops, opcats, opkinds)                     \
+    do {                                                                  \
+        if ((opcats) & (unsigned int) patomic_opcat_##cat)                \
+        {                                                                 \
+            PATOMIC_FOR_OPKINDS_##cat(ops, opkinds, PATOMIC_MASK_OPKIND); \
+        }                                                                 \
+        else                                                              \
+        {                                                                 \
+            PATOMIC_FOR_OPKINDS_##cat(ops, 0u, PATOMIC_MASK_OPKIND);      \
+        }                                                                 \
+    }                                                                     \
+    while (0)
+
+
+void
+patomic_internal_feature_mask(
+    patomic_ops_t *const ops,
+    const unsigned int opcats,
+    const unsigned int opkinds
+)
+{
+    /* set each op to NULL if its opcat or opkind was not requested */
+    PATOMIC_MASK_OPCAT(LDST,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(XCHG,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIT,     ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIN_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIN_F,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(ARI_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(ARI_F,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(WAIT,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BATCH_V, ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BATCH_F, ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(FLT_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(FLT_F,   ops, opcats, opkinds);
+}
+
+
+void
+patomic_internal_feature_mask_explicit(
+    patomic_ops_explicit_t *const ops,
+    const unsigned int opcats,
+    const unsigned int opkinds
+)
+{
+    /* set each op to NULL if its opcat or opkind was not requested */
+    PATOMIC_MASK_OPCAT(LDST,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(XCHG,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIT,     ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIN_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BIN_F,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(ARI_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(ARI_F,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(WAIT,    ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BATCH_V, ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(BATCH_F, ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(FLT_V,   ops, opcats, opkinds);
+    PATOMIC_MASK_OPCAT(FLT_F,   ops, opcats, opkinds);
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/patomic.h>
+
+#include <patomic/config.h>
+
+#include <patomic/stdlib/assert.h>
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+    #include <stdatomic.h>
+#endif
+
+
+/*
+ * FENCE:
+ * - the best available fence is resolved the first time it is needed, then
+ *   cached, since the result of patomic_create_fence never changes
+ * - fences are not optional, so aborts if no implementation supports them
+ */
+static patomic_fence_t
+patomic_fence_resolve(void)
+{
+    /* obtain best available fence */
+    const patomic_fence_t fence = patomic_create_fence(
+        patomic_kinds_ALL, patomic_ids_ALL
+    );
+
+    /* check fences are supported */
+    patomic_assert_always(fence.fp_thread_fence != NULL);
+    patomic_assert_always(fence.fp_signal_fence != NULL);
+    return fence;
+}
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+static _Atomic(patomic_opsig_fence_t) patomic_thread_fence_cached;
+static _Atomic(patomic_opsig_fence_t) patomic_signal_fence_cached;
+
+
+void
+patomic_thread_fence(
+    const int order
+)
+{
+    /* racing threads resolve the same fence, so relaxed is sufficient */
+    patomic_opsig_fence_t fp = atomic_load_explicit(
+        &patomic_thread_fence_cached, memory_order_relaxed
+    );
+    if (fp == NULL)
+    {
+        fp = patomic_fence_resolve().fp_thread_fence;
+        atomic_store_explicit(
+            &patomic_thread_fence_cached, fp, memory_order_relaxed
+        );
+    }
+    fp(order);
+}
+
+
+void
+patomic_signal_fence(
+    const int order
+)
+{
+    /* racing threads resolve the same fence, so relaxed is sufficient */
+    patomic_opsig_fence_t fp = atomic_load_explicit(
+        &patomic_signal_fence_cached, memory_order_relaxed
+    );
+    if (fp == NULL)
+    {
+        fp = patomic_fence_resolve().fp_signal_fence;
+        atomic_store_explicit(
+            &patomic_signal_fence_cached, fp, memory_order_relaxed
+        );
+    }
+    fp(order);
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+void
+patomic_thread_fence(
+    const int order
+)
+{
+    patomic_fence_resolve().fp_thread_fence(order);
+}
+
+
+void
+patomic_signal_fence(
+    const int order
+)
+{
+    patomic_fence_resolve().fp_signal_fence(order);
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
@@ -0,0 +1,118 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/patomic.h>
+
+#include <patomic/config.h>
+
+#include <patomic/stdlib/assert.h>
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+    #include <stdatomic.h>
+#endif
+
+
+/*
+ * MEMCPY:
+ * - the best available operations are resolved the first time they are
+ *   needed, then cached, since the result of patomic_create_memcpy never
+ *   changes
+ * - a seqlock reader would otherwise be left with an uninitialized buffer, so
+ *   aborts if no implementation supports atomic memcpy
+ */
+static patomic_memcpy_t
+patomic_memcpy_resolve(void)
+{
+    /* obtain best available operations */
+    const patomic_memcpy_t ops = patomic_create_memcpy(
+        patomic_kinds_ALL, patomic_ids_ALL
+    );
+
+    /* check atomic memcpy is supported */
+    patomic_assert_always(ops.fp_load_memcpy != NULL);
+    patomic_assert_always(ops.fp_store_memcpy != NULL);
+    return ops;
+}
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+static _Atomic(patomic_opsig_load_memcpy_t) patomic_load_memcpy_cached;
+static _Atomic(patomic_opsig_store_memcpy_t) patomic_store_memcpy_cached;
+
+
+void
+patomic_atomic_load_memcpy(
+    void *const dst,
+    const volatile void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    /* racing threads resolve the same operation, so relaxed is sufficient */
+    patomic_opsig_load_memcpy_t fp = atomic_load_explicit(
+        &patomic_load_memcpy_cached, memory_order_relaxed
+    );
+    if (fp == NULL)
+    {
+        fp = patomic_memcpy_resolve().fp_load_memcpy;
+        atomic_store_explicit(
+            &patomic_load_memcpy_cached, fp, memory_order_relaxed
+        );
+    }
+    fp(dst, src, byte_count, order);
+}
+
+
+void
+patomic_atomic_store_memcpy(
+    volatile void *const dst,
+    const void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    /* racing threads resolve the same operation, so relaxed is sufficient */
+    patomic_opsig_store_memcpy_t fp = atomic_load_explicit(
+        &patomic_store_memcpy_cached, memory_order_relaxed
+    );
+    if (fp == NULL)
+    {
+        fp = patomic_memcpy_resolve().fp_store_memcpy;
+        atomic_store_explicit(
+            &patomic_store_memcpy_cached, fp, memory_order_relaxed
+        );
+    }
+    fp(dst, src, byte_count, order);
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+void
+patomic_atomic_load_memcpy(
+    void *const dst,
+    const volatile void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    patomic_memcpy_resolve().fp_load_memcpy(dst, src, byte_count, order);
+}
+
+
+void
+patomic_atomic_store_memcpy(
+    volatile void *const dst,
+    const void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    patomic_memcpy_resolve().fp_store_memcpy(dst, src, byte_count, order);
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
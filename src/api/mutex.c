@@ -0,0 +1,214 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/patomic.h>
+
+#include <patomic/internal/transaction.h>
+
+#include <patomic/config.h>
+
+#include <patomic/macros/ignore_unused.h>
+
+#include <patomic/stdlib/assert.h>
+
+#include <stddef.h>
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+#include <stdatomic.h>
+
+#define PATOMIC_ELIDED_MUTEX_COUNT(counter)             \
+    PATOMIC_IGNORE_UNUSED(atomic_fetch_add_explicit(    \
+        (volatile _Atomic(unsigned long) *) &(counter), \
+        1ul, memory_order_relaxed                       \
+    ))
+
+#define PATOMIC_ELIDED_MUTEX_LOAD(counter)                    \
+    atomic_load_explicit(                                     \
+        (const volatile _Atomic(unsigned long) *) &(counter), \
+        memory_order_relaxed                                  \
+    )
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+#define PATOMIC_ELIDED_MUTEX_COUNT(counter) \
+    PATOMIC_IGNORE_UNUSED(counter)
+
+#define PATOMIC_ELIDED_MUTEX_LOAD(counter) \
+    0ul
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+/*
+ * ELISION:
+ * - raw operations are only taken from implementations with hardware support,
+ *   so the lock is never "elided" into an emulated global lock
+ * - flag operations fall back to those provided alongside emulated
+ *   transactions, so the mutex works as a spinlock without hardware support
+ * - while elided, the flag is in the transaction's read set, so acquiring the
+ *   flag aborts all elided critical sections
+ * - the flag is only ever set while the mutex is held without a transaction,
+ *   so unlock can tell which path was taken by testing it
+ */
+int
+patomic_elided_mutex_init(
+    patomic_elided_mutex_abi_unstable_t *const mutex,
+    const unsigned long attempts
+)
+{
+    /* declarations */
+    const patomic_ops_transaction_raw_t no_raw_ops = {0};
+    patomic_transaction_t pat;
+
+    /* assertions */
+    patomic_assert(mutex != NULL);
+
+    /* hardware transactions, if available */
+    pat = patomic_create_transaction(
+        patomic_option_NONE, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    mutex->raw_ops = pat.ops.raw_ops;
+    mutex->flag_ops = pat.ops.flag_ops;
+
+    /* flag operations from any implementation */
+    if (mutex->flag_ops.fp_test_set == NULL)
+    {
+        pat = patomic_create_transaction(
+            (unsigned int) patomic_option_TRANSACTION_LOCK,
+            patomic_kinds_ALL, patomic_ids_ALL
+        );
+        mutex->flag_ops = pat.ops.flag_ops;
+    }
+
+    /* zero attempts means the lock is never elided */
+    if (attempts == 0ul)
+    {
+        mutex->raw_ops = no_raw_ops;
+    }
+
+    /* initialize remaining state */
+    mutex->holder.flag = 0;
+    patomic_transaction_policy_init(&mutex->policy, attempts, 0ul);
+    mutex->elided_count = 0ul;
+    mutex->fallback_count = 0ul;
+
+    /* flag operations are required for the fallback path */
+    return mutex->flag_ops.fp_test_set != NULL;
+}
+
+
+void
+patomic_elided_mutex_lock(
+    patomic_elided_mutex_abi_unstable_t *const mutex
+)
+{
+    /* declarations */
+    const patomic_ops_transaction_raw_t *const raw = &mutex->raw_ops;
+    const patomic_ops_transaction_flag_t *const fops = &mutex->flag_ops;
+    patomic_transaction_flag_t *const flag = &mutex->holder.flag;
+    unsigned long attempts = 0ul;
+    unsigned long attempts_made = 0ul;
+    unsigned long status = 0ul;
+
+    /* assertions */
+    patomic_assert(mutex != NULL);
+    patomic_assert(fops->fp_test_set != NULL);
+
+    /* elided path */
+    if (raw->fp_tbegin != NULL)
+    {
+        attempts = patomic_transaction_policy_attempts(
+            &mutex->policy, mutex->policy.max_attempts
+        );
+    }
+    while (attempts-- > 0ul)
+    {
+        /* starting while the flag is set would abort immediately */
+        while (fops->fp_test(flag))
+        {
+            /* spin */
+        }
+
+        /* critical section continues inside the transaction */
+        ++attempts_made;
+        status = raw->fp_tbegin();
+        if (status == 0ul)
+        {
+            if (*flag == 0)
+            {
+                return;
+            }
+            raw->fp_tcommit();
+            status = PATOMIC_INTERNAL_TRANSACTION_STATUS_CREATE(
+                patomic_TABORT_EXPLICIT, patomic_TINFO_FLAG_SET, 0
+            );
+        }
+        if (attempts == 0ul || !patomic_transaction_policy_retry(
+            &mutex->policy, status, attempts_made
+        ))
+        {
+            break;
+        }
+    }
+    if (attempts_made != 0ul)
+    {
+        patomic_transaction_policy_record(&mutex->policy, status);
+    }
+
+    /* fallback path */
+    while (fops->fp_test_set(flag))
+    {
+        while (fops->fp_test(flag))
+        {
+            /* spin on test to avoid contended writes */
+        }
+    }
+    PATOMIC_ELIDED_MUTEX_COUNT(mutex->fallback_count);
+}
+
+
+void
+patomic_elided_mutex_unlock(
+    patomic_elided_mutex_abi_unstable_t *const mutex
+)
+{
+    /* assertions */
+    patomic_assert(mutex != NULL);
+
+    /* flag is only set if the fallback path was taken */
+    if (mutex->flag_ops.fp_test(&mutex->holder.flag))
+    {
+        mutex->flag_ops.fp_clear(&mutex->holder.flag);
+    }
+    else
+    {
+        patomic_assert(mutex->raw_ops.fp_tcommit != NULL);
+        mutex->raw_ops.fp_tcommit();
+        patomic_transaction_policy_record(&mutex->policy, 0ul);
+        PATOMIC_ELIDED_MUTEX_COUNT(mutex->elided_count);
+    }
+}
+
+
+void
+patomic_elided_mutex_stats(
+    const patomic_elided_mutex_abi_unstable_t *const mutex,
+    unsigned long *const elided,
+    unsigned long *const fallback
+)
+{
+    /* assertions */
+    patomic_assert(mutex != NULL);
+    patomic_assert(elided != NULL);
+    patomic_assert(fallback != NULL);
+
+    /* relaxed loads, not a consistent snapshot */
+    *elided = PATOMIC_ELIDED_MUTEX_LOAD(mutex->elided_count);
+    *fallback = PATOMIC_ELIDED_MUTEX_LOAD(mutex->fallback_count);
+}
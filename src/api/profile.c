@@ -0,0 +1,1280 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/api/profile.h>
+#include <patomic/internal/profile.h>
+
+#include <patomic/config.h>
+
+#include <patomic/macros/ignore_unused.h>
+#include <patomic/macros/static_assert.h>
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+#include <patomic/api/align.h>
+#include <patomic/internal/feature_check.h>
+#include <patomic/internal/thread.h>
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/*
+ * COUNTERS:
+ * - each thread uses the shard at its index modulo the shard count
+ * - shards are padded so that no two shards share a cache line
+ * - if there are more threads than shards, threads share shards
+ */
+#define PATOMIC_PROFILE_SLOT_COUNT PATOMIC_PROFILE_SLOT_COUNT_ABI_UNSTABLE
+
+PATOMIC_STATIC_ASSERT(
+    profile_slot_count_matches_enum,
+    PATOMIC_PROFILE_SLOT_COUNT == (int) patomic_profile_slot_FETCH_FSUB + 1
+);
+
+#define PATOMIC_PROFILE_SHARD_COUNT 64u
+
+
+/*
+ * SAMPLES:
+ * - when sampling is enabled, one in every 'interval' calls counted in a
+ *   shard also records the object's address in that shard's ring buffer
+ * - entries are written with relaxed stores, so a concurrent reader may see
+ *   an entry whose address and meta come from different samples
+ * - meta holds ((slot << 1) | failed) + 1, so that zero means empty
+ */
+#define PATOMIC_PROFILE_SAMPLE_CAPACITY 32u
+
+typedef struct {
+    _Atomic(const volatile void *) address;
+    atomic_uint meta;
+} patomic_profile_sample_t;
+
+static atomic_uint patomic_profile_sample_interval;
+
+
+typedef struct {
+    atomic_ulong calls[PATOMIC_PROFILE_SLOT_COUNT];
+    atomic_ulong failures[PATOMIC_PROFILE_SLOT_COUNT];
+    atomic_uint sample_tick;
+    atomic_uint sample_next;
+    patomic_profile_sample_t samples[PATOMIC_PROFILE_SAMPLE_CAPACITY];
+    unsigned char padding[PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE];
+} patomic_profile_shard_t;
+
+static patomic_profile_shard_t patomic_profile_shards[PATOMIC_PROFILE_SHARD_COUNT];
+
+
+static void
+patomic_profile_sample(
+    patomic_profile_shard_t *const shard,
+    const volatile void *const obj,
+    const patomic_profile_slot_t slot,
+    const int failed
+)
+{
+    /* declarations */
+    patomic_profile_sample_t *sample;
+    unsigned int meta;
+    const unsigned int interval = atomic_load_explicit(
+        &patomic_profile_sample_interval, memory_order_relaxed
+    );
+
+    /* check if this call should be sampled */
+    if (interval == 0u)
+    {
+        return;
+    }
+    else if (atomic_fetch_add_explicit(
+        &shard->sample_tick, 1u, memory_order_relaxed) % interval != 0u)
+    {
+        return;
+    }
+
+    /* write sample to next entry, overwriting the oldest */
+    sample = &shard->samples[atomic_fetch_add_explicit(
+        &shard->sample_next, 1u, memory_order_relaxed
+    ) % PATOMIC_PROFILE_SAMPLE_CAPACITY];
+    meta = ((((unsigned int) slot) << 1u) | (failed ? 1u : 0u)) + 1u;
+    atomic_store_explicit(&sample->meta, 0u, memory_order_relaxed);
+    atomic_store_explicit(&sample->address, obj, memory_order_relaxed);
+    atomic_store_explicit(&sample->meta, meta, memory_order_release);
+}
+
+
+static void
+patomic_profile_count(
+    const volatile void *const obj,
+    const patomic_profile_slot_t slot,
+    const int failed
+)
+{
+    patomic_profile_shard_t *const shard = &patomic_profile_shards[
+        patomic_internal_thread_index() % PATOMIC_PROFILE_SHARD_COUNT
+    ];
+    atomic_fetch_add_explicit(&shard->calls[slot], 1ul, memory_order_relaxed);
+    if (failed)
+    {
+        atomic_fetch_add_explicit(&shard->failures[slot], 1ul, memory_order_relaxed);
+    }
+    patomic_profile_sample(shard, obj, slot, failed);
+}
+
+
+/*
+ * WRAPPERS (IMPLICIT):
+ * - operation function pointers carry no context, so each wrapper is bound to
+ *   a fixed instance holding the real operations it forwards to
+ */
+#define PATOMIC_DEFINE_PROFILE_STORE(id, name, member, slot) \
+    static void                                              \
+    patomic_profile_##name##_##id(                           \
+        volatile void *const obj,                            \
+        const void *const desired                            \
+    )                                                        \
+    {                                                        \
+        patomic_profile_count(obj, slot, 0);                 \
+        patomic_profile_implicit[id].member(obj, desired);   \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_LOAD(id, name, member, slot) \
+    static void                                             \
+    patomic_profile_##name##_##id(                          \
+        const volatile void *const obj,                     \
+        void *const ret                                     \
+    )                                                       \
+    {                                                       \
+        patomic_profile_count(obj, slot, 0);                \
+        patomic_profile_implicit[id].member(obj, ret);      \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXCHANGE(id, name, member, slot) \
+    static void                                                 \
+    patomic_profile_##name##_##id(                              \
+        volatile void *const obj,                               \
+        const void *const desired,                              \
+        void *const ret                                         \
+    )                                                           \
+    {                                                           \
+        patomic_profile_count(obj, slot, 0);                    \
+        patomic_profile_implicit[id].member(obj, desired, ret); \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_CMPXCHG(id, name, member, slot)                      \
+    static int                                                                      \
+    patomic_profile_##name##_##id(                                                  \
+        volatile void *const obj,                                                   \
+        void *const expected,                                                       \
+        const void *const desired                                                   \
+    )                                                                               \
+    {                                                                               \
+        const int ok = patomic_profile_implicit[id].member(obj, expected, desired); \
+        patomic_profile_count(obj, slot, !ok);                                      \
+        return ok;                                                                  \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_FETCH_UPDATE(id, name, member, slot)    \
+    static int                                                         \
+    patomic_profile_##name##_##id(                                     \
+        volatile void *const obj,                                      \
+        const patomic_update_fn_t fn,                                  \
+        void *const ctx,                                               \
+        void *const ret                                                \
+    )                                                                  \
+    {                                                                  \
+        patomic_profile_count(obj, slot, 0);                           \
+        return patomic_profile_implicit[id].member(obj, fn, ctx, ret); \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_TEST(id, name, member, slot)      \
+    static int                                                   \
+    patomic_profile_##name##_##id(                               \
+        const volatile void *const obj,                          \
+        const int offset                                         \
+    )                                                            \
+    {                                                            \
+        patomic_profile_count(obj, slot, 0);                     \
+        return patomic_profile_implicit[id].member(obj, offset); \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_TEST_MODIFY(id, name, member, slot) \
+    static int                                                     \
+    patomic_profile_##name##_##id(                                 \
+        volatile void *const obj,                                  \
+        const int offset                                           \
+    )                                                              \
+    {                                                              \
+        patomic_profile_count(obj, slot, 0);                       \
+        return patomic_profile_implicit[id].member(obj, offset);   \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_FETCH(id, name, member, slot) \
+    static void                                              \
+    patomic_profile_##name##_##id(                           \
+        volatile void *const obj,                            \
+        const void *const arg,                               \
+        void *const ret                                      \
+    )                                                        \
+    {                                                        \
+        patomic_profile_count(obj, slot, 0);                 \
+        patomic_profile_implicit[id].member(obj, arg, ret);  \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_FETCH_NOARG(id, name, member, slot) \
+    static void                                                    \
+    patomic_profile_##name##_##id(                                 \
+        volatile void *const obj,                                  \
+        void *const ret                                            \
+    )                                                              \
+    {                                                              \
+        patomic_profile_count(obj, slot, 0);                       \
+        patomic_profile_implicit[id].member(obj, ret);             \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_VOID(id, name, member, slot) \
+    static void                                             \
+    patomic_profile_##name##_##id(                          \
+        volatile void *const obj,                           \
+        const void *const arg                               \
+    )                                                       \
+    {                                                       \
+        patomic_profile_count(obj, slot, 0);                \
+        patomic_profile_implicit[id].member(obj, arg);      \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_VOID_NOARG(id, name, member, slot) \
+    static void                                                   \
+    patomic_profile_##name##_##id(                                \
+        volatile void *const obj                                  \
+    )                                                             \
+    {                                                             \
+        patomic_profile_count(obj, slot, 0);                      \
+        patomic_profile_implicit[id].member(obj);                 \
+    }
+
+
+/*
+ * WRAPPERS (EXPLICIT):
+ * - same as above, but forwarding the memory order arguments
+ */
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_STORE(id, name, member, slot) \
+    static void                                                       \
+    patomic_profile_explicit_##name##_##id(                           \
+        volatile void *const obj,                                     \
+        const void *const desired,                                    \
+        const int order                                               \
+    )                                                                 \
+    {                                                                 \
+        patomic_profile_count(obj, slot, 0);                          \
+        patomic_profile_explicit[id].member(obj, desired, order);     \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_LOAD(id, name, member, slot) \
+    static void                                                      \
+    patomic_profile_explicit_##name##_##id(                          \
+        const volatile void *const obj,                              \
+        const int order,                                             \
+        void *const ret                                              \
+    )                                                                \
+    {                                                                \
+        patomic_profile_count(obj, slot, 0);                         \
+        patomic_profile_explicit[id].member(obj, order, ret);        \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_EXCHANGE(id, name, member, slot) \
+    static void                                                          \
+    patomic_profile_explicit_##name##_##id(                              \
+        volatile void *const obj,                                        \
+        const void *const desired,                                       \
+        const int order,                                                 \
+        void *const ret                                                  \
+    )                                                                    \
+    {                                                                    \
+        patomic_profile_count(obj, slot, 0);                             \
+        patomic_profile_explicit[id].member(obj, desired, order, ret);   \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_CMPXCHG(id, name, member, slot) \
+    static int                                                          \
+    patomic_profile_explicit_##name##_##id(                             \
+        volatile void *const obj,                                       \
+        void *const expected,                                           \
+        const void *const desired,                                      \
+        const int succ,                                                 \
+        const int fail                                                  \
+    )                                                                   \
+    {                                                                   \
+        const int ok = patomic_profile_explicit[id].member(             \
+            obj, expected, desired, succ, fail                          \
+        );                                                              \
+        patomic_profile_count(obj, slot, !ok);                          \
+        return ok;                                                      \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_FETCH_UPDATE(id, name, member, slot) \
+    static int                                                               \
+    patomic_profile_explicit_##name##_##id(                                  \
+        volatile void *const obj,                                            \
+        const patomic_update_fn_t fn,                                        \
+        void *const ctx,                                                     \
+        const int succ,                                                      \
+        const int fail,                                                      \
+        void *const ret                                                      \
+    )                                                                        \
+    {                                                                        \
+        patomic_profile_count(obj, slot, 0);                                 \
+        return patomic_profile_explicit[id].member(                          \
+            obj, fn, ctx, succ, fail, ret                                    \
+        );                                                                   \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_TEST(id, name, member, slot)    \
+    static int                                                          \
+    patomic_profile_explicit_##name##_##id(                             \
+        const volatile void *const obj,                                 \
+        const int offset,                                               \
+        const int order                                                 \
+    )                                                                   \
+    {                                                                   \
+        patomic_profile_count(obj, slot, 0);                            \
+        return patomic_profile_explicit[id].member(obj, offset, order); \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_TEST_MODIFY(id, name, member, slot) \
+    static int                                                              \
+    patomic_profile_explicit_##name##_##id(                                 \
+        volatile void *const obj,                                           \
+        const int offset,                                                   \
+        const int order                                                     \
+    )                                                                       \
+    {                                                                       \
+        patomic_profile_count(obj, slot, 0);                                \
+        return patomic_profile_explicit[id].member(obj, offset, order);     \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_FETCH(id, name, member, slot) \
+    static void                                                       \
+    patomic_profile_explicit_##name##_##id(                           \
+        volatile void *const obj,                                     \
+        const void *const arg,                                        \
+        const int order,                                              \
+        void *const ret                                               \
+    )                                                                 \
+    {                                                                 \
+        patomic_profile_count(obj, slot, 0);                          \
+        patomic_profile_explicit[id].member(obj, arg, order, ret);    \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_FETCH_NOARG(id, name, member, slot) \
+    static void                                                             \
+    patomic_profile_explicit_##name##_##id(                                 \
+        volatile void *const obj,                                           \
+        const int order,                                                    \
+        void *const ret                                                     \
+    )                                                                       \
+    {                                                                       \
+        patomic_profile_count(obj, slot, 0);                                \
+        patomic_profile_explicit[id].member(obj, order, ret);               \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_VOID(id, name, member, slot) \
+    static void                                                      \
+    patomic_profile_explicit_##name##_##id(                          \
+        volatile void *const obj,                                    \
+        const void *const arg,                                       \
+        const int order                                              \
+    )                                                                \
+    {                                                                \
+        patomic_profile_count(obj, slot, 0);                         \
+        patomic_profile_explicit[id].member(obj, arg, order);        \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_VOID_NOARG(id, name, member, slot) \
+    static void                                                            \
+    patomic_profile_explicit_##name##_##id(                                \
+        volatile void *const obj,                                          \
+        const int order                                                    \
+    )                                                                      \
+    {                                                                      \
+        patomic_profile_count(obj, slot, 0);                               \
+        patomic_profile_explicit[id].member(obj, order);                   \
+    }
+
+
+/*
+ * INSTANCES:
+ * - each instance holds one set of real operations and the wrappers bound to it
+ * - wrappers are only set for operations which are supported by the real set
+ */
+#define PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT \
+    PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE
+#define PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT \
+    PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT_ABI_UNSTABLE
+
+#define PATOMIC_PROFILE_STATE_FREE    0
+#define PATOMIC_PROFILE_STATE_CLAIMED 1
+#define PATOMIC_PROFILE_STATE_READY   2
+
+static patomic_ops_t patomic_profile_implicit[PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT];
+static atomic_int patomic_profile_implicit_state[PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT];
+
+static patomic_ops_explicit_t patomic_profile_explicit[PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT];
+static atomic_int patomic_profile_explicit_state[PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT];
+
+#define PATOMIC_DEFINE_PROFILE_OPS(id, macro)                                                               \
+    /* base */                                                                                              \
+    macro##STORE(id, store, fp_store, patomic_profile_slot_STORE)                                           \
+    macro##LOAD(id, load, fp_load, patomic_profile_slot_LOAD)                                               \
+    /* xchg */                                                                                              \
+    macro##EXCHANGE(id, exchange, xchg_ops.fp_exchange, patomic_profile_slot_EXCHANGE)                      \
+    macro##CMPXCHG(id, cmpxchg_weak, xchg_ops.fp_cmpxchg_weak, patomic_profile_slot_CMPXCHG_WEAK)           \
+    macro##CMPXCHG(id, cmpxchg_strong, xchg_ops.fp_cmpxchg_strong, patomic_profile_slot_CMPXCHG_STRONG)     \
+    macro##FETCH_UPDATE(id, fetch_update, xchg_ops.fp_fetch_update, patomic_profile_slot_FETCH_UPDATE)      \
+    /* bitwise */                                                                                           \
+    macro##TEST(id, test, bitwise_ops.fp_test, patomic_profile_slot_TEST)                                   \
+    macro##TEST_MODIFY(id, test_compl, bitwise_ops.fp_test_compl, patomic_profile_slot_TEST_COMPL)          \
+    macro##TEST_MODIFY(id, test_set, bitwise_ops.fp_test_set, patomic_profile_slot_TEST_SET)                \
+    macro##TEST_MODIFY(id, test_reset, bitwise_ops.fp_test_reset, patomic_profile_slot_TEST_RESET)          \
+    /* binary - void */                                                                                     \
+    macro##VOID(id, or, binary_ops.fp_or, patomic_profile_slot_OR)                                          \
+    macro##VOID(id, xor, binary_ops.fp_xor, patomic_profile_slot_XOR)                                       \
+    macro##VOID(id, and, binary_ops.fp_and, patomic_profile_slot_AND)                                       \
+    macro##VOID_NOARG(id, not, binary_ops.fp_not, patomic_profile_slot_NOT)                                 \
+    /* binary - fetch */                                                                                    \
+    macro##FETCH(id, fetch_or, binary_ops.fp_fetch_or, patomic_profile_slot_FETCH_OR)                       \
+    macro##FETCH(id, fetch_xor, binary_ops.fp_fetch_xor, patomic_profile_slot_FETCH_XOR)                    \
+    macro##FETCH(id, fetch_and, binary_ops.fp_fetch_and, patomic_profile_slot_FETCH_AND)                    \
+    macro##FETCH_NOARG(id, fetch_not, binary_ops.fp_fetch_not, patomic_profile_slot_FETCH_NOT)              \
+    /* arithmetic - void */                                                                                 \
+    macro##VOID(id, add, arithmetic_ops.fp_add, patomic_profile_slot_ADD)                                   \
+    macro##VOID(id, sub, arithmetic_ops.fp_sub, patomic_profile_slot_SUB)                                   \
+    macro##VOID_NOARG(id, inc, arithmetic_ops.fp_inc, patomic_profile_slot_INC)                             \
+    macro##VOID_NOARG(id, dec, arithmetic_ops.fp_dec, patomic_profile_slot_DEC)                             \
+    macro##VOID_NOARG(id, neg, arithmetic_ops.fp_neg, patomic_profile_slot_NEG)                             \
+    macro##VOID(id, min, arithmetic_ops.fp_min, patomic_profile_slot_MIN)                                   \
+    macro##VOID(id, max, arithmetic_ops.fp_max, patomic_profile_slot_MAX)                                   \
+    macro##VOID(id, umin, arithmetic_ops.fp_umin, patomic_profile_slot_UMIN)                                \
+    macro##VOID(id, umax, arithmetic_ops.fp_umax, patomic_profile_slot_UMAX)                                \
+    macro##VOID(id, add_sat, arithmetic_ops.fp_add_sat, patomic_profile_slot_ADD_SAT)                       \
+    macro##VOID(id, sub_sat, arithmetic_ops.fp_sub_sat, patomic_profile_slot_SUB_SAT)                       \
+    macro##VOID(id, uadd_sat, arithmetic_ops.fp_uadd_sat, patomic_profile_slot_UADD_SAT)                    \
+    macro##VOID(id, usub_sat, arithmetic_ops.fp_usub_sat, patomic_profile_slot_USUB_SAT)                    \
+    /* arithmetic - fetch */                                                                                \
+    macro##FETCH(id, fetch_add, arithmetic_ops.fp_fetch_add, patomic_profile_slot_FETCH_ADD)                \
+    macro##FETCH(id, fetch_sub, arithmetic_ops.fp_fetch_sub, patomic_profile_slot_FETCH_SUB)                \
+    macro##FETCH_NOARG(id, fetch_inc, arithmetic_ops.fp_fetch_inc, patomic_profile_slot_FETCH_INC)          \
+    macro##FETCH_NOARG(id, fetch_dec, arithmetic_ops.fp_fetch_dec, patomic_profile_slot_FETCH_DEC)          \
+    macro##FETCH_NOARG(id, fetch_neg, arithmetic_ops.fp_fetch_neg, patomic_profile_slot_FETCH_NEG)          \
+    macro##FETCH(id, fetch_min, arithmetic_ops.fp_fetch_min, patomic_profile_slot_FETCH_MIN)                \
+    macro##FETCH(id, fetch_max, arithmetic_ops.fp_fetch_max, patomic_profile_slot_FETCH_MAX)                \
+    macro##FETCH(id, fetch_umin, arithmetic_ops.fp_fetch_umin, patomic_profile_slot_FETCH_UMIN)             \
+    macro##FETCH(id, fetch_umax, arithmetic_ops.fp_fetch_umax, patomic_profile_slot_FETCH_UMAX)             \
+    macro##FETCH(id, fetch_add_sat, arithmetic_ops.fp_fetch_add_sat, patomic_profile_slot_FETCH_ADD_SAT)    \
+    macro##FETCH(id, fetch_sub_sat, arithmetic_ops.fp_fetch_sub_sat, patomic_profile_slot_FETCH_SUB_SAT)    \
+    macro##FETCH(id, fetch_uadd_sat, arithmetic_ops.fp_fetch_uadd_sat, patomic_profile_slot_FETCH_UADD_SAT) \
+    macro##FETCH(id, fetch_usub_sat, arithmetic_ops.fp_fetch_usub_sat, patomic_profile_slot_FETCH_USUB_SAT) \
+    /* float - void */                                                                                      \
+    macro##VOID(id, fadd, float_ops.fp_add, patomic_profile_slot_FADD)                                      \
+    macro##VOID(id, fsub, float_ops.fp_sub, patomic_profile_slot_FSUB)                                      \
+    /* float - fetch */                                                                                     \
+    macro##FETCH(id, fetch_fadd, float_ops.fp_fetch_add, patomic_profile_slot_FETCH_FADD)                   \
+    macro##FETCH(id, fetch_fsub, float_ops.fp_fetch_sub, patomic_profile_slot_FETCH_FSUB)
+
+#define PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, member, fn) \
+    ops->member = (real->member != NULL) ? fn : NULL
+
+#define PATOMIC_PROFILE_WRAP_OPS(ops, real, id, prefix)                                                              \
+    do {                                                                                                             \
+        /* base */                                                                                                   \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, fp_store, prefix##store_##id);                                  \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, fp_load, prefix##load_##id);                                    \
+        /* xchg */                                                                                                   \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, xchg_ops.fp_exchange, prefix##exchange_##id);                   \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, xchg_ops.fp_cmpxchg_weak, prefix##cmpxchg_weak_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, xchg_ops.fp_cmpxchg_strong, prefix##cmpxchg_strong_##id);       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, xchg_ops.fp_fetch_update, prefix##fetch_update_##id);           \
+        /* bitwise */                                                                                                \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, bitwise_ops.fp_test, prefix##test_##id);                        \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, bitwise_ops.fp_test_compl, prefix##test_compl_##id);            \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, bitwise_ops.fp_test_set, prefix##test_set_##id);                \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, bitwise_ops.fp_test_reset, prefix##test_reset_##id);            \
+        /* binary - void */                                                                                          \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_or, prefix##or_##id);                             \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_xor, prefix##xor_##id);                           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_and, prefix##and_##id);                           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_not, prefix##not_##id);                           \
+        /* binary - fetch */                                                                                         \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_fetch_or, prefix##fetch_or_##id);                 \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_fetch_xor, prefix##fetch_xor_##id);               \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_fetch_and, prefix##fetch_and_##id);               \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, binary_ops.fp_fetch_not, prefix##fetch_not_##id);               \
+        /* arithmetic - void */                                                                                      \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_add, prefix##add_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_sub, prefix##sub_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_inc, prefix##inc_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_dec, prefix##dec_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_neg, prefix##neg_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_min, prefix##min_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_max, prefix##max_##id);                       \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_umin, prefix##umin_##id);                     \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_umax, prefix##umax_##id);                     \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_add_sat, prefix##add_sat_##id);               \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_sub_sat, prefix##sub_sat_##id);               \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_uadd_sat, prefix##uadd_sat_##id);             \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_usub_sat, prefix##usub_sat_##id);             \
+        /* arithmetic - fetch */                                                                                     \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_add, prefix##fetch_add_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_sub, prefix##fetch_sub_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_inc, prefix##fetch_inc_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_dec, prefix##fetch_dec_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_neg, prefix##fetch_neg_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_min, prefix##fetch_min_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_max, prefix##fetch_max_##id);           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_umin, prefix##fetch_umin_##id);         \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_umax, prefix##fetch_umax_##id);         \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_add_sat, prefix##fetch_add_sat_##id);   \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_sub_sat, prefix##fetch_sub_sat_##id);   \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_uadd_sat, prefix##fetch_uadd_sat_##id); \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, arithmetic_ops.fp_fetch_usub_sat, prefix##fetch_usub_sat_##id); \
+        /* float - void */                                                                                           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, float_ops.fp_add, prefix##fadd_##id);                           \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, float_ops.fp_sub, prefix##fsub_##id);                           \
+        /* float - fetch */                                                                                          \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, float_ops.fp_fetch_add, prefix##fetch_fadd_##id);               \
+        PATOMIC_PROFILE_WRAP_IF_SUPPORTED(ops, real, float_ops.fp_fetch_sub, prefix##fetch_fsub_##id);               \
+    }                                                                                                                \
+    while (0)
+
+#define PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(id)               \
+    PATOMIC_DEFINE_PROFILE_OPS(id, PATOMIC_DEFINE_PROFILE_)        \
+                                                                   \
+    static void                                                    \
+    patomic_profile_wrap_implicit_##id(                            \
+        patomic_ops_t *const ops,                                  \
+        const patomic_ops_t *const real                            \
+    )                                                              \
+    {                                                              \
+        PATOMIC_PROFILE_WRAP_OPS(ops, real, id, patomic_profile_); \
+    }
+
+#define PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(id)                        \
+    PATOMIC_DEFINE_PROFILE_OPS(id, PATOMIC_DEFINE_PROFILE_EXPLICIT_)        \
+                                                                            \
+    static void                                                             \
+    patomic_profile_wrap_explicit_##id(                                     \
+        patomic_ops_explicit_t *const ops,                                  \
+        const patomic_ops_explicit_t *const real                            \
+    )                                                                       \
+    {                                                                       \
+        PATOMIC_PROFILE_WRAP_OPS(ops, real, id, patomic_profile_explicit_); \
+    }
+
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(0)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(1)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(2)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(3)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(4)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(5)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(6)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(7)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(8)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(9)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(10)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(11)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(12)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(13)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(14)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(15)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(16)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(17)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(18)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(19)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(20)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(21)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(22)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(23)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(24)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(25)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(26)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(27)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(28)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(29)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(30)
+PATOMIC_DEFINE_PROFILE_IMPLICIT_INSTANCE(31)
+
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(0)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(1)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(2)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(3)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(4)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(5)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(6)
+PATOMIC_DEFINE_PROFILE_EXPLICIT_INSTANCE(7)
+
+typedef void (* patomic_profile_wrap_implicit_t) (
+    patomic_ops_t *ops,
+    const patomic_ops_t *real
+);
+
+typedef void (* patomic_profile_wrap_explicit_t) (
+    patomic_ops_explicit_t *ops,
+    const patomic_ops_explicit_t *real
+);
+
+static const patomic_profile_wrap_implicit_t
+patomic_profile_wrap_implicit[] = {
+    patomic_profile_wrap_implicit_0,  patomic_profile_wrap_implicit_1,
+    patomic_profile_wrap_implicit_2,  patomic_profile_wrap_implicit_3,
+    patomic_profile_wrap_implicit_4,  patomic_profile_wrap_implicit_5,
+    patomic_profile_wrap_implicit_6,  patomic_profile_wrap_implicit_7,
+    patomic_profile_wrap_implicit_8,  patomic_profile_wrap_implicit_9,
+    patomic_profile_wrap_implicit_10, patomic_profile_wrap_implicit_11,
+    patomic_profile_wrap_implicit_12, patomic_profile_wrap_implicit_13,
+    patomic_profile_wrap_implicit_14, patomic_profile_wrap_implicit_15,
+    patomic_profile_wrap_implicit_16, patomic_profile_wrap_implicit_17,
+    patomic_profile_wrap_implicit_18, patomic_profile_wrap_implicit_19,
+    patomic_profile_wrap_implicit_20, patomic_profile_wrap_implicit_21,
+    patomic_profile_wrap_implicit_22, patomic_profile_wrap_implicit_23,
+    patomic_profile_wrap_implicit_24, patomic_profile_wrap_implicit_25,
+    patomic_profile_wrap_implicit_26, patomic_profile_wrap_implicit_27,
+    patomic_profile_wrap_implicit_28, patomic_profile_wrap_implicit_29,
+    patomic_profile_wrap_implicit_30, patomic_profile_wrap_implicit_31
+};
+
+static const patomic_profile_wrap_explicit_t
+patomic_profile_wrap_explicit[] = {
+    patomic_profile_wrap_explicit_0, patomic_profile_wrap_explicit_1,
+    patomic_profile_wrap_explicit_2, patomic_profile_wrap_explicit_3,
+    patomic_profile_wrap_explicit_4, patomic_profile_wrap_explicit_5,
+    patomic_profile_wrap_explicit_6, patomic_profile_wrap_explicit_7
+};
+
+/* the public instance counts must match the number of instances defined */
+PATOMIC_STATIC_ASSERT(
+    profile_implicit_instance_count_matches,
+    sizeof(patomic_profile_wrap_implicit) ==
+        PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT *
+        sizeof(patomic_profile_wrap_implicit[0])
+);
+
+PATOMIC_STATIC_ASSERT(
+    profile_explicit_instance_count_matches,
+    sizeof(patomic_profile_wrap_explicit) ==
+        PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT *
+        sizeof(patomic_profile_wrap_explicit[0])
+);
+
+
+/*
+ * Finds an instance whose real operations compare equal to the given ops,
+ * otherwise claims a free instance and stores the given ops in it.
+ * Returns the instance index, or -1 if no instance is available.
+ */
+#define PATOMIC_PROFILE_FIND_OR_CLAIM(ops, instances, states, count, found) \
+    do {                                                                    \
+        int i_;                                                             \
+        int state_;                                                         \
+        found = -1;                                                         \
+        for (i_ = 0; i_ < (count) && found == -1; ++i_)                     \
+        {                                                                   \
+            state_ = atomic_load_explicit(                                  \
+                &states[i_], memory_order_acquire                           \
+            );                                                              \
+            if (state_ == PATOMIC_PROFILE_STATE_READY &&                    \
+                memcmp(&instances[i_], ops, sizeof(*ops)) == 0)             \
+            {                                                               \
+                found = i_;                                                 \
+            }                                                               \
+        }                                                                   \
+        for (i_ = 0; i_ < (count) && found == -1; ++i_)                     \
+        {                                                                   \
+            state_ = PATOMIC_PROFILE_STATE_FREE;                            \
+            if (atomic_compare_exchange_strong_explicit(                    \
+                &states[i_], &state_, PATOMIC_PROFILE_STATE_CLAIMED,        \
+                memory_order_relaxed, memory_order_relaxed                  \
+            ))                                                              \
+            {                                                               \
+                instances[i_] = *ops;                                       \
+                atomic_store_explicit(                                      \
+                    &states[i_], PATOMIC_PROFILE_STATE_READY,               \
+                    memory_order_release                                    \
+                );                                                          \
+                found = i_;                                                 \
+            }                                                               \
+        }                                                                   \
+    }                                                                       \
+    while (0)
+
+
+void
+patomic_internal_profile_wrap(
+    patomic_t *const obj
+)
+{
+    /* declarations */
+    const unsigned int opcats = patomic_opcats_IMPLICIT;
+    int id;
+
+    /* don't use up an instance if no operation is supported */
+    if (opcats == patomic_internal_feature_check_any(&obj->ops, opcats))
+    {
+        return;
+    }
+
+    /* replace ops with wrappers if an instance is available */
+    PATOMIC_PROFILE_FIND_OR_CLAIM(
+        &obj->ops,
+        patomic_profile_implicit,
+        patomic_profile_implicit_state,
+        PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT,
+        id
+    );
+    if (id != -1)
+    {
+        patomic_profile_wrap_implicit[id](&obj->ops, &patomic_profile_implicit[id]);
+    }
+}
+
+
+void
+patomic_internal_profile_wrap_explicit(
+    patomic_explicit_t *const obj
+)
+{
+    /* declarations */
+    const unsigned int opcats = patomic_opcats_EXPLICIT;
+    int id;
+
+    /* don't use up an instance if no operation is supported */
+    if (opcats == patomic_internal_feature_check_any_explicit(&obj->ops, opcats))
+    {
+        return;
+    }
+
+    /* replace ops with wrappers if an instance is available */
+    PATOMIC_PROFILE_FIND_OR_CLAIM(
+        &obj->ops,
+        patomic_profile_explicit,
+        patomic_profile_explicit_state,
+        PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT,
+        id
+    );
+    if (id != -1)
+    {
+        patomic_profile_wrap_explicit[id](&obj->ops, &patomic_profile_explicit[id]);
+    }
+}
+
+
+/*
+ * Finds a ready instance whose wrapped operations compare equal to the given
+ * ops, using tmp as scratch space. Returns the instance index, or -1 if
+ * there is no such instance.
+ */
+#define PATOMIC_PROFILE_FIND_WRAPPED(ops, tmp, instances, states, wrap, count, found) \
+    do {                                                                              \
+        int i_;                                                                       \
+        int state_;                                                                   \
+        found = -1;                                                                   \
+        for (i_ = 0; i_ < (count) && found == -1; ++i_)                               \
+        {                                                                             \
+            state_ = atomic_load_explicit(                                            \
+                &states[i_], memory_order_acquire                                     \
+            );                                                                        \
+            if (state_ == PATOMIC_PROFILE_STATE_READY)                                \
+            {                                                                         \
+                tmp = instances[i_];                                                  \
+                wrap[i_](&tmp, &instances[i_]);                                       \
+                if (memcmp(&tmp, ops, sizeof(*ops)) == 0)                             \
+                {                                                                     \
+                    found = i_;                                                       \
+                }                                                                     \
+            }                                                                         \
+        }                                                                             \
+    }                                                                                 \
+    while (0)
+
+
+int
+patomic_internal_profile_unwrap(
+    const patomic_ops_t *const ops,
+    patomic_ops_t *const unwrapped
+)
+{
+    /* declarations */
+    patomic_ops_t wrapped;
+    int id;
+
+    /* find instance which would produce these ops */
+    PATOMIC_PROFILE_FIND_WRAPPED(
+        ops, wrapped,
+        patomic_profile_implicit,
+        patomic_profile_implicit_state,
+        patomic_profile_wrap_implicit,
+        PATOMIC_PROFILE_IMPLICIT_INSTANCE_COUNT,
+        id
+    );
+    if (id == -1)
+    {
+        return 0;
+    }
+
+    /* output real ops */
+    *unwrapped = patomic_profile_implicit[id];
+    return 1;
+}
+
+
+int
+patomic_internal_profile_unwrap_explicit(
+    const patomic_ops_explicit_t *const ops,
+    patomic_ops_explicit_t *const unwrapped
+)
+{
+    /* declarations */
+    patomic_ops_explicit_t wrapped;
+    int id;
+
+    /* find instance which would produce these ops */
+    PATOMIC_PROFILE_FIND_WRAPPED(
+        ops, wrapped,
+        patomic_profile_explicit,
+        patomic_profile_explicit_state,
+        patomic_profile_wrap_explicit,
+        PATOMIC_PROFILE_EXPLICIT_INSTANCE_COUNT,
+        id
+    );
+    if (id == -1)
+    {
+        return 0;
+    }
+
+    /* output real ops */
+    *unwrapped = patomic_profile_explicit[id];
+    return 1;
+}
+
+
+int
+patomic_profile_is_supported(void)
+{
+    return 1;
+}
+
+
+patomic_profile_counters_t
+patomic_profile_snapshot(
+    const patomic_profile_slot_t slot
+)
+{
+    /* declarations */
+    patomic_profile_counters_t ret = {0};
+    unsigned int i;
+
+    /* check slot is valid */
+    if ((int) slot < 0 || (int) slot >= PATOMIC_PROFILE_SLOT_COUNT)
+    {
+        return ret;
+    }
+
+    /* sum counters from all shards */
+    for (i = 0; i < PATOMIC_PROFILE_SHARD_COUNT; ++i)
+    {
+        ret.calls += atomic_load_explicit(
+            &patomic_profile_shards[i].calls[slot], memory_order_relaxed
+        );
+        ret.failures += atomic_load_explicit(
+            &patomic_profile_shards[i].failures[slot], memory_order_relaxed
+        );
+    }
+
+    return ret;
+}
+
+
+void
+patomic_profile_set_sample_interval(
+    const unsigned int interval
+)
+{
+    atomic_store_explicit(
+        &patomic_profile_sample_interval, interval, memory_order_relaxed
+    );
+}
+
+
+/*
+ * Orders entries by failures, then by samples, most contended first.
+ */
+static int
+patomic_profile_is_hotter(
+    const patomic_profile_hot_address_abi_unstable_t *const lhs,
+    const patomic_profile_hot_address_abi_unstable_t *const rhs
+)
+{
+    if (lhs->failures != rhs->failures)
+    {
+        return lhs->failures > rhs->failures;
+    }
+    return lhs->samples > rhs->samples;
+}
+
+
+size_t
+patomic_profile_hot_addresses(
+    patomic_profile_hot_address_abi_unstable_t *const report,
+    const size_t count
+)
+{
+    /* declarations */
+    const unsigned int total =
+        PATOMIC_PROFILE_SHARD_COUNT * PATOMIC_PROFILE_SAMPLE_CAPACITY;
+    patomic_profile_hot_address_abi_unstable_t entry;
+    const patomic_profile_sample_t *sample;
+    unsigned int meta;
+    unsigned int i;
+    unsigned int j;
+    size_t len = 0;
+    size_t k;
+
+    /* go through each distinct sampled address */
+    for (i = 0; i < total && count != 0; ++i)
+    {
+        sample = &patomic_profile_shards[i / PATOMIC_PROFILE_SAMPLE_CAPACITY]
+            .samples[i % PATOMIC_PROFILE_SAMPLE_CAPACITY];
+        if (atomic_load_explicit(&sample->meta, memory_order_acquire) == 0u)
+        {
+            continue;
+        }
+        entry.address = atomic_load_explicit(
+            &sample->address, memory_order_relaxed
+        );
+        for (k = 0; k < len; ++k)
+        {
+            if (report[k].address == entry.address)
+            {
+                break;
+            }
+        }
+        if (k != len)
+        {
+            continue;
+        }
+
+        /* aggregate all samples with this address */
+        memset(entry.slot_samples, 0, sizeof entry.slot_samples);
+        entry.samples = 0ul;
+        entry.failures = 0ul;
+        for (j = i; j < total; ++j)
+        {
+            sample = &patomic_profile_shards[j / PATOMIC_PROFILE_SAMPLE_CAPACITY]
+                .samples[j % PATOMIC_PROFILE_SAMPLE_CAPACITY];
+            meta = atomic_load_explicit(&sample->meta, memory_order_acquire);
+            if (meta == 0u || entry.address != atomic_load_explicit(
+                &sample->address, memory_order_relaxed))
+            {
+                continue;
+            }
+            meta -= 1u;
+            entry.slot_samples[meta >> 1u] += 1ul;
+            entry.samples += 1ul;
+            entry.failures += (unsigned long) (meta & 1u);
+        }
+
+        /* insert into report if it is among the hottest so far */
+        for (k = len; k != 0 && patomic_profile_is_hotter(&entry, &report[k - 1]); --k)
+        {
+            if (k < count)
+            {
+                report[k] = report[k - 1];
+            }
+        }
+        if (k < count)
+        {
+            report[k] = entry;
+            if (len < count)
+            {
+                ++len;
+            }
+        }
+    }
+
+    return len;
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+void
+patomic_internal_profile_wrap(
+    patomic_t *const obj
+)
+{
+    /* profiling not supported; ops are left as is */
+    PATOMIC_IGNORE_UNUSED(obj);
+}
+
+
+void
+patomic_internal_profile_wrap_explicit(
+    patomic_explicit_t *const obj
+)
+{
+    /* profiling not supported; ops are left as is */
+    PATOMIC_IGNORE_UNUSED(obj);
+}
+
+
+int
+patomic_internal_profile_unwrap(
+    const patomic_ops_t *const ops,
+    patomic_ops_t *const unwrapped
+)
+{
+    /* profiling not supported; ops are never wrapped */
+    PATOMIC_IGNORE_UNUSED(ops);
+    PATOMIC_IGNORE_UNUSED(unwrapped);
+    return 0;
+}
+
+
+int
+patomic_internal_profile_unwrap_explicit(
+    const patomic_ops_explicit_t *const ops,
+    patomic_ops_explicit_t *const unwrapped
+)
+{
+    /* profiling not supported; ops are never wrapped */
+    PATOMIC_IGNORE_UNUSED(ops);
+    PATOMIC_IGNORE_UNUSED(unwrapped);
+    return 0;
+}
+
+
+int
+patomic_profile_is_supported(void)
+{
+    return 0;
+}
+
+
+patomic_profile_counters_t
+patomic_profile_snapshot(
+    const patomic_profile_slot_t slot
+)
+{
+    /* zero all fields */
+    patomic_profile_counters_t ret = {0};
+
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(slot);
+
+    /* return */
+    return ret;
+}
+
+
+void
+patomic_profile_set_sample_interval(
+    const unsigned int interval
+)
+{
+    /* sampling not supported */
+    PATOMIC_IGNORE_UNUSED(interval);
+}
+
+
+size_t
+patomic_profile_hot_addresses(
+    patomic_profile_hot_address_abi_unstable_t *const report,
+    const size_t count
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(report);
+    PATOMIC_IGNORE_UNUSED(count);
+
+    /* no samples */
+    return 0;
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+#if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM && PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+#include <patomic/stdlib/math.h>
+
+
+/*
+ * HISTOGRAMS:
+ * - widths are indexed by their log2, so only powers of 2 up to 16 are kept
+ * - sharded the same way as counters, but with fewer shards since each shard
+ *   is much larger
+ */
+#define PATOMIC_PROFILE_HISTOGRAM_WIDTH_COUNT 5
+
+#define PATOMIC_PROFILE_HISTOGRAM_SHARD_COUNT 16u
+
+typedef struct {
+    atomic_ulong buckets
+        [PATOMIC_PROFILE_SLOT_COUNT]
+        [PATOMIC_PROFILE_HISTOGRAM_WIDTH_COUNT]
+        [PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT];
+    unsigned char padding[PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE];
+} patomic_profile_histogram_shard_t;
+
+static patomic_profile_histogram_shard_t
+patomic_profile_histogram_shards[PATOMIC_PROFILE_HISTOGRAM_SHARD_COUNT];
+
+
+static int
+patomic_profile_width_index(
+    size_t byte_width
+)
+{
+    /* declarations */
+    int index = 0;
+
+    /* only powers of 2 are kept */
+    if (!patomic_unsigned_is_pow2(byte_width))
+    {
+        return -1;
+    }
+
+    /* log2 */
+    while (byte_width > 1u)
+    {
+        byte_width >>= 1u;
+        ++index;
+    }
+
+    return (index < PATOMIC_PROFILE_HISTOGRAM_WIDTH_COUNT) ? index : -1;
+}
+
+
+void
+patomic_internal_profile_record_cmpxchg(
+    const patomic_profile_slot_t slot,
+    const size_t byte_width,
+    unsigned long iterations
+)
+{
+    /* declarations */
+    const int width_index = patomic_profile_width_index(byte_width);
+    int bucket = 0;
+    patomic_profile_histogram_shard_t *shard;
+
+    /* ignore widths and slots we don't keep */
+    if (width_index < 0 || (int) slot < 0 || (int) slot >= PATOMIC_PROFILE_SLOT_COUNT)
+    {
+        return;
+    }
+
+    /* log2 bucket, saturating at the last bucket */
+    while (iterations > 1ul && bucket < PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT - 1)
+    {
+        iterations >>= 1u;
+        ++bucket;
+    }
+
+    /* record */
+    shard = &patomic_profile_histogram_shards[
+        patomic_internal_thread_index() % PATOMIC_PROFILE_HISTOGRAM_SHARD_COUNT
+    ];
+    atomic_fetch_add_explicit(
+        &shard->buckets[slot][width_index][bucket], 1ul, memory_order_relaxed
+    );
+}
+
+
+int
+patomic_profile_histogram_is_enabled(void)
+{
+    return 1;
+}
+
+
+patomic_profile_histogram_t
+patomic_profile_cmpxchg_histogram(
+    const patomic_profile_slot_t slot,
+    const size_t byte_width
+)
+{
+    /* declarations */
+    patomic_profile_histogram_t ret = {{0}};
+    const int width_index = patomic_profile_width_index(byte_width);
+    unsigned int i;
+    int bucket;
+
+    /* check slot and width are kept */
+    if (width_index < 0 || (int) slot < 0 || (int) slot >= PATOMIC_PROFILE_SLOT_COUNT)
+    {
+        return ret;
+    }
+
+    /* sum buckets from all shards */
+    for (i = 0; i < PATOMIC_PROFILE_HISTOGRAM_SHARD_COUNT; ++i)
+    {
+        for (bucket = 0; bucket < PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT; ++bucket)
+        {
+            ret.buckets[bucket] += atomic_load_explicit(
+                &patomic_profile_histogram_shards[i].buckets[slot][width_index][bucket],
+                memory_order_relaxed
+            );
+        }
+    }
+
+    return ret;
+}
+
+
+#else  /* PATOMIC_ENABLE_CMPXCHG_HISTOGRAM && PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+void
+patomic_internal_profile_record_cmpxchg(
+    const patomic_profile_slot_t slot,
+    const size_t byte_width,
+    const unsigned long iterations
+)
+{
+    /* recording not enabled */
+    PATOMIC_IGNORE_UNUSED(slot);
+    PATOMIC_IGNORE_UNUSED(byte_width);
+    PATOMIC_IGNORE_UNUSED(iterations);
+}
+
+
+int
+patomic_profile_histogram_is_enabled(void)
+{
+    return 0;
+}
+
+
+patomic_profile_histogram_t
+patomic_profile_cmpxchg_histogram(
+    const patomic_profile_slot_t slot,
+    const size_t byte_width
+)
+{
+    /* zero all fields */
+    patomic_profile_histogram_t ret = {{0}};
+
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(slot);
+    PATOMIC_IGNORE_UNUSED(byte_width);
+
+    /* return */
+    return ret;
+}
+
+
+#endif  /* PATOMIC_ENABLE_CMPXCHG_HISTOGRAM && PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
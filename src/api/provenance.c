@@ -0,0 +1,298 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/api/provenance.h>
+#include <patomic/internal/profile.h>
+
+#include <patomic/stdlib/assert.h>
+#include <patomic/stdlib/math.h>
+
+#include "../impl/register.h"
+
+
+/*
+ * Operations are only searched for at power of 2 byte widths up to and
+ * including this value.
+ */
+#define PATOMIC_PROVENANCE_MAX_BYTE_WIDTH ((size_t) 64)
+
+
+#define PATOMIC_PROVENANCE_MATCH(cat, kind, member)                      \
+    if (opcat == patomic_opcat_##cat && opkind == patomic_opkind_##kind) \
+    {                                                                    \
+        return lhs->member != NULL && lhs->member == rhs->member;        \
+    }
+
+
+/*
+ * Defines a function which checks if the operation for the given opcat and
+ * opkind is supported and is the same function in both sets of operations.
+ */
+#define PATOMIC_DEFINE_PROVENANCE_MATCHES(name, ops_type)                 \
+    static int                                                            \
+    name(                                                                 \
+        const ops_type *const lhs,                                        \
+        const ops_type *const rhs,                                        \
+        const patomic_opcat_t opcat,                                      \
+        const patomic_opkind_t opkind                                     \
+    )                                                                     \
+    {                                                                     \
+        /* ldst */                                                        \
+        PATOMIC_PROVENANCE_MATCH(LDST, LOAD, fp_load)                     \
+        PATOMIC_PROVENANCE_MATCH(LDST, STORE, fp_store)                   \
+                                                                          \
+        /* xchg */                                                        \
+        PATOMIC_PROVENANCE_MATCH(XCHG, EXCHANGE, xchg_ops.fp_exchange)    \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            XCHG, CMPXCHG_WEAK, xchg_ops.fp_cmpxchg_weak)                 \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            XCHG, CMPXCHG_STRONG, xchg_ops.fp_cmpxchg_strong)             \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            XCHG, FETCH_UPDATE, xchg_ops.fp_fetch_update)                 \
+                                                                          \
+        /* bitwise */                                                     \
+        PATOMIC_PROVENANCE_MATCH(BIT, TEST, bitwise_ops.fp_test)          \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BIT, TEST_COMPL, bitwise_ops.fp_test_compl)                   \
+        PATOMIC_PROVENANCE_MATCH(BIT, TEST_SET, bitwise_ops.fp_test_set)  \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BIT, TEST_RESET, bitwise_ops.fp_test_reset)                   \
+                                                                          \
+        /* binary */                                                      \
+        PATOMIC_PROVENANCE_MATCH(BIN_V, OR, binary_ops.fp_or)             \
+        PATOMIC_PROVENANCE_MATCH(BIN_V, XOR, binary_ops.fp_xor)           \
+        PATOMIC_PROVENANCE_MATCH(BIN_V, AND, binary_ops.fp_and)           \
+        PATOMIC_PROVENANCE_MATCH(BIN_V, NOT, binary_ops.fp_not)           \
+        PATOMIC_PROVENANCE_MATCH(BIN_F, OR, binary_ops.fp_fetch_or)       \
+        PATOMIC_PROVENANCE_MATCH(BIN_F, XOR, binary_ops.fp_fetch_xor)     \
+        PATOMIC_PROVENANCE_MATCH(BIN_F, AND, binary_ops.fp_fetch_and)     \
+        PATOMIC_PROVENANCE_MATCH(BIN_F, NOT, binary_ops.fp_fetch_not)     \
+                                                                          \
+        /* arithmetic */                                                  \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, ADD, arithmetic_ops.fp_add)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, SUB, arithmetic_ops.fp_sub)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, INC, arithmetic_ops.fp_inc)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, DEC, arithmetic_ops.fp_dec)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, NEG, arithmetic_ops.fp_neg)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, MIN, arithmetic_ops.fp_min)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, MAX, arithmetic_ops.fp_max)       \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, UMIN, arithmetic_ops.fp_umin)     \
+        PATOMIC_PROVENANCE_MATCH(ARI_V, UMAX, arithmetic_ops.fp_umax)     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_V, ADD_SAT, arithmetic_ops.fp_add_sat)                    \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_V, SUB_SAT, arithmetic_ops.fp_sub_sat)                    \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_V, UADD_SAT, arithmetic_ops.fp_uadd_sat)                  \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_V, USUB_SAT, arithmetic_ops.fp_usub_sat)                  \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, ADD, arithmetic_ops.fp_fetch_add) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, SUB, arithmetic_ops.fp_fetch_sub) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, INC, arithmetic_ops.fp_fetch_inc) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, DEC, arithmetic_ops.fp_fetch_dec) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, NEG, arithmetic_ops.fp_fetch_neg) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, MIN, arithmetic_ops.fp_fetch_min) \
+        PATOMIC_PROVENANCE_MATCH(ARI_F, MAX, arithmetic_ops.fp_fetch_max) \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, UMIN, arithmetic_ops.fp_fetch_umin)                    \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, UMAX, arithmetic_ops.fp_fetch_umax)                    \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, ADD_SAT, arithmetic_ops.fp_fetch_add_sat)              \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, SUB_SAT, arithmetic_ops.fp_fetch_sub_sat)              \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, UADD_SAT, arithmetic_ops.fp_fetch_uadd_sat)            \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            ARI_F, USUB_SAT, arithmetic_ops.fp_fetch_usub_sat)            \
+                                                                          \
+        /* wait */                                                        \
+        PATOMIC_PROVENANCE_MATCH(WAIT, WAIT, wait_ops.fp_wait)            \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            WAIT, WAIT_TIMED, wait_ops.fp_wait_timed)                     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            WAIT, NOTIFY_ONE, wait_ops.fp_notify_one)                     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            WAIT, NOTIFY_ALL, wait_ops.fp_notify_all)                     \
+                                                                          \
+        /* batch */                                                       \
+        PATOMIC_PROVENANCE_MATCH(BATCH_V, ADD_N, batch_ops.fp_add_n)      \
+        PATOMIC_PROVENANCE_MATCH(BATCH_V, SUB_N, batch_ops.fp_sub_n)      \
+        PATOMIC_PROVENANCE_MATCH(BATCH_V, OR_N, batch_ops.fp_or_n)        \
+        PATOMIC_PROVENANCE_MATCH(BATCH_V, XOR_N, batch_ops.fp_xor_n)      \
+        PATOMIC_PROVENANCE_MATCH(BATCH_V, AND_N, batch_ops.fp_and_n)      \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, ADD_N, batch_ops.fp_fetch_add_n)                     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, SUB_N, batch_ops.fp_fetch_sub_n)                     \
+        PATOMIC_PROVENANCE_MATCH(BATCH_F, OR_N, batch_ops.fp_fetch_or_n)  \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, XOR_N, batch_ops.fp_fetch_xor_n)                     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, AND_N, batch_ops.fp_fetch_and_n)                     \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, EXCHANGE_N, batch_ops.fp_exchange_n)                 \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, CMPXCHG_N, batch_ops.fp_cmpxchg_n)                   \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_V, STORE_ARRAY, batch_ops.fp_store_array)               \
+        PATOMIC_PROVENANCE_MATCH(                                         \
+            BATCH_F, LOAD_ARRAY, batch_ops.fp_load_array)                 \
+                                                                          \
+        /* float */                                                       \
+        PATOMIC_PROVENANCE_MATCH(FLT_V, FADD, float_ops.fp_add)           \
+        PATOMIC_PROVENANCE_MATCH(FLT_V, FSUB, float_ops.fp_sub)           \
+        PATOMIC_PROVENANCE_MATCH(FLT_F, FADD, float_ops.fp_fetch_add)     \
+        PATOMIC_PROVENANCE_MATCH(FLT_F, FSUB, float_ops.fp_fetch_sub)     \
+                                                                          \
+        /* unsupported or invalid combination */                          \
+        return 0;                                                         \
+    }
+
+PATOMIC_DEFINE_PROVENANCE_MATCHES(
+    patomic_provenance_matches, patomic_ops_t
+)
+
+PATOMIC_DEFINE_PROVENANCE_MATCHES(
+    patomic_provenance_matches_explicit, patomic_ops_explicit_t
+)
+
+
+static patomic_provenance_t
+patomic_provenance_create(
+    const patomic_impl_t *const impl,
+    const size_t byte_width,
+    const patomic_opcat_t opcat,
+    const patomic_opkind_t opkind
+)
+{
+    /* declarations */
+    patomic_provenance_t ret = {0};
+    unsigned int emulated;
+
+    /* set members */
+    ret.id = impl->id;
+    ret.kind = impl->kind;
+    ret.byte_width = byte_width;
+    ret.method = patomic_method_UNKN;
+    if (impl->fp_emulated_opkinds != NULL)
+    {
+        emulated = impl->fp_emulated_opkinds(byte_width, opcat);
+        ret.method = (emulated & (unsigned int) opkind)
+            ? patomic_method_CMPXCHG_LOOP
+            : patomic_method_DIRECT;
+    }
+
+    /* return */
+    return ret;
+}
+
+
+patomic_provenance_t
+patomic_describe(
+    const patomic_t *const obj,
+    const patomic_opcat_t opcat,
+    const patomic_opkind_t opkind
+)
+{
+    /* declarations */
+    static const patomic_memory_order_t orders[] = {
+        patomic_RELAXED, patomic_CONSUME, patomic_ACQUIRE,
+        patomic_RELEASE, patomic_ACQ_REL, patomic_SEQ_CST
+    };
+    patomic_provenance_t ret = {0};
+    patomic_ops_t ops;
+    patomic_t candidate;
+    size_t byte_width;
+    size_t i;
+    size_t j;
+    int is_profiled;
+
+    /* assertions */
+    patomic_assert_always(obj != NULL);
+    patomic_assert_always(patomic_unsigned_is_pow2(opcat));
+    patomic_assert_always(patomic_unsigned_is_pow2(opkind));
+
+    /* look through profiling wrappers */
+    ops = obj->ops;
+    is_profiled = patomic_internal_profile_unwrap(&obj->ops, &ops);
+
+    /* find implementation which creates the same operation */
+    for (i = 0; i < PATOMIC_IMPL_REGISTER_SIZE; ++i)
+    {
+        for (byte_width = 1; byte_width <= PATOMIC_PROVENANCE_MAX_BYTE_WIDTH;
+             byte_width *= 2)
+        {
+            for (j = 0; j < (sizeof orders / sizeof orders[0]); ++j)
+            {
+                candidate = patomic_impl_register[i].fp_create(
+                    byte_width, orders[j], 0u
+                );
+                if (patomic_provenance_matches(
+                    &ops, &candidate.ops, opcat, opkind))
+                {
+                    ret = patomic_provenance_create(
+                        &patomic_impl_register[i], byte_width, opcat, opkind
+                    );
+                    ret.is_profiled = is_profiled;
+                    return ret;
+                }
+            }
+        }
+    }
+
+    /* not found */
+    ret.is_profiled = is_profiled;
+    return ret;
+}
+
+
+patomic_provenance_t
+patomic_describe_explicit(
+    const patomic_explicit_t *const obj,
+    const patomic_opcat_t opcat,
+    const patomic_opkind_t opkind
+)
+{
+    /* declarations */
+    patomic_provenance_t ret = {0};
+    patomic_ops_explicit_t ops;
+    patomic_explicit_t candidate;
+    size_t byte_width;
+    size_t i;
+    int is_profiled;
+
+    /* assertions */
+    patomic_assert_always(obj != NULL);
+    patomic_assert_always(patomic_unsigned_is_pow2(opcat));
+    patomic_assert_always(patomic_unsigned_is_pow2(opkind));
+
+    /* look through profiling wrappers */
+    ops = obj->ops;
+    is_profiled = patomic_internal_profile_unwrap_explicit(&obj->ops, &ops);
+
+    /* find implementation which creates the same operation */
+    for (i = 0; i < PATOMIC_IMPL_REGISTER_SIZE; ++i)
+    {
+        for (byte_width = 1; byte_width <= PATOMIC_PROVENANCE_MAX_BYTE_WIDTH;
+             byte_width *= 2)
+        {
+            candidate = patomic_impl_register[i].fp_create_explicit(
+                byte_width, 0u
+            );
+            if (patomic_provenance_matches_explicit(
+                &ops, &candidate.ops, opcat, opkind))
+            {
+                ret = patomic_provenance_create(
+                    &patomic_impl_register[i], byte_width, opcat, opkind
+                );
+                ret.is_profiled = is_profiled;
+                return ret;
+            }
+        }
+    }
+
+    /* not found */
+    ret.is_profiled = is_profiled;
+    return ret;
+}
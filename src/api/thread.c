@@ -0,0 +1,47 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#include <patomic/internal/thread.h>
+
+#include <patomic/config.h>
+
+#include <patomic/macros/thread_local.h>
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && !PATOMIC_THREAD_LOCAL_IS_EMPTY
+
+
+#include <stdatomic.h>
+
+
+static atomic_uint patomic_next_thread_index;
+
+static PATOMIC_THREAD_LOCAL unsigned int patomic_thread_index_plus_one;
+
+
+unsigned int
+patomic_internal_thread_index(void)
+{
+    /* index is offset by 1 so that zero means unassigned */
+    if (patomic_thread_index_plus_one == 0u)
+    {
+        patomic_thread_index_plus_one = 1u + atomic_fetch_add_explicit(
+            &patomic_next_thread_index, 1u, memory_order_relaxed
+        );
+    }
+    return patomic_thread_index_plus_one - 1u;
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && !PATOMIC_THREAD_LOCAL_IS_EMPTY */
+
+
+unsigned int
+patomic_internal_thread_index(void)
+{
+    /* all threads share a single index */
+    return 0u;
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && !PATOMIC_THREAD_LOCAL_IS_EMPTY */
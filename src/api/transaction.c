@@ -2,6 +2,20 @@
 /* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
 
 #include <patomic/api/transaction.h>
+#include <patomic/internal/bulk.h>
+#include <patomic/internal/thread.h>
+#include <patomic/internal/transaction.h>
+
+#include <patomic/config.h>
+
+#include <patomic/macros/ignore_unused.h>
+
+#include <patomic/stdlib/assert.h>
+#include <patomic/stdlib/stdint.h>
+
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
 
 
 patomic_transaction_exit_code_t
@@ -29,3 +43,525 @@ patomic_transaction_status_abort_reason(
 {
     return PATOMIC_TRANSACTION_STATUS_ABORT_REASON(status);
 }
+
+
+/*
+ * KERNELS:
+ * - if both buffers have the same alignment relative to a vector or word, the
+ *   bulk is accessed with aligned vectors or words
+ * - the head and tail, and buffers with different alignments, are accessed one
+ *   byte at a time
+ * - all accesses are volatile so that the compiler cannot replace them with
+ *   calls to memcpy or memcmp, which may cause a transaction to abort
+ */
+#if PATOMIC_STDINT_HAS_LLONG
+    typedef patomic_llong_unsigned_t patomic_transaction_word_t;
+#else
+    typedef unsigned long patomic_transaction_word_t;
+#endif
+
+#if PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+    #include <immintrin.h>
+#endif
+
+
+static size_t
+patomic_transaction_kernel_head(
+    const volatile unsigned char *const lhs,
+    const volatile unsigned char *const rhs,
+    const size_t count,
+    const size_t align
+)
+{
+    /* declarations */
+    const size_t lhs_misalign =
+        (size_t) (((patomic_intptr_unsigned_t) lhs) % align);
+    const size_t rhs_misalign =
+        (size_t) (((patomic_intptr_unsigned_t) rhs) % align);
+    size_t head;
+
+    /* buffers can never both be aligned at the same time */
+    if (lhs_misalign != rhs_misalign)
+    {
+        return count;
+    }
+
+    /* bytes before both buffers are aligned */
+    head = (lhs_misalign == 0) ? 0 : (align - lhs_misalign);
+    return (head < count) ? head : count;
+}
+
+
+void
+patomic_internal_transaction_memcpy(
+    volatile void *const dest,
+    const volatile void *const src,
+    const size_t count
+)
+{
+    /* declarations */
+    volatile unsigned char *const uc_dest = (volatile unsigned char *) dest;
+    const volatile unsigned char *const uc_src =
+        (const volatile unsigned char *) src;
+    const size_t word_size = sizeof(patomic_transaction_word_t);
+    size_t head;
+    size_t end;
+    size_t i = 0;
+
+#if PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+    /* vectors, preceded by head bytes */
+    head = patomic_transaction_kernel_head(
+        uc_dest, uc_src, count, PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+    );
+    end = head + (((count - head) / PATOMIC_INTERNAL_BULK_VECTOR_SIZE)
+                  * PATOMIC_INTERNAL_BULK_VECTOR_SIZE);
+    for (; i < head; ++i)
+    {
+        uc_dest[i] = uc_src[i];
+    }
+    for (; i < end; i += PATOMIC_INTERNAL_BULK_VECTOR_SIZE)
+    {
+        const __m128i v = *((const volatile __m128i *) (uc_src + i));
+        *((volatile __m128i *) (uc_dest + i)) = v;
+    }
+#endif
+
+    /* words, preceded by head bytes */
+    head = i + patomic_transaction_kernel_head(
+        uc_dest + i, uc_src + i, count - i, word_size
+    );
+    end = head + (((count - head) / word_size) * word_size);
+    for (; i < head; ++i)
+    {
+        uc_dest[i] = uc_src[i];
+    }
+    for (; i < end; i += word_size)
+    {
+        *((volatile patomic_transaction_word_t *) (uc_dest + i)) =
+            *((const volatile patomic_transaction_word_t *) (uc_src + i));
+    }
+
+    /* tail bytes */
+    for (; i < count; ++i)
+    {
+        uc_dest[i] = uc_src[i];
+    }
+}
+
+
+int
+patomic_internal_transaction_memcmp(
+    const volatile void *const lhs,
+    const volatile void *const rhs,
+    const size_t count
+)
+{
+    /* declarations */
+    const volatile unsigned char *const uc_lhs =
+        (const volatile unsigned char *) lhs;
+    const volatile unsigned char *const uc_rhs =
+        (const volatile unsigned char *) rhs;
+    const size_t word_size = sizeof(patomic_transaction_word_t);
+    size_t head;
+    size_t end;
+    size_t i = 0;
+
+    /* bulk loops stop at the first differing vector or word, leaving its
+     * bytes to be compared individually */
+#if PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+    /* vectors, preceded by head bytes */
+    head = patomic_transaction_kernel_head(
+        uc_lhs, uc_rhs, count, PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+    );
+    end = head + (((count - head) / PATOMIC_INTERNAL_BULK_VECTOR_SIZE)
+                  * PATOMIC_INTERNAL_BULK_VECTOR_SIZE);
+    for (; i < head && uc_lhs[i] == uc_rhs[i]; ++i) {}
+    for (; i >= head && i < end; i += PATOMIC_INTERNAL_BULK_VECTOR_SIZE)
+    {
+        const __m128i a = *((const volatile __m128i *) (uc_lhs + i));
+        const __m128i b = *((const volatile __m128i *) (uc_rhs + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF)
+        {
+            break;
+        }
+    }
+#endif
+
+    /* words, preceded by head bytes */
+    head = i + patomic_transaction_kernel_head(
+        uc_lhs + i, uc_rhs + i, count - i, word_size
+    );
+    end = head + (((count - head) / word_size) * word_size);
+    for (; i < head && uc_lhs[i] == uc_rhs[i]; ++i) {}
+    for (; i >= head && i < end; i += word_size)
+    {
+        const patomic_transaction_word_t a =
+            *((const volatile patomic_transaction_word_t *) (uc_lhs + i));
+        const patomic_transaction_word_t b =
+            *((const volatile patomic_transaction_word_t *) (uc_rhs + i));
+        if (a != b)
+        {
+            break;
+        }
+    }
+
+    /* remaining bytes, including any differing word or vector */
+    for (; i < count; ++i)
+    {
+        const unsigned char a = uc_lhs[i];
+        const unsigned char b = uc_rhs[i];
+        if (a != b)
+        {
+            return (a < b) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ * POLICY:
+ * - explicit aborts are never retried, since they are either requested by the
+ *   user or caused by a set flag
+ * - capacity and debug aborts are only retried if the implementation hints
+ *   that a retry may succeed
+ * - conflict aborts are retried after an exponential backoff
+ * - the adaptive budget is only updated with atomics, so it is never updated
+ *   if they are not available
+ */
+#define PATOMIC_TRANSACTION_POLICY_MAX_BACKOFF_SHIFT 10ul
+
+
+void
+patomic_transaction_policy_init(
+    patomic_transaction_policy_t *const policy,
+    const unsigned long max_attempts,
+    const unsigned long backoff_spins
+)
+{
+    /* assertions */
+    patomic_assert(policy != NULL);
+
+    /* budget starts at its upper bound */
+    policy->max_attempts = (max_attempts == 0ul) ? 1ul : max_attempts;
+    policy->backoff_spins = backoff_spins;
+    policy->adaptive_attempts = policy->max_attempts;
+}
+
+
+static void
+patomic_transaction_policy_backoff(
+    const patomic_transaction_policy_t *const policy,
+    const unsigned long attempts_made
+)
+{
+    /* declarations */
+    unsigned long shift = (attempts_made == 0ul) ? 0ul : (attempts_made - 1ul);
+    unsigned long spins;
+    volatile unsigned long spin = 0ul;
+
+    /* double the backoff for each consecutive attempt, saturating */
+    if (shift > PATOMIC_TRANSACTION_POLICY_MAX_BACKOFF_SHIFT)
+    {
+        shift = PATOMIC_TRANSACTION_POLICY_MAX_BACKOFF_SHIFT;
+    }
+    spins = policy->backoff_spins;
+    spins = (spins > (ULONG_MAX >> shift)) ? ULONG_MAX : (spins << shift);
+
+    /* volatile counter stops the loop from being optimized out */
+    while (spin < spins)
+    {
+        ++spin;
+    }
+}
+
+
+int
+patomic_transaction_policy_retry(
+    const patomic_transaction_policy_t *const policy,
+    const unsigned long status,
+    const unsigned long attempts_made
+)
+{
+    /* declarations */
+    const unsigned int info = PATOMIC_TRANSACTION_STATUS_EXIT_INFO(status);
+
+    /* without a policy, all attempts are made */
+    if (policy == NULL)
+    {
+        return 1;
+    }
+
+    /* decide based on exit code */
+    switch (PATOMIC_TRANSACTION_STATUS_EXIT_CODE(status))
+    {
+        case patomic_TSUCCESS:
+        case patomic_TABORT_EXPLICIT:
+            return 0;
+        case patomic_TABORT_CAPACITY:
+        case patomic_TABORT_DEBUG:
+            return (info & (unsigned int) patomic_TINFO_RETRY) != 0u;
+        case patomic_TABORT_CONFLICT:
+            patomic_transaction_policy_backoff(policy, attempts_made);
+            return 1;
+        case patomic_TABORT_UNKNOWN:
+        default:
+            return 1;
+    }
+}
+
+
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+
+
+#include <patomic/api/align.h>
+
+#include <stdatomic.h>
+
+
+/*
+ * STATS:
+ * - each thread uses the shard at its index modulo the shard count
+ * - shards are padded so that no two shards share a cache line
+ * - if there are more threads than shards, threads share shards
+ */
+#define PATOMIC_TRANSACTION_STATS_SHARD_COUNT 16u
+
+typedef struct {
+    atomic_ulong calls;
+    atomic_ulong attempts_made;
+    atomic_ulong fallback_calls;
+    atomic_ulong fallback_attempts_made;
+    atomic_ulong exit_codes[256];
+    atomic_ulong exit_info[8];
+    atomic_ulong abort_reasons[256];
+    unsigned char padding[PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE];
+} patomic_transaction_stats_shard_t;
+
+static patomic_transaction_stats_shard_t
+patomic_transaction_stats_shards[PATOMIC_TRANSACTION_STATS_SHARD_COUNT];
+
+
+void
+patomic_internal_transaction_stats_record(
+    const unsigned long status,
+    const unsigned long attempts_made,
+    const int is_fallback
+)
+{
+    /* declarations */
+    patomic_transaction_stats_shard_t *const shard =
+        &patomic_transaction_stats_shards[
+            patomic_internal_thread_index() % PATOMIC_TRANSACTION_STATS_SHARD_COUNT
+        ];
+    const patomic_transaction_exit_code_t code =
+        PATOMIC_TRANSACTION_STATUS_EXIT_CODE(status);
+    const unsigned int info = PATOMIC_TRANSACTION_STATUS_EXIT_INFO(status);
+    unsigned int i;
+
+    /* path */
+    if (is_fallback)
+    {
+        atomic_fetch_add_explicit(&shard->fallback_calls, 1ul, memory_order_relaxed);
+        atomic_fetch_add_explicit(
+            &shard->fallback_attempts_made, attempts_made, memory_order_relaxed
+        );
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&shard->calls, 1ul, memory_order_relaxed);
+        atomic_fetch_add_explicit(
+            &shard->attempts_made, attempts_made, memory_order_relaxed
+        );
+    }
+
+    /* decoded status */
+    atomic_fetch_add_explicit(
+        &shard->exit_codes[(unsigned int) code], 1ul, memory_order_relaxed
+    );
+    for (i = 0; i < 8u; ++i)
+    {
+        if (info & (1u << i))
+        {
+            atomic_fetch_add_explicit(
+                &shard->exit_info[i], 1ul, memory_order_relaxed
+            );
+        }
+    }
+    if (code == patomic_TABORT_EXPLICIT)
+    {
+        atomic_fetch_add_explicit(
+            &shard->abort_reasons[PATOMIC_TRANSACTION_STATUS_ABORT_REASON(status)],
+            1ul, memory_order_relaxed
+        );
+    }
+}
+
+
+#define PATOMIC_TRANSACTION_STATS_LOAD(shard, member) \
+    atomic_load_explicit(&(shard)->member, memory_order_relaxed)
+
+void
+patomic_transaction_stats_snapshot(
+    patomic_transaction_stats_t *const stats
+)
+{
+    /* declarations */
+    const patomic_transaction_stats_shard_t *shard;
+    unsigned int i;
+    unsigned int j;
+
+    /* assertions */
+    patomic_assert(stats != NULL);
+
+    /* sum counters from all shards */
+    memset(stats, 0, sizeof(*stats));
+    for (i = 0; i < PATOMIC_TRANSACTION_STATS_SHARD_COUNT; ++i)
+    {
+        shard = &patomic_transaction_stats_shards[i];
+        stats->calls += PATOMIC_TRANSACTION_STATS_LOAD(shard, calls);
+        stats->attempts_made += PATOMIC_TRANSACTION_STATS_LOAD(shard, attempts_made);
+        stats->fallback_calls += PATOMIC_TRANSACTION_STATS_LOAD(shard, fallback_calls);
+        stats->fallback_attempts_made +=
+            PATOMIC_TRANSACTION_STATS_LOAD(shard, fallback_attempts_made);
+        for (j = 0; j < 256u; ++j)
+        {
+            stats->exit_codes[j] += PATOMIC_TRANSACTION_STATS_LOAD(shard, exit_codes[j]);
+            stats->abort_reasons[j] +=
+                PATOMIC_TRANSACTION_STATS_LOAD(shard, abort_reasons[j]);
+        }
+        for (j = 0; j < 8u; ++j)
+        {
+            stats->exit_info[j] += PATOMIC_TRANSACTION_STATS_LOAD(shard, exit_info[j]);
+        }
+    }
+}
+
+
+#define PATOMIC_TRANSACTION_POLICY_BUDGET(policy) \
+    ((volatile _Atomic(unsigned long) *) &(policy)->adaptive_attempts)
+
+
+unsigned long
+patomic_transaction_policy_attempts(
+    const patomic_transaction_policy_t *const policy,
+    const unsigned long attempts
+)
+{
+    /* declarations */
+    unsigned long budget;
+
+    /* without a policy, all attempts are made */
+    if (policy == NULL)
+    {
+        return attempts;
+    }
+
+    /* limit to adaptive budget */
+    budget = atomic_load_explicit(
+        PATOMIC_TRANSACTION_POLICY_BUDGET(policy), memory_order_relaxed
+    );
+    return (budget < attempts) ? budget : attempts;
+}
+
+
+void
+patomic_transaction_policy_record(
+    patomic_transaction_policy_t *const policy,
+    const unsigned long status
+)
+{
+    /* declarations */
+    unsigned long budget;
+    unsigned long desired;
+
+    /* explicit aborts say nothing about whether attempts are worthwhile */
+    if (policy == NULL ||
+        PATOMIC_TRANSACTION_STATUS_EXIT_CODE(status) == patomic_TABORT_EXPLICIT)
+    {
+        return;
+    }
+
+    /* grow by one on success, halve on failure */
+    budget = atomic_load_explicit(
+        PATOMIC_TRANSACTION_POLICY_BUDGET(policy), memory_order_relaxed
+    );
+    do {
+        if (status == 0ul)
+        {
+            desired = (budget < policy->max_attempts) ? (budget + 1ul) : budget;
+        }
+        else
+        {
+            desired = (budget > 1ul) ? (budget / 2ul) : 1ul;
+        }
+        if (desired == budget)
+        {
+            return;
+        }
+    }
+    while (!atomic_compare_exchange_weak_explicit(
+        PATOMIC_TRANSACTION_POLICY_BUDGET(policy), &budget, desired,
+        memory_order_relaxed, memory_order_relaxed
+    ));
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
+
+
+void
+patomic_internal_transaction_stats_record(
+    const unsigned long status,
+    const unsigned long attempts_made,
+    const int is_fallback
+)
+{
+    /* stats not supported */
+    PATOMIC_IGNORE_UNUSED(status);
+    PATOMIC_IGNORE_UNUSED(attempts_made);
+    PATOMIC_IGNORE_UNUSED(is_fallback);
+}
+
+
+void
+patomic_transaction_stats_snapshot(
+    patomic_transaction_stats_t *const stats
+)
+{
+    /* assertions */
+    patomic_assert(stats != NULL);
+
+    /* nothing is recorded */
+    memset(stats, 0, sizeof(*stats));
+}
+
+
+unsigned long
+patomic_transaction_policy_attempts(
+    const patomic_transaction_policy_t *const policy,
+    const unsigned long attempts
+)
+{
+    /* budget is never updated, so it stays at its upper bound */
+    if (policy == NULL || policy->max_attempts >= attempts)
+    {
+        return attempts;
+    }
+    return policy->max_attempts;
+}
+
+
+void
+patomic_transaction_policy_record(
+    patomic_transaction_policy_t *const policy,
+    const unsigned long status
+)
+{
+    /* budget not supported */
+    PATOMIC_IGNORE_UNUSED(policy);
+    PATOMIC_IGNORE_UNUSED(status);
+}
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H */
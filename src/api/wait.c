@@ -0,0 +1,315 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+/* needed for syscall and clock_gettime, must precede all system headers */
+#ifndef _DEFAULT_SOURCE
+    #define _DEFAULT_SOURCE 1
+#endif
+
+#include <patomic/internal/wait.h>
+
+#include <patomic/config.h>
+
+#include <patomic/macros/ignore_unused.h>
+
+#include <patomic/stdlib/assert.h>
+
+
+#if PATOMIC_INTERNAL_WAIT_IS_SUPPORTED
+
+
+#include <patomic/api/align.h>
+
+#include <patomic/macros/static_assert.h>
+
+#include <patomic/stdlib/stdalign.h>
+#include <patomic/stdlib/stdint.h>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#include <limits.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/*
+ * BUCKETS:
+ * - each object hashes to a bucket based on its address
+ * - waiters are counted so that notify can skip the syscall if there are none
+ * - objects which are not waited on directly wait on the bucket's epoch, which
+ *   is incremented by every notify on any object using that bucket
+ * - buckets are padded so that no two buckets share a cache line
+ */
+#define PATOMIC_WAIT_BUCKET_COUNT 64u
+
+typedef struct {
+    atomic_uint epoch;
+    atomic_uint waiters;
+    unsigned char padding[PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE];
+} patomic_wait_bucket_t;
+
+static patomic_wait_bucket_t patomic_wait_buckets[PATOMIC_WAIT_BUCKET_COUNT];
+
+/* the kernel operates on 32-bit futex words */
+PATOMIC_STATIC_ASSERT(
+    futex_word_is_32_bit, sizeof(atomic_uint) == 4 && sizeof(unsigned int) == 4
+);
+
+
+static patomic_wait_bucket_t *
+patomic_wait_bucket(
+    const volatile void *const obj
+)
+{
+    /* mix in higher bits so that objects in nearby cache lines spread out */
+    const patomic_intptr_unsigned_t addr = (patomic_intptr_unsigned_t) obj;
+    const patomic_intptr_unsigned_t hash = (addr >> 3u) ^ (addr >> 9u);
+    return &patomic_wait_buckets[hash % PATOMIC_WAIT_BUCKET_COUNT];
+}
+
+
+static int
+patomic_wait_is_direct(
+    const volatile void *const obj,
+    const size_t byte_width
+)
+{
+    return byte_width == sizeof(unsigned int) &&
+           patomic_is_aligned(obj, sizeof(unsigned int));
+}
+
+
+static void
+patomic_wait_futex(
+    const volatile void *const addr,
+    const int op,
+    const unsigned int val,
+    const struct timespec *const timeout
+)
+{
+    /* errors (EAGAIN, EINTR, ETIMEDOUT) are handled by the caller re-checking */
+    PATOMIC_IGNORE_UNUSED(syscall(SYS_futex, addr, op, val, timeout, NULL, 0));
+}
+
+
+static void
+patomic_wait_make_deadline(
+    const unsigned long timeout_us,
+    struct timespec *const deadline
+)
+{
+    /* get current time */
+    const int err = clock_gettime(CLOCK_MONOTONIC, deadline);
+    patomic_assert_always(err == 0);
+
+    /* add timeout */
+    deadline->tv_sec += (time_t) (timeout_us / 1000000ul);
+    deadline->tv_nsec += (long) ((timeout_us % 1000000ul) * 1000ul);
+    if (deadline->tv_nsec >= 1000000000l)
+    {
+        deadline->tv_sec += 1;
+        deadline->tv_nsec -= 1000000000l;
+    }
+}
+
+
+static int
+patomic_wait_make_remaining(
+    const struct timespec *const deadline,
+    struct timespec *const remaining
+)
+{
+    /* get current time */
+    struct timespec now;
+    const int err = clock_gettime(CLOCK_MONOTONIC, &now);
+    patomic_assert_always(err == 0);
+
+    /* check if deadline has passed */
+    if (now.tv_sec > deadline->tv_sec ||
+        (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec))
+    {
+        return 0;
+    }
+
+    /* compute difference */
+    remaining->tv_sec = deadline->tv_sec - now.tv_sec;
+    remaining->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+    if (remaining->tv_nsec < 0)
+    {
+        remaining->tv_sec -= 1;
+        remaining->tv_nsec += 1000000000l;
+    }
+    return 1;
+}
+
+
+int
+patomic_internal_wait(
+    const volatile void *const obj,
+    const void *const old,
+    const size_t byte_width,
+    const int order,
+    const patomic_internal_wait_differs_t differs,
+    const unsigned long *const timeout_us
+)
+{
+    /* declarations */
+    patomic_wait_bucket_t *const bucket = patomic_wait_bucket(obj);
+    const int is_direct = patomic_wait_is_direct(obj, byte_width);
+    struct timespec deadline;
+    struct timespec remaining;
+    const struct timespec *futex_timeout = NULL;
+    unsigned int expected = 0;
+    unsigned int epoch;
+    int result;
+
+    /* fast path */
+    if (differs(obj, old, order))
+    {
+        return 1;
+    }
+
+    /* setup */
+    if (timeout_us != NULL)
+    {
+        patomic_wait_make_deadline(*timeout_us, &deadline);
+    }
+    if (is_direct)
+    {
+        memcpy(&expected, old, sizeof(expected));
+    }
+
+    /* notify may skip waking if it does not observe any waiters */
+    atomic_fetch_add_explicit(&bucket->waiters, 1u, memory_order_seq_cst);
+
+    /* block until value changes or timeout elapses */
+    for (;;)
+    {
+        /* epoch must be read before the value is checked */
+        epoch = atomic_load_explicit(&bucket->epoch, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (differs(obj, old, order))
+        {
+            result = 1;
+            break;
+        }
+
+        /* refresh timeout */
+        if (timeout_us != NULL)
+        {
+            if (!patomic_wait_make_remaining(&deadline, &remaining))
+            {
+                result = 0;
+                break;
+            }
+            futex_timeout = &remaining;
+        }
+
+        /* kernel only blocks if the futex word still holds the expected value */
+        if (is_direct)
+        {
+            patomic_wait_futex(obj, FUTEX_WAIT_PRIVATE, expected, futex_timeout);
+        }
+        else
+        {
+            patomic_wait_futex(
+                &bucket->epoch, FUTEX_WAIT_PRIVATE, epoch, futex_timeout
+            );
+        }
+    }
+
+    /* cleanup */
+    atomic_fetch_sub_explicit(&bucket->waiters, 1u, memory_order_relaxed);
+    return result;
+}
+
+
+void
+patomic_internal_notify(
+    const volatile void *const obj,
+    const size_t byte_width,
+    const int notify_all
+)
+{
+    /* declarations */
+    patomic_wait_bucket_t *const bucket = patomic_wait_bucket(obj);
+    const int is_direct = patomic_wait_is_direct(obj, byte_width);
+
+    /* waiters must be read after the modification to the object */
+    if (is_direct)
+    {
+        atomic_thread_fence(memory_order_seq_cst);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&bucket->epoch, 1u, memory_order_seq_cst);
+    }
+    if (atomic_load_explicit(&bucket->waiters, memory_order_seq_cst) == 0u)
+    {
+        return;
+    }
+
+    /* a bucket's epoch is shared by many objects, so wake all its waiters */
+    if (is_direct)
+    {
+        patomic_wait_futex(
+            obj, FUTEX_WAKE_PRIVATE, notify_all ? (unsigned int) INT_MAX : 1u, NULL
+        );
+    }
+    else
+    {
+        patomic_wait_futex(
+            &bucket->epoch, FUTEX_WAKE_PRIVATE, (unsigned int) INT_MAX, NULL
+        );
+    }
+}
+
+
+#else  /* PATOMIC_INTERNAL_WAIT_IS_SUPPORTED */
+
+
+int
+patomic_internal_wait(
+    const volatile void *const obj,
+    const void *const old,
+    const size_t byte_width,
+    const int order,
+    const patomic_internal_wait_differs_t differs,
+    const unsigned long *const timeout_us
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(obj);
+    PATOMIC_IGNORE_UNUSED(old);
+    PATOMIC_IGNORE_UNUSED(byte_width);
+    PATOMIC_IGNORE_UNUSED(order);
+    PATOMIC_IGNORE_UNUSED(differs);
+    PATOMIC_IGNORE_UNUSED(timeout_us);
+
+    /* no operations are provided which call this */
+    patomic_assert_always("wait is not supported" && 0);
+    return 0;
+}
+
+
+void
+patomic_internal_notify(
+    const volatile void *const obj,
+    const size_t byte_width,
+    const int notify_all
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(obj);
+    PATOMIC_IGNORE_UNUSED(byte_width);
+    PATOMIC_IGNORE_UNUSED(notify_all);
+
+    /* no operations are provided which call this */
+    patomic_assert_always("notify is not supported" && 0);
+}
+
+
+#endif  /* PATOMIC_INTERNAL_WAIT_IS_SUPPORTED */
@@ -226,6 +226,23 @@ patomic_impl_create_explicit_msvc(
 }
 
 
+patomic_fence_t
+patomic_impl_create_fence_msvc(void)
+{
+    /* zero all fields */
+    patomic_fence_t impl = {0};
+
+    /* set members */
+#if PATOMIC_IMPL_MSVC_HAS_OP_FENCE
+    impl.fp_thread_fence = patomic_opimpl_thread_fence;
+    impl.fp_signal_fence = patomic_opimpl_signal_fence;
+#endif
+
+    /* return */
+    return impl;
+}
+
+
 #else  /* !defined(_MSC_VER) */
 
 
@@ -275,6 +292,17 @@ patomic_impl_create_explicit_msvc(
 }
 
 
+patomic_fence_t
+patomic_impl_create_fence_msvc(void)
+{
+    /* zero all fields */
+    patomic_fence_t impl = {0};
+
+    /* return */
+    return impl;
+}
+
+
 #endif  /* defined(_MSC_VER) */
 
 
@@ -292,3 +320,14 @@ patomic_impl_create_transaction_msvc(
     /* return */
     return impl;
 }
+
+
+patomic_memcpy_t
+patomic_impl_create_memcpy_msvc(void)
+{
+    /* zero all fields */
+    patomic_memcpy_t impl = {0};
+
+    /* return */
+    return impl;
+}
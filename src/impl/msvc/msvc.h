@@ -76,4 +76,32 @@ patomic_impl_create_transaction_msvc(
 );
 
 
+/**
+ * @addtogroup impl.msvc
+ *
+ * @brief
+ *   Fences are supported on x86 and ARM using compiler and memory barrier
+ *   intrinsics.
+ *
+ * @return
+ *   Fences implemented with _ReadWriteBarrier, and with an interlocked
+ *   operation or __dmb for hardware barriers.
+ */
+patomic_fence_t
+patomic_impl_create_fence_msvc(void);
+
+
+/**
+ * @addtogroup impl.msvc
+ *
+ * @brief
+ *   No atomic memcpy operations are supported.
+ *
+ * @return
+ *   Atomic memcpy operations where both function pointers are NULL.
+ */
+patomic_memcpy_t
+patomic_impl_create_memcpy_msvc(void);
+
+
 #endif  /* PATOMIC_IMPL_MSVC_H */
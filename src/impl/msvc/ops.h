@@ -38,6 +38,9 @@
 #include "ops/arithmetic/dec.h"
 #include "ops/arithmetic/neg.h"
 
+/* fence */
+#include "ops/fence/fence.h"
+
 
 /* necessary because these are never implemented or defined */
 #define patomic_opimpl_store_8_acquire   NULL
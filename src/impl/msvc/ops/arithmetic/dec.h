@@ -177,49 +177,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_dec_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_dec_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_dec_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_dec_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_dec_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_dec_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_dec_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_dec_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_dec_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_dec_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
@@ -326,49 +336,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_dec_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_dec_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_dec_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_dec_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_dec_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_dec_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_dec_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_dec_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_dec_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_dec_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
@@ -479,49 +499,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_dec_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_dec_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_dec_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_dec_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_dec_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_dec_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_dec_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_dec_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_dec_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_dec_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
@@ -628,49 +658,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_dec_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_dec_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_dec
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_dec_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_dec,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_dec_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_dec
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_dec,
+    patomic_profile_slot_FETCH_DEC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_dec_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_dec_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_dec_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_dec_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_dec_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_dec_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_dec
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_dec,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
@@ -691,49 +731,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_dec_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_dec_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_dec_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_dec_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+    patomic_profile_slot_FETCH_DEC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_dec_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_dec_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+    patomic_profile_slot_DEC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_dec_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_dec_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+    patomic_profile_slot_FETCH_DEC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_dec_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_dec_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_FETCH_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_dec_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_dec_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_dec_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_DEC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_dec_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_dec_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_dec_128,
+        patomic_profile_slot_FETCH_DEC
     )
 #endif
 
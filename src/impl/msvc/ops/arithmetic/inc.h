@@ -177,49 +177,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_inc_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_inc_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_inc_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_inc_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_inc_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_inc_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_inc_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_inc_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_inc_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_inc_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
@@ -326,49 +336,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_inc_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_inc_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_inc_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_inc_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_inc_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_inc_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_inc_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_inc_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_inc_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_inc_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
@@ -479,49 +499,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_inc_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_inc_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_inc_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_inc_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_inc_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_inc_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_inc_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_inc_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_inc_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_inc_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
@@ -628,49 +658,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_inc_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_inc_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_inc
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_inc_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_inc,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_inc_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_inc
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_inc,
+    patomic_profile_slot_FETCH_INC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_inc_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_inc_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_inc_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_inc_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_inc_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_inc_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_inc
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_inc,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
@@ -691,49 +731,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_inc_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_inc_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_inc_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_inc_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+    patomic_profile_slot_FETCH_INC
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_inc_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_inc_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+    patomic_profile_slot_INC
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_inc_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_inc_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+    patomic_profile_slot_FETCH_INC
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_inc_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_inc_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_FETCH_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_inc_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_inc_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_inc_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_INC
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_inc_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_inc_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_inc_128,
+        patomic_profile_slot_FETCH_INC
     )
 #endif
 
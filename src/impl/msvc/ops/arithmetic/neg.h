@@ -44,49 +44,59 @@
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_neg_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_neg_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_neg_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_neg_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_neg_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_neg_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_neg_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_neg_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_neg_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_neg_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
@@ -107,49 +117,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_neg_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_neg_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_neg_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_neg_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_neg_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_neg_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_neg_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_neg_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_neg_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_neg_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
@@ -170,49 +190,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_neg_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_neg_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_neg_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_neg_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_neg_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_neg_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_neg_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_neg_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_neg_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_neg_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
@@ -233,49 +263,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_neg_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_neg_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_neg
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_neg_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_neg,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_neg_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_neg
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_neg,
+    patomic_profile_slot_FETCH_NEG
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_neg_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_neg_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_neg_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_neg_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_neg_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_neg_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_neg
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_neg,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
@@ -296,49 +336,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_neg_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_neg_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_neg_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_neg_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+    patomic_profile_slot_FETCH_NEG
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_neg_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_neg_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+    patomic_profile_slot_NEG
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_neg_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_neg_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+    patomic_profile_slot_FETCH_NEG
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_neg_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_neg_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_FETCH_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_neg_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_neg_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_neg_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_NEG
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_neg_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_neg_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_neg_128,
+        patomic_profile_slot_FETCH_NEG
     )
 #endif
 
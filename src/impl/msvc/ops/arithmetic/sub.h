@@ -149,49 +149,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_sub_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_sub_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_sub_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_sub_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_sub_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_sub_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_sub_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_sub_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_sub_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_sub_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
@@ -285,49 +295,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_sub_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_sub_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_sub_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_sub_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_sub_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_sub_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_sub_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_sub_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_sub_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_sub_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
@@ -425,49 +445,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_sub_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_sub_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_sub_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_sub_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_sub_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_sub_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_sub_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_sub_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_sub_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_sub_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
@@ -561,49 +591,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_sub_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_sub_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_sub
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_sub_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_sub,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_sub_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_sub
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_sub,
+    patomic_profile_slot_FETCH_SUB
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_sub_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_sub_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_sub_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_sub_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_sub_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_sub_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_sub
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_sub,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
@@ -624,49 +664,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_sub_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_sub_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_sub_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_sub_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+    patomic_profile_slot_FETCH_SUB
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_sub_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_sub_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+    patomic_profile_slot_SUB
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_sub_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_sub_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+    patomic_profile_slot_FETCH_SUB
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_sub_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_sub_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_FETCH_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_sub_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_sub_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_sub_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_SUB
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_sub_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_sub_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_sub_128,
+        patomic_profile_slot_FETCH_SUB
     )
 #endif
 
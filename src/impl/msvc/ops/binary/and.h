@@ -146,49 +146,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_and_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_and_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_and_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_and_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_and_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_and_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_and_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_and_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_and_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_and_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
@@ -282,49 +292,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_and_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_and_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_and_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_and_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_and_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_and_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_and_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_and_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_and_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_and_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
@@ -422,49 +442,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_and_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_and_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_and_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_and_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_and_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_and_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_and_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_and_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_and_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_and_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
@@ -558,49 +588,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_and_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_and_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_and
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_and_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_and,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_and_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_and
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_and,
+    patomic_profile_slot_FETCH_AND
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_and_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_and_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_and_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_and_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_and_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_and_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_and
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_and,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
@@ -621,49 +661,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_and_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_and_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_and_128,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_and_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_and_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_and_128,
+    patomic_profile_slot_FETCH_AND
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_and_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_and_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_and_128,
+    patomic_profile_slot_AND
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_and_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_and_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_and_128,
+    patomic_profile_slot_FETCH_AND
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_and_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_and_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_FETCH_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_and_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_and_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_and_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_AND
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_and_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_and_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_and_128,
+        patomic_profile_slot_FETCH_AND
     )
 #endif
 
@@ -41,49 +41,59 @@
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_not_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_not_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     char, char, patomic_opimpl_void_not_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     char, char, patomic_opimpl_fetch_not_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_not_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_not_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_not_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_not_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         char, char, patomic_opimpl_void_not_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         char, char, patomic_opimpl_fetch_not_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
@@ -104,49 +114,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_not_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_not_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     short, short, patomic_opimpl_void_not_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     short, short, patomic_opimpl_fetch_not_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_not_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_not_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_not_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_not_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         short, short, patomic_opimpl_void_not_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         short, short, patomic_opimpl_fetch_not_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
@@ -167,49 +187,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_not_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_not_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     long, long, patomic_opimpl_void_not_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     long, long, patomic_opimpl_fetch_not_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_not_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_not_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_not_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_not_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         long, long, patomic_opimpl_void_not_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         long, long, patomic_opimpl_fetch_not_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
@@ -230,49 +260,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_not_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_not_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_not
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     __int64, __int64, patomic_opimpl_void_not_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_not,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     __int64, __int64, patomic_opimpl_fetch_not_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_not
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_not,
+    patomic_profile_slot_FETCH_NOT
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_not_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_not_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_not_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_not_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         __int64, __int64, patomic_opimpl_void_not_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         __int64, __int64, patomic_opimpl_fetch_not_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_not
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_not,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
@@ -293,49 +333,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_not_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_not_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_not_128,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_not_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_not_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_not_128,
+    patomic_profile_slot_FETCH_NOT
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_not_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_not_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_not_128,
+    patomic_profile_slot_NOT
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_not_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_not_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_not_128,
+    patomic_profile_slot_FETCH_NOT
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_not_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_not_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_FETCH_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_not_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_not_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_not_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_NOT
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_not_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_not_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_not_128,
+        patomic_profile_slot_FETCH_NOT
     )
 #endif
 
@@ -146,49 +146,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_or_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_or_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_or_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_or_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_or_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_or_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_or_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_or_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_or_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_or_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
@@ -282,49 +292,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_or_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_or_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_or_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_or_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_or_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_or_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_or_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_or_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_or_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_or_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
@@ -422,49 +442,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_or_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_or_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_or_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_or_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_or_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_or_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_or_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_or_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_or_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_or_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
@@ -558,49 +588,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_or_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_or_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_or
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_or_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_or,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_or_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_or
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_or,
+    patomic_profile_slot_FETCH_OR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_or_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_or_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_or_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_or_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_or_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_or_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_or
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_or,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
@@ -621,49 +661,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_or_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_or_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_or_128,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_or_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_or_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_or_128,
+    patomic_profile_slot_FETCH_OR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_or_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_or_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_or_128,
+    patomic_profile_slot_OR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_or_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_or_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_or_128,
+    patomic_profile_slot_FETCH_OR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_or_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_or_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_FETCH_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_or_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_or_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_or_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_OR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_or_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_or_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_or_128,
+        patomic_profile_slot_FETCH_OR
     )
 #endif
 
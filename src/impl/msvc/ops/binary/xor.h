@@ -146,49 +146,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_xor_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_xor_8_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_8, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     char, char, patomic_opimpl_void_xor_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     char, char, patomic_opimpl_fetch_xor_8_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_xor_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_xor_8_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_xor_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_xor_8_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         char, char, patomic_opimpl_void_xor_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         char, char, patomic_opimpl_fetch_xor_8_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
@@ -282,49 +292,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_xor_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_xor_16_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_16, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     short, short, patomic_opimpl_void_xor_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     short, short, patomic_opimpl_fetch_xor_16_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_xor_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_xor_16_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_xor_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_xor_16_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         short, short, patomic_opimpl_void_xor_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         short, short, patomic_opimpl_fetch_xor_16_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
@@ -422,49 +442,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_xor_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_xor_32_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_32, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     long, long, patomic_opimpl_void_xor_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     long, long, patomic_opimpl_fetch_xor_32_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_xor_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_xor_32_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_xor_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_xor_32_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         long, long, patomic_opimpl_void_xor_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         long, long, patomic_opimpl_fetch_xor_32_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
@@ -558,49 +588,59 @@ PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_xor_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_xor_64_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_xor
+    SHOW_P, order, do_cmpxchg_explicit_64, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     __int64, __int64, patomic_opimpl_void_xor_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_xor,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     __int64, __int64, patomic_opimpl_fetch_xor_64_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_xor
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64, do_make_desired_xor,
+    patomic_profile_slot_FETCH_XOR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_xor_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_xor_64_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_xor_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_xor_64_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         __int64, __int64, patomic_opimpl_void_xor_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         __int64, __int64, patomic_opimpl_fetch_xor_64_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_xor
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64, do_make_desired_xor,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
@@ -621,49 +661,59 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_xor_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_xor_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_xor_128_explicit,
-    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_xor_128
+    SHOW_P, order, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+    patomic_profile_slot_FETCH_XOR
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_xor_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_xor_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+    patomic_profile_slot_XOR
 )
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_xor_128_seq_cst,
-    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_xor_128
+    HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+    patomic_profile_slot_FETCH_XOR
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_xor_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_xor_128_acquire,
-        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_FETCH_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_xor_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_xor_128_release,
-        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_NF
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_void_xor_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_XOR
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_fetch_xor_128_relaxed,
-        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_xor_128
+        HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128, do_make_desired_xor_128,
+        patomic_profile_slot_FETCH_XOR
     )
 #endif
 
@@ -64,25 +64,29 @@
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     char, char, patomic_opimpl_bit_test_compl_8_explicit,
     SHOW_P, order, do_cmpxchg_explicit_8,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     char, char, patomic_opimpl_bit_test_compl_8_seq_cst,
     HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_8,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         char, char, patomic_opimpl_bit_test_compl_8_acquire,
         HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_8,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         char, char, patomic_opimpl_bit_test_compl_8_release,
         HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_8,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -90,7 +94,8 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         char, char, patomic_opimpl_bit_test_compl_8_relaxed,
         HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_8,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -112,25 +117,29 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     short, short, patomic_opimpl_bit_test_compl_16_explicit,
     SHOW_P, order, do_cmpxchg_explicit_16,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     short, short, patomic_opimpl_bit_test_compl_16_seq_cst,
     HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_16,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         short, short, patomic_opimpl_bit_test_compl_16_acquire,
         HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_16,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         short, short, patomic_opimpl_bit_test_compl_16_release,
         HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_16,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -138,7 +147,8 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         short, short, patomic_opimpl_bit_test_compl_16_relaxed,
         HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_16,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -160,25 +170,29 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     long, long, patomic_opimpl_bit_test_compl_32_explicit,
     SHOW_P, order, do_cmpxchg_explicit_32,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     long, long, patomic_opimpl_bit_test_compl_32_seq_cst,
     HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_32,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         long, long, patomic_opimpl_bit_test_compl_32_acquire,
         HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_32,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         long, long, patomic_opimpl_bit_test_compl_32_release,
         HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_32,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -186,7 +200,8 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         long, long, patomic_opimpl_bit_test_compl_32_relaxed,
         HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_32,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -208,25 +223,29 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     __int64, __int64, patomic_opimpl_bit_test_compl_64_explicit,
     SHOW_P, order, do_cmpxchg_explicit_64,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     __int64, __int64, patomic_opimpl_bit_test_compl_64_seq_cst,
     HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_64,
-    do_get_bit, do_make_desired_compl
+    do_get_bit, do_make_desired_compl,
+    patomic_profile_slot_TEST_COMPL
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         __int64, __int64, patomic_opimpl_bit_test_compl_64_acquire,
         HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_64,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         __int64, __int64, patomic_opimpl_bit_test_compl_64_release,
         HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_64,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -234,7 +253,8 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         __int64, __int64, patomic_opimpl_bit_test_compl_64_relaxed,
         HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_64,
-        do_get_bit, do_make_desired_compl
+        do_get_bit, do_make_desired_compl,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -256,25 +276,29 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_bit_test_compl_128_explicit,
     SHOW_P, order, do_cmpxchg_explicit_128,
-    do_get_bit_128, do_make_desired_compl_128
+    do_get_bit_128, do_make_desired_compl_128,
+    patomic_profile_slot_TEST_COMPL
 )
 
 PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_bit_test_compl_128_seq_cst,
     HIDE_P, patomic_SEQ_CST, do_cmpxchg_explicit_128,
-    do_get_bit_128, do_make_desired_compl_128
+    do_get_bit_128, do_make_desired_compl_128,
+    patomic_profile_slot_TEST_COMPL
 )
 
 #if PATOMIC_IMPL_MSVC_HAS_IL_ACQ_REL
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_bit_test_compl_128_acquire,
         HIDE_P, patomic_ACQUIRE, do_cmpxchg_explicit_128,
-        do_get_bit_128, do_make_desired_compl_128
+        do_get_bit_128, do_make_desired_compl_128,
+        patomic_profile_slot_TEST_COMPL
     )
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_bit_test_compl_128_release,
         HIDE_P, patomic_RELEASE, do_cmpxchg_explicit_128,
-        do_get_bit_128, do_make_desired_compl_128
+        do_get_bit_128, do_make_desired_compl_128,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -282,7 +306,8 @@ PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(
         patomic_msvc128_t, patomic_msvc128_t, patomic_opimpl_bit_test_compl_128_relaxed,
         HIDE_P, patomic_RELAXED, do_cmpxchg_explicit_128,
-        do_get_bit_128, do_make_desired_compl_128
+        do_get_bit_128, do_make_desired_compl_128,
+        patomic_profile_slot_TEST_COMPL
     )
 #endif
 
@@ -0,0 +1,115 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_IMPL_MSVC_OPS_FENCE_FENCE_H
+#define PATOMIC_IMPL_MSVC_OPS_FENCE_FENCE_H
+
+#ifdef _MSC_VER
+
+#include "../base.h"
+
+#include <patomic/macros/ignore_unused.h>
+
+#include <patomic/stdlib/assert.h>
+
+#include <patomic/api/memory_order.h>
+
+
+#if PATOMIC_IMPL_MSVC_HAS_COMPILER_READ_WRITE_BARRIER
+
+void _ReadWriteBarrier(void);
+#pragma intrinsic(_ReadWriteBarrier)
+
+
+#if defined(_M_ARM) || defined(_M_ARM64)
+#if PATOMIC_IMPL_MSVC_HAS_MEMORY_BARRIER_DMB
+
+void __dmb(unsigned int);
+#pragma intrinsic(__dmb)
+
+#define PATOMIC_IMPL_MSVC_HAS_OP_FENCE 1
+
+/* every ordering fence needs a full barrier, as MemoryBarrier does */
+#define do_thread_fence_explicit(order) \
+    do {                                \
+        if (order != patomic_RELAXED)   \
+        {                               \
+            __dmb(0xB);                 \
+        }                               \
+    }                                   \
+    while (0)
+
+#endif  /* PATOMIC_IMPL_MSVC_HAS_MEMORY_BARRIER_DMB */
+#endif  /* defined(_M_ARM) || defined(_M_ARM64) */
+
+
+#if defined(_M_IX86) || defined(_M_X64)
+#if PATOMIC_IMPL_MSVC_HAS_IL_INCREMENT_32
+
+long _InterlockedIncrement(long volatile *);
+#pragma intrinsic(_InterlockedIncrement)
+
+#define PATOMIC_IMPL_MSVC_HAS_OP_FENCE 1
+
+/* only seq_cst needs a hardware barrier; a locked operation on a local is how
+ * MemoryBarrier is implemented on x86 */
+#define do_thread_fence_explicit(order)                               \
+    do {                                                              \
+        volatile long guard = 0l;                                     \
+        switch (order)                                                \
+        {                                                             \
+            case patomic_RELAXED:                                     \
+                break;                                                \
+            case patomic_CONSUME:                                     \
+            case patomic_ACQUIRE:                                     \
+            case patomic_RELEASE:                                     \
+            case patomic_ACQ_REL:                                     \
+                _ReadWriteBarrier();                                  \
+                break;                                                \
+            case patomic_SEQ_CST:                                     \
+            default:                                                  \
+                PATOMIC_IGNORE_UNUSED(_InterlockedIncrement(&guard)); \
+        }                                                             \
+        PATOMIC_IGNORE_UNUSED(guard);                                 \
+    }                                                                 \
+    while (0)
+
+#endif  /* PATOMIC_IMPL_MSVC_HAS_IL_INCREMENT_32 */
+#endif  /* defined(_M_IX86) || defined(_M_X64) */
+
+
+/**
+ * Defines patomic_opimpl_thread_fence and patomic_opimpl_signal_fence.
+ */
+#if PATOMIC_IMPL_MSVC_HAS_OP_FENCE
+
+static void
+patomic_opimpl_thread_fence(
+    const int order
+)
+{
+    patomic_assert(patomic_is_valid_order(order));
+    do_thread_fence_explicit(order);
+}
+
+static void
+patomic_opimpl_signal_fence(
+    const int order
+)
+{
+    /* only needs to inhibit compiler reordering */
+    patomic_assert(patomic_is_valid_order(order));
+    if (order != patomic_RELAXED)
+    {
+        _ReadWriteBarrier();
+    }
+}
+
+#endif  /* PATOMIC_IMPL_MSVC_HAS_OP_FENCE */
+
+
+#endif  /* PATOMIC_IMPL_MSVC_HAS_COMPILER_READ_WRITE_BARRIER */
+
+#endif  /* defined(_MSC_VER) */
+
+#endif  /* PATOMIC_IMPL_MSVC_OPS_FENCE_FENCE_H */
@@ -66,3 +66,25 @@ patomic_impl_create_transaction_null(
     /* return */
     return impl;
 }
+
+
+patomic_fence_t
+patomic_impl_create_fence_null(void)
+{
+    /* zero all fields */
+    patomic_fence_t impl = {0};
+
+    /* return */
+    return impl;
+}
+
+
+patomic_memcpy_t
+patomic_impl_create_memcpy_null(void)
+{
+    /* zero all fields */
+    patomic_memcpy_t impl = {0};
+
+    /* return */
+    return impl;
+}
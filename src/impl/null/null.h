@@ -76,4 +76,30 @@ patomic_impl_create_transaction_null(
 );
 
 
+/**
+ * @addtogroup impl.null
+ *
+ * @brief
+ *   No fences are supported.
+ *
+ * @return
+ *   Fences where both function pointers are NULL.
+ */
+patomic_fence_t
+patomic_impl_create_fence_null(void);
+
+
+/**
+ * @addtogroup impl.null
+ *
+ * @brief
+ *   No atomic memcpy operations are supported.
+ *
+ * @return
+ *   Atomic memcpy operations where both function pointers are NULL.
+ */
+patomic_memcpy_t
+patomic_impl_create_memcpy_null(void);
+
+
 #endif  /* PATOMIC_IMPL_NULL_H */
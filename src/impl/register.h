@@ -41,6 +41,20 @@ typedef struct {
      *         transaction from this implementation. */
     patomic_transaction_t (* fp_create_transaction) (unsigned int);
 
+    /** @brief Function called directly by patomic_create_fence to obtain
+     *         memory fences from this implementation. */
+    patomic_fence_t (* fp_create_fence) (void);
+
+    /** @brief Function called directly by patomic_create_memcpy to obtain
+     *         atomic memcpy operations from this implementation. */
+    patomic_memcpy_t (* fp_create_memcpy) (void);
+
+    /** @brief Function called by patomic_describe and
+     *         patomic_describe_explicit to obtain which opkinds in an opcat
+     *         are emulated with a cmpxchg loop for a given byte width. May be
+     *         NULL if the implementation does not report this. */
+    unsigned int (* fp_emulated_opkinds) (size_t, patomic_opcat_t);
+
 } patomic_impl_t;
 
 
@@ -57,7 +71,14 @@ typedef struct {
  *
  * @note
  *   An implementation may use the NULL implementation's creation functions if
- *   it cannot create any implicit, explicit, or transaction operations.
+ *   it cannot create any implicit, explicit, or transaction operations, or any
+ *   memory fences or atomic memcpy operations.
+ *
+ * @note
+ *   The register does not filter implementations by options. Each
+ *   implementation's creation functions must themselves enforce
+ *   patomic_option_PROCESS_SHARED by not providing any operation which is not
+ *   address-free.
  */
 static const patomic_impl_t
 patomic_impl_register[] = {
@@ -66,21 +87,30 @@ patomic_impl_register[] = {
         patomic_kind_UNKN,
         patomic_impl_create_null,
         patomic_impl_create_explicit_null,
-        patomic_impl_create_transaction_null
+        patomic_impl_create_transaction_null,
+        patomic_impl_create_fence_null,
+        patomic_impl_create_memcpy_null,
+        NULL
     }
     ,{
         patomic_id_STDC,
         patomic_kind_BLTN,
         patomic_impl_create_std,
         patomic_impl_create_explicit_std,
-        patomic_impl_create_transaction_std
+        patomic_impl_create_transaction_std,
+        patomic_impl_create_fence_std,
+        patomic_impl_create_memcpy_std,
+        patomic_impl_emulated_opkinds_std
     }
     ,{
         patomic_id_MSVC,
         patomic_kind_ASM,
         patomic_impl_create_msvc,
         patomic_impl_create_explicit_msvc,
-        patomic_impl_create_transaction_msvc
+        patomic_impl_create_transaction_msvc,
+        patomic_impl_create_fence_msvc,
+        patomic_impl_create_memcpy_msvc,
+        NULL
     }
 };
 
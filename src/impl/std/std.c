@@ -6,6 +6,7 @@
 #include <patomic/config.h>
 
 #include <patomic/macros/ignore_unused.h>
+#include <patomic/macros/thread_local.h>
 
 
 #if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && PATOMIC_HAS_IR_TWOS_COMPL
@@ -14,8 +15,10 @@
 #include <patomic/stdlib/assert.h>
 #include <patomic/stdlib/stdint.h>
 
+#include <patomic/wrapped/batch.h>
 #include <patomic/wrapped/cmpxchg.h>
 #include <patomic/wrapped/direct.h>
+#include <patomic/wrapped/wait.h>
 
 #include <stdatomic.h>
 #include <stddef.h>
@@ -53,6 +56,7 @@
  * - exchange       (direct)
  * - cmpxchg_weak   (direct)
  * - cmpxchg_strong (direct)
+ * - fetch_update   (cmpxchg)
  */
 #define do_exchange_explicit(type, obj, des, order, res) \
     res = atomic_exchange_explicit(obj, des, order)
@@ -80,6 +84,12 @@
         vis_p, inv, order,                                                 \
         do_cmpxchg_strong                                                  \
     )                                                                      \
+    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_UPDATE(                        \
+        _Atomic(type), type,                                               \
+        patomic_opimpl_fetch_update_##name,                                \
+        vis_p, inv, order,                                                 \
+        do_load_explicit, do_cmpxchg_weak                                  \
+    )                                                                      \
     static patomic_##ops##_xchg_t                                          \
     patomic_ops_xchg_create_##name(void)                                   \
     {                                                                      \
@@ -87,6 +97,7 @@
         pao.fp_exchange = patomic_opimpl_exchange_##name;                  \
         pao.fp_cmpxchg_weak = patomic_opimpl_cmpxchg_weak_##name;          \
         pao.fp_cmpxchg_strong = patomic_opimpl_cmpxchg_strong_##name;      \
+        pao.fp_fetch_update = patomic_opimpl_fetch_update_##name;          \
         return pao;                                                        \
     }
 
@@ -148,21 +159,24 @@
         patomic_opimpl_bit_test_compl_##name,                        \
         vis_p, order,                                                \
         do_cmpxchg_weak,                                             \
-        do_get_bit, do_make_desired_compl                            \
+        do_get_bit, do_make_desired_compl,                           \
+        patomic_profile_slot_TEST_COMPL                              \
     )                                                                \
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(               \
         _Atomic(type), type,                                         \
         patomic_opimpl_bit_test_set_##name,                          \
         vis_p, order,                                                \
         do_cmpxchg_weak,                                             \
-        do_get_bit, do_make_desired_set                              \
+        do_get_bit, do_make_desired_set,                             \
+        patomic_profile_slot_TEST_SET                                \
     )                                                                \
     PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(               \
         _Atomic(type), type,                                         \
         patomic_opimpl_bit_test_reset_##name,                        \
         vis_p, order,                                                \
         do_cmpxchg_weak,                                             \
-        do_get_bit, do_make_desired_reset                            \
+        do_get_bit, do_make_desired_reset,                           \
+        patomic_profile_slot_TEST_RESET                              \
     )
 
 /* create ops which support all memory orders */
@@ -242,7 +256,8 @@
         _Atomic(type), type,                                            \
         patomic_opimpl_void_not_##name,                                 \
         vis_p, order,                                                   \
-        do_cmpxchg_weak, do_make_desired_not                            \
+        do_cmpxchg_weak, do_make_desired_not,                           \
+        patomic_profile_slot_NOT                                        \
     )                                                                   \
     PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                             \
         _Atomic(type), type,                                            \
@@ -266,7 +281,8 @@
         _Atomic(type), type,                                            \
         patomic_opimpl_fetch_not_##name,                                \
         vis_p, order,                                                   \
-        do_cmpxchg_weak, do_make_desired_not                            \
+        do_cmpxchg_weak, do_make_desired_not,                           \
+        patomic_profile_slot_FETCH_NOT                                  \
     )                                                                   \
     static patomic_##ops##_binary_t                                     \
     patomic_ops_binary_create_##name(void)                              \
@@ -291,6 +307,14 @@
  * - (fetch_)inc (direct)
  * - (fetch_)dec (direct)
  * - (fetch_)neg (cmpxchg)
+ * - (fetch_)min, (fetch_)max (direct if available, otherwise cmpxchg)
+ * - (fetch_)umin, (fetch_)umax (direct if available, otherwise cmpxchg)
+ * - (fetch_)add_sat, (fetch_)sub_sat (cmpxchg)
+ * - (fetch_)uadd_sat, (fetch_)usub_sat (cmpxchg)
+ *
+ * C11 has no atomic minimum or maximum, but clang provides them as builtins
+ * which compile to single instructions where the architecture has them (e.g.
+ * ldsmax/ldumax on AArch64 with LSE, and amomax/amomaxu on RISC-V).
  */
 #define do_void_add_explicit(type, obj, arg, order) \
     PATOMIC_IGNORE_UNUSED(atomic_fetch_add_explicit(obj, arg, order))
@@ -313,85 +337,558 @@
 #define do_make_desired_neg(type, exp, des) \
     des = (type) (~((type) exp) + ((type) 1))
 
-#define PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops) \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                  \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_void_add_##name,                                     \
-        vis_p, order,                                                       \
-        do_void_add_explicit                                                \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                  \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_void_sub_##name,                                     \
-        vis_p, order,                                                       \
-        do_void_sub_explicit                                                \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID_NOARG(                            \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_void_inc_##name,                                     \
-        vis_p, order,                                                       \
-        do_void_inc_explicit                                                \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID_NOARG(                            \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_void_dec_##name,                                     \
-        vis_p, order,                                                       \
-        do_void_dec_explicit                                                \
-    )                                                                       \
-    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(                           \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_void_neg_##name,                                     \
-        vis_p, order,                                                       \
-        do_cmpxchg_weak, do_make_desired_neg                                \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                 \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_fetch_add_##name,                                    \
-        vis_p, order,                                                       \
-        do_fetch_add_explicit                                               \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                 \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_fetch_sub_##name,                                    \
-        vis_p, order,                                                       \
-        do_fetch_sub_explicit                                               \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(                           \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_fetch_inc_##name,                                    \
-        vis_p, order,                                                       \
-        do_fetch_inc_explicit                                               \
-    )                                                                       \
-    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(                           \
-        _Atomic(type), type,                                                \
-        patomic_opimpl_fetch_dec_##name,                                    \
-        vis_p, order,                                                       \
-        do_fetch_dec_explicit                                               \
-    )                                                                       \
-    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(                          \
+/* signed operations are done on the unsigned representation */
+#define do_sign_bit(type) \
+    ((type) ~(((type) ~(type) 0) >> 1))
+
+/* overflow if operands have the same sign, and result has a different sign */
+#define do_make_desired_add_sat(type, exp, arg, des)              \
+    do {                                                          \
+        const type sign = do_sign_bit(type);                      \
+        des = (type) (exp + arg);                                 \
+        if (((des ^ exp) & (des ^ arg) & sign) != 0)              \
+        {                                                         \
+            des = (type) ((exp & sign) ? sign : (type) ~sign);    \
+        }                                                         \
+    }                                                             \
+    while (0)
+
+/* overflow if operands have different signs, and result has arg's sign */
+#define do_make_desired_sub_sat(type, exp, arg, des)              \
+    do {                                                          \
+        const type sign = do_sign_bit(type);                      \
+        des = (type) (exp - arg);                                 \
+        if (((exp ^ arg) & (des ^ exp) & sign) != 0)              \
+        {                                                         \
+            des = (type) ((exp & sign) ? sign : (type) ~sign);    \
+        }                                                         \
+    }                                                             \
+    while (0)
+
+#define do_make_desired_uadd_sat(type, exp, arg, des)                    \
+    des = ((type) (exp + arg) < exp) ? (type) ~(type) 0 : (type) (exp + arg)
+
+#define do_make_desired_usub_sat(type, exp, arg, des) \
+    des = (exp < arg) ? (type) 0 : (type) (exp - arg)
+
+#define PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(                                               \
+        _Atomic(type), type,                                                              \
+        patomic_opimpl_void_##opname##_##name,                                            \
+        vis_p, order,                                                                     \
+        do_cmpxchg_weak, do_make_desired_##opname, slot                                   \
+    )
+
+#define PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(                                               \
+        _Atomic(type), type,                                                               \
+        patomic_opimpl_fetch_##opname##_##name,                                            \
+        vis_p, order,                                                                      \
+        do_cmpxchg_weak, do_make_desired_##opname, slot                                    \
+    )
+
+#if PATOMIC_HAS_C11_ATOMIC_MINMAX
+
+#if PATOMIC_STDINT_HAS_LLONG
+    #define do_signed_minmax_llong(fn, obj, arg, order)                   \
+        ,patomic_llong_unsigned_t: fn(                                    \
+            (volatile _Atomic(patomic_llong_signed_t) *) (obj),           \
+            (patomic_llong_signed_t) (arg), order)
+#else
+    #define do_signed_minmax_llong(fn, obj, arg, order)
+#endif
+
+/* the builtins use the signedness of the object type for comparisons */
+#define do_signed_minmax(fn, type, obj, arg, order)                       \
+    (type) _Generic((type) 0,                                             \
+        unsigned char: fn(                                                \
+            (volatile _Atomic(signed char) *) (obj),                      \
+            (signed char) (arg), order),                                  \
+        unsigned short: fn(                                               \
+            (volatile _Atomic(signed short) *) (obj),                     \
+            (signed short) (arg), order),                                 \
+        unsigned int: fn(                                                 \
+            (volatile _Atomic(signed int) *) (obj),                       \
+            (signed int) (arg), order),                                   \
+        unsigned long: fn(                                                \
+            (volatile _Atomic(signed long) *) (obj),                      \
+            (signed long) (arg), order)                                   \
+        do_signed_minmax_llong(fn, obj, arg, order)                       \
+    )
+
+#define do_void_min_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(                          \
+        do_signed_minmax(__c11_atomic_fetch_min, type, obj, arg, order))
+#define do_void_max_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(                          \
+        do_signed_minmax(__c11_atomic_fetch_max, type, obj, arg, order))
+#define do_void_umin_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(__c11_atomic_fetch_min(obj, arg, order))
+#define do_void_umax_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(__c11_atomic_fetch_max(obj, arg, order))
+
+#define do_fetch_min_explicit(type, obj, arg, order, res) \
+    res = do_signed_minmax(__c11_atomic_fetch_min, type, obj, arg, order)
+#define do_fetch_max_explicit(type, obj, arg, order, res) \
+    res = do_signed_minmax(__c11_atomic_fetch_max, type, obj, arg, order)
+#define do_fetch_umin_explicit(type, obj, arg, order, res) \
+    res = __c11_atomic_fetch_min(obj, arg, order)
+#define do_fetch_umax_explicit(type, obj, arg, order, res) \
+    res = __c11_atomic_fetch_max(obj, arg, order)
+
+#define PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                               \
+        _Atomic(type), type,                                                             \
+        patomic_opimpl_void_##opname##_##name,                                           \
+        vis_p, order,                                                                    \
+        do_void_##opname##_explicit                                                      \
+    )
+
+#define PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                               \
+        _Atomic(type), type,                                                              \
+        patomic_opimpl_fetch_##opname##_##name,                                           \
+        vis_p, order,                                                                     \
+        do_fetch_##opname##_explicit                                                      \
+    )
+
+#else  /* PATOMIC_HAS_C11_ATOMIC_MINMAX */
+
+/* flipping the sign bit makes unsigned comparison order signed values */
+#define do_make_desired_min(type, exp, arg, des)          \
+    des = ((type) (exp ^ do_sign_bit(type)) <             \
+           (type) (arg ^ do_sign_bit(type))) ? exp : arg
+#define do_make_desired_max(type, exp, arg, des)          \
+    des = ((type) (exp ^ do_sign_bit(type)) >             \
+           (type) (arg ^ do_sign_bit(type))) ? exp : arg
+#define do_make_desired_umin(type, exp, arg, des) \
+    des = (exp < arg) ? exp : arg
+#define do_make_desired_umax(type, exp, arg, des) \
+    des = (exp > arg) ? exp : arg
+
+#define PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP
+
+#define PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP
+
+#endif  /* PATOMIC_HAS_C11_ATOMIC_MINMAX */
+
+#define PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)        \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                         \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_void_add_##name,                                            \
+        vis_p, order,                                                              \
+        do_void_add_explicit                                                       \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                         \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_void_sub_##name,                                            \
+        vis_p, order,                                                              \
+        do_void_sub_explicit                                                       \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID_NOARG(                                   \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_void_inc_##name,                                            \
+        vis_p, order,                                                              \
+        do_void_inc_explicit                                                       \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID_NOARG(                                   \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_void_dec_##name,                                            \
+        vis_p, order,                                                              \
+        do_void_dec_explicit                                                       \
+    )                                                                              \
+    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(                                  \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_void_neg_##name,                                            \
+        vis_p, order,                                                              \
+        do_cmpxchg_weak, do_make_desired_neg,                                      \
+        patomic_profile_slot_NEG                                                   \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                        \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_fetch_add_##name,                                           \
+        vis_p, order,                                                              \
+        do_fetch_add_explicit                                                      \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                        \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_fetch_sub_##name,                                           \
+        vis_p, order,                                                              \
+        do_fetch_sub_explicit                                                      \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(                                  \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_fetch_inc_##name,                                           \
+        vis_p, order,                                                              \
+        do_fetch_inc_explicit                                                      \
+    )                                                                              \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH_NOARG(                                  \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_fetch_dec_##name,                                           \
+        vis_p, order,                                                              \
+        do_fetch_dec_explicit                                                      \
+    )                                                                              \
+    PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(                                 \
+        _Atomic(type), type,                                                       \
+        patomic_opimpl_fetch_neg_##name,                                           \
+        vis_p, order,                                                              \
+        do_cmpxchg_weak, do_make_desired_neg,                                      \
+        patomic_profile_slot_FETCH_NEG                                             \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP(                                      \
+        type, name, vis_p, order, min, patomic_profile_slot_MIN                    \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP(                                      \
+        type, name, vis_p, order, max, patomic_profile_slot_MAX                    \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP(                                      \
+        type, name, vis_p, order, umin, patomic_profile_slot_UMIN                  \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_MINMAX_OP(                                      \
+        type, name, vis_p, order, umax, patomic_profile_slot_UMAX                  \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP(                                     \
+        type, name, vis_p, order, min, patomic_profile_slot_FETCH_MIN              \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP(                                     \
+        type, name, vis_p, order, max, patomic_profile_slot_FETCH_MAX              \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP(                                     \
+        type, name, vis_p, order, umin, patomic_profile_slot_FETCH_UMIN            \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_MINMAX_OP(                                     \
+        type, name, vis_p, order, umax, patomic_profile_slot_FETCH_UMAX            \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP(                                     \
+        type, name, vis_p, order, add_sat, patomic_profile_slot_ADD_SAT            \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP(                                     \
+        type, name, vis_p, order, sub_sat, patomic_profile_slot_SUB_SAT            \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP(                                     \
+        type, name, vis_p, order, uadd_sat, patomic_profile_slot_UADD_SAT          \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP(                                     \
+        type, name, vis_p, order, usub_sat, patomic_profile_slot_USUB_SAT          \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP(                                    \
+        type, name, vis_p, order, add_sat, patomic_profile_slot_FETCH_ADD_SAT      \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP(                                    \
+        type, name, vis_p, order, sub_sat, patomic_profile_slot_FETCH_SUB_SAT      \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP(                                    \
+        type, name, vis_p, order, uadd_sat, patomic_profile_slot_FETCH_UADD_SAT    \
+    )                                                                              \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP(                                    \
+        type, name, vis_p, order, usub_sat, patomic_profile_slot_FETCH_USUB_SAT    \
+    )                                                                              \
+    static patomic_##ops##_arithmetic_t                                            \
+    patomic_ops_arithmetic_create_##name(void)                                     \
+    {                                                                              \
+        patomic_##ops##_arithmetic_t pao;                                          \
+        pao.fp_add = patomic_opimpl_void_add_##name;                               \
+        pao.fp_sub = patomic_opimpl_void_sub_##name;                               \
+        pao.fp_inc = patomic_opimpl_void_inc_##name;                               \
+        pao.fp_dec = patomic_opimpl_void_dec_##name;                               \
+        pao.fp_neg = patomic_opimpl_void_neg_##name;                               \
+        pao.fp_min = patomic_opimpl_void_min_##name;                               \
+        pao.fp_max = patomic_opimpl_void_max_##name;                               \
+        pao.fp_umin = patomic_opimpl_void_umin_##name;                             \
+        pao.fp_umax = patomic_opimpl_void_umax_##name;                             \
+        pao.fp_add_sat = patomic_opimpl_void_add_sat_##name;                       \
+        pao.fp_sub_sat = patomic_opimpl_void_sub_sat_##name;                       \
+        pao.fp_uadd_sat = patomic_opimpl_void_uadd_sat_##name;                     \
+        pao.fp_usub_sat = patomic_opimpl_void_usub_sat_##name;                     \
+        pao.fp_fetch_add = patomic_opimpl_fetch_add_##name;                        \
+        pao.fp_fetch_sub = patomic_opimpl_fetch_sub_##name;                        \
+        pao.fp_fetch_inc = patomic_opimpl_fetch_inc_##name;                        \
+        pao.fp_fetch_dec = patomic_opimpl_fetch_dec_##name;                        \
+        pao.fp_fetch_neg = patomic_opimpl_fetch_neg_##name;                        \
+        pao.fp_fetch_min = patomic_opimpl_fetch_min_##name;                        \
+        pao.fp_fetch_max = patomic_opimpl_fetch_max_##name;                        \
+        pao.fp_fetch_umin = patomic_opimpl_fetch_umin_##name;                      \
+        pao.fp_fetch_umax = patomic_opimpl_fetch_umax_##name;                      \
+        pao.fp_fetch_add_sat = patomic_opimpl_fetch_add_sat_##name;                \
+        pao.fp_fetch_sub_sat = patomic_opimpl_fetch_sub_sat_##name;                \
+        pao.fp_fetch_uadd_sat = patomic_opimpl_fetch_uadd_sat_##name;              \
+        pao.fp_fetch_usub_sat = patomic_opimpl_fetch_usub_sat_##name;              \
+        return pao;                                                                \
+    }
+
+
+/*
+ * WAIT:
+ * - wait       (futex)
+ * - wait_timed (futex)
+ * - notify_one (futex)
+ * - notify_all (futex)
+ *
+ * If futexes are not available, no wait or notify operations are provided.
+ */
+#if PATOMIC_INTERNAL_WAIT_IS_SUPPORTED
+
+#define PATOMIC_DEFINE_NOTIFY_OPS(type, name) \
+    PATOMIC_WRAPPED_WAIT_DEFINE_OP_NOTIFY(    \
+        _Atomic(type), type,                  \
+        patomic_opimpl_notify_one_##name,     \
+        0                                     \
+    )                                         \
+    PATOMIC_WRAPPED_WAIT_DEFINE_OP_NOTIFY(    \
+        _Atomic(type), type,                  \
+        patomic_opimpl_notify_all_##name,     \
+        1                                     \
+    )
+
+#define PATOMIC_DEFINE_WAIT_OPS_CREATE_LOAD(type, name, vis_p, order, ops) \
+    PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS(                                \
+        _Atomic(type), type,                                               \
+        patomic_opimpl_wait_differs_##name,                                \
+        do_load_explicit                                                   \
+    )                                                                      \
+    PATOMIC_WRAPPED_WAIT_DEFINE_OP_WAIT(                                   \
+        _Atomic(type), type,                                               \
+        patomic_opimpl_wait_##name,                                        \
+        vis_p, order,                                                      \
+        patomic_opimpl_wait_differs_##name                                 \
+    )                                                                      \
+    PATOMIC_WRAPPED_WAIT_DEFINE_OP_WAIT_TIMED(                             \
+        _Atomic(type), type,                                               \
+        patomic_opimpl_wait_timed_##name,                                  \
+        vis_p, order,                                                      \
+        patomic_opimpl_wait_differs_##name                                 \
+    )                                                                      \
+    PATOMIC_DEFINE_NOTIFY_OPS(type, name)                                  \
+    static patomic_##ops##_wait_t                                          \
+    patomic_ops_wait_create_##name(void)                                   \
+    {                                                                      \
+        patomic_##ops##_wait_t pao;                                        \
+        pao.fp_wait = patomic_opimpl_wait_##name;                          \
+        pao.fp_wait_timed = patomic_opimpl_wait_timed_##name;              \
+        pao.fp_notify_one = patomic_opimpl_notify_one_##name;              \
+        pao.fp_notify_all = patomic_opimpl_notify_all_##name;              \
+        return pao;                                                        \
+    }
+
+#define PATOMIC_DEFINE_WAIT_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops) \
+    PATOMIC_DEFINE_NOTIFY_OPS(type, name)                                     \
+    static patomic_##ops##_wait_t                                             \
+    patomic_ops_wait_create_##name(void)                                      \
+    {                                                                         \
+        patomic_##ops##_wait_t pao;                                           \
+        pao.fp_wait = NULL;                                                   \
+        pao.fp_wait_timed = NULL;                                             \
+        pao.fp_notify_one = patomic_opimpl_notify_one_##name;                 \
+        pao.fp_notify_all = patomic_opimpl_notify_all_##name;                 \
+        return pao;                                                           \
+    }
+
+#else  /* PATOMIC_INTERNAL_WAIT_IS_SUPPORTED */
+
+#define PATOMIC_DEFINE_WAIT_OPS_CREATE_LOAD(type, name, vis_p, order, ops) \
+    static patomic_##ops##_wait_t                                          \
+    patomic_ops_wait_create_##name(void)                                   \
+    {                                                                      \
+        patomic_##ops##_wait_t pao = {0};                                  \
+        return pao;                                                        \
+    }
+
+#define PATOMIC_DEFINE_WAIT_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops) \
+    PATOMIC_DEFINE_WAIT_OPS_CREATE_LOAD(type, name, vis_p, order, ops)
+
+#endif  /* PATOMIC_INTERNAL_WAIT_IS_SUPPORTED */
+
+
+/*
+ * BATCH:
+ * - add_n, sub_n, or_n, xor_n, and_n                       (direct)
+ * - fetch_add_n, fetch_sub_n, fetch_or_n, fetch_xor_n,
+ *   fetch_and_n, exchange_n                                 (direct)
+ * - cmpxchg_n                                               (cmpxchg_strong)
+ * - store_array, load_array                                 (direct, vector)
+ *
+ * Each object in a batch is operated on with its own atomic operation, with
+ * no ordering guarantees between objects beyond those provided by 'order'.
+ */
+#define PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, opname) \
+    PATOMIC_WRAPPED_BATCH_DEFINE_OP_VOID_N(                              \
+        _Atomic(type), type,                                             \
+        patomic_opimpl_##opname##_n_##name,                              \
+        vis_p, order,                                                    \
+        do_void_##opname##_explicit                                      \
+    )
+
+#define PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, opname) \
+    PATOMIC_WRAPPED_BATCH_DEFINE_OP_FETCH_N(                              \
+        _Atomic(type), type,                                              \
+        patomic_opimpl_##opname##_n_##name,                               \
+        vis_p, order,                                                     \
+        do_##opname##_explicit                                            \
+    )
+
+#define PATOMIC_DEFINE_STORE_ARRAY_OP(type, name, vis_p, order) \
+    PATOMIC_WRAPPED_BATCH_DEFINE_OP_STORE_ARRAY(              \
+        _Atomic(type), type,                                  \
+        patomic_opimpl_store_array_##name,                    \
+        vis_p, order,                                         \
+        do_store_explicit                                     \
+    )
+
+#define PATOMIC_DEFINE_LOAD_ARRAY_OP(type, name, vis_p, order) \
+    PATOMIC_WRAPPED_BATCH_DEFINE_OP_LOAD_ARRAY(              \
+        _Atomic(type), type,                                 \
+        patomic_opimpl_load_array_##name,                    \
+        vis_p, order,                                        \
+        do_load_explicit                                     \
+    )
+
+/* store_array and load_array must be defined separately (or be NULL) */
+#define PATOMIC_DEFINE_BATCH_OPS_CREATE(                                    \
+    type, name, vis_p, inv, order, ops,                                     \
+    store_array, load_array                                                 \
+)                                                                           \
+    PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, add)           \
+    PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, sub)           \
+    PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, or)            \
+    PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, xor)           \
+    PATOMIC_DEFINE_BATCH_VOID_N_OP(type, name, vis_p, order, and)           \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, fetch_add)    \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, fetch_sub)    \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, fetch_or)     \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, fetch_xor)    \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, fetch_and)    \
+    PATOMIC_DEFINE_BATCH_FETCH_N_OP(type, name, vis_p, order, exchange)     \
+    PATOMIC_WRAPPED_BATCH_DEFINE_OP_CMPXCHG_N(                              \
         _Atomic(type), type,                                                \
-        patomic_opimpl_fetch_neg_##name,                                    \
-        vis_p, order,                                                       \
-        do_cmpxchg_weak, do_make_desired_neg                                \
+        patomic_opimpl_cmpxchg_n_##name,                                    \
+        vis_p, inv, order,                                                  \
+        do_cmpxchg_strong                                                   \
     )                                                                       \
-    static patomic_##ops##_arithmetic_t                                     \
-    patomic_ops_arithmetic_create_##name(void)                              \
+    static patomic_##ops##_batch_t                                          \
+    patomic_ops_batch_create_##name(void)                                   \
     {                                                                       \
-        patomic_##ops##_arithmetic_t pao;                                   \
-        pao.fp_add = patomic_opimpl_void_add_##name;                        \
-        pao.fp_sub = patomic_opimpl_void_sub_##name;                        \
-        pao.fp_inc = patomic_opimpl_void_inc_##name;                        \
-        pao.fp_dec = patomic_opimpl_void_dec_##name;                        \
-        pao.fp_neg = patomic_opimpl_void_neg_##name;                        \
-        pao.fp_fetch_add = patomic_opimpl_fetch_add_##name;                 \
-        pao.fp_fetch_sub = patomic_opimpl_fetch_sub_##name;                 \
-        pao.fp_fetch_inc = patomic_opimpl_fetch_inc_##name;                 \
-        pao.fp_fetch_dec = patomic_opimpl_fetch_dec_##name;                 \
-        pao.fp_fetch_neg = patomic_opimpl_fetch_neg_##name;                 \
+        patomic_##ops##_batch_t pao;                                        \
+        pao.fp_add_n = patomic_opimpl_add_n_##name;                         \
+        pao.fp_sub_n = patomic_opimpl_sub_n_##name;                         \
+        pao.fp_or_n  = patomic_opimpl_or_n_##name;                          \
+        pao.fp_xor_n = patomic_opimpl_xor_n_##name;                         \
+        pao.fp_and_n = patomic_opimpl_and_n_##name;                         \
+        pao.fp_fetch_add_n = patomic_opimpl_fetch_add_n_##name;             \
+        pao.fp_fetch_sub_n = patomic_opimpl_fetch_sub_n_##name;             \
+        pao.fp_fetch_or_n  = patomic_opimpl_fetch_or_n_##name;              \
+        pao.fp_fetch_xor_n = patomic_opimpl_fetch_xor_n_##name;             \
+        pao.fp_fetch_and_n = patomic_opimpl_fetch_and_n_##name;             \
+        pao.fp_exchange_n = patomic_opimpl_exchange_n_##name;               \
+        pao.fp_cmpxchg_n = patomic_opimpl_cmpxchg_n_##name;                 \
+        pao.fp_store_array = store_array;                                   \
+        pao.fp_load_array = load_array;                                     \
         return pao;                                                         \
     }
 
 
+/*
+ * FLOAT:
+ * - add       (direct if available, otherwise cmpxchg)
+ * - sub       (direct if available, otherwise cmpxchg)
+ * - fetch_add (direct if available, otherwise cmpxchg)
+ * - fetch_sub (direct if available, otherwise cmpxchg)
+ *
+ * C11 does not define atomic_fetch_add or atomic_fetch_sub for floating
+ * types, but clang provides them as builtins which compile to single
+ * instructions where the architecture has them. The cmpxchg loop compares
+ * object representations, so it terminates if the object holds a NaN, and
+ * distinguishes -0.0 from +0.0.
+ */
+#if PATOMIC_HAS_C11_ATOMIC_FADD
+
+#define do_void_fadd_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(__c11_atomic_fetch_add(obj, arg, order))
+#define do_void_fsub_explicit(type, obj, arg, order) \
+    PATOMIC_IGNORE_UNUSED(__c11_atomic_fetch_sub(obj, arg, order))
+
+#define do_fetch_fadd_explicit(type, obj, arg, order, res) \
+    res = __c11_atomic_fetch_add(obj, arg, order)
+#define do_fetch_fsub_explicit(type, obj, arg, order, res) \
+    res = __c11_atomic_fetch_sub(obj, arg, order)
+
+#define PATOMIC_DEFINE_FLOAT_VOID_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID(                                   \
+        _Atomic(type), type,                                                 \
+        patomic_opimpl_void_##opname##_##name,                               \
+        vis_p, order,                                                        \
+        do_void_##opname##_explicit                                          \
+    )
+
+#define PATOMIC_DEFINE_FLOAT_FETCH_OP(type, name, vis_p, order, opname, slot) \
+    PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH(                                   \
+        _Atomic(type), type,                                                  \
+        patomic_opimpl_fetch_##opname##_##name,                               \
+        vis_p, order,                                                         \
+        do_fetch_##opname##_explicit                                          \
+    )
+
+#else  /* PATOMIC_HAS_C11_ATOMIC_FADD */
+
+#define do_make_desired_fadd(type, exp, arg, des) \
+    des = (type) (exp + arg)
+#define do_make_desired_fsub(type, exp, arg, des) \
+    des = (type) (exp - arg)
+
+#define PATOMIC_DEFINE_FLOAT_VOID_OP \
+    PATOMIC_DEFINE_ARITHMETIC_VOID_CMPXCHG_OP
+
+#define PATOMIC_DEFINE_FLOAT_FETCH_OP \
+    PATOMIC_DEFINE_ARITHMETIC_FETCH_CMPXCHG_OP
+
+#endif  /* PATOMIC_HAS_C11_ATOMIC_FADD */
+
+#define PATOMIC_DEFINE_FLOAT_OPS_CREATE(type, name, vis_p, order, ops)  \
+    PATOMIC_DEFINE_FLOAT_VOID_OP(                                       \
+        type, name, vis_p, order, fadd, patomic_profile_slot_FADD       \
+    )                                                                   \
+    PATOMIC_DEFINE_FLOAT_VOID_OP(                                       \
+        type, name, vis_p, order, fsub, patomic_profile_slot_FSUB       \
+    )                                                                   \
+    PATOMIC_DEFINE_FLOAT_FETCH_OP(                                      \
+        type, name, vis_p, order, fadd, patomic_profile_slot_FETCH_FADD \
+    )                                                                   \
+    PATOMIC_DEFINE_FLOAT_FETCH_OP(                                      \
+        type, name, vis_p, order, fsub, patomic_profile_slot_FETCH_FSUB \
+    )                                                                   \
+    static patomic_##ops##_float_t                                      \
+    patomic_ops_float_create_##name(void)                               \
+    {                                                                   \
+        patomic_##ops##_float_t pao;                                    \
+        pao.fp_add = patomic_opimpl_void_fadd_##name;                   \
+        pao.fp_sub = patomic_opimpl_void_fsub_##name;                   \
+        pao.fp_fetch_add = patomic_opimpl_fetch_fadd_##name;            \
+        pao.fp_fetch_sub = patomic_opimpl_fetch_fsub_##name;            \
+        return pao;                                                     \
+    }
+
+#define PATOMIC_DEFINE_FLOAT_OPS_CREATE_ALL(type, name)    \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_relaxed, HIDE_P, patomic_RELAXED, ops \
+    )                                                      \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_acquire, HIDE_P, patomic_ACQUIRE, ops \
+    )                                                      \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_release, HIDE_P, patomic_RELEASE, ops \
+    )                                                      \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_acq_rel, HIDE_P, patomic_ACQ_REL, ops \
+    )                                                      \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_seq_cst, HIDE_P, patomic_SEQ_CST, ops \
+    )                                                      \
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE(                       \
+        type, name##_explicit, SHOW_P, order, ops_explicit \
+    )
+
+
 /*
  * CREATE STRUCTS
  *
@@ -404,10 +901,16 @@
 #define PATOMIC_DEFINE_OPS_CREATE_CA(type, name, vis_p, inv, order, ops)  \
     /* no store in consume or acquire */                                  \
     PATOMIC_DEFINE_LOAD_OP(type, name, vis_p, order)                      \
+    PATOMIC_DEFINE_LOAD_ARRAY_OP(type, name, vis_p, order)                \
     PATOMIC_DEFINE_XCHG_OPS_CREATE(type, name, vis_p, inv, order, ops)    \
     PATOMIC_DEFINE_BITWISE_OPS_CREATE_LOAD(type, name, vis_p, order, ops) \
     PATOMIC_DEFINE_BINARY_OPS_CREATE(type, name, vis_p, order, ops)       \
     PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)   \
+    PATOMIC_DEFINE_WAIT_OPS_CREATE_LOAD(type, name, vis_p, order, ops)    \
+    PATOMIC_DEFINE_BATCH_OPS_CREATE(                                      \
+        type, name, vis_p, inv, order, ops,                               \
+        NULL, patomic_opimpl_load_array_##name                            \
+    )                                                                     \
     static patomic_##ops##_t                                              \
     patomic_ops_create_##name(void)                                       \
     {                                                                     \
@@ -418,16 +921,24 @@
         pao.bitwise_ops = patomic_ops_bitwise_create_##name();            \
         pao.binary_ops = patomic_ops_binary_create_##name();              \
         pao.arithmetic_ops = patomic_ops_arithmetic_create_##name();      \
+        pao.wait_ops = patomic_ops_wait_create_##name();                  \
+        pao.batch_ops = patomic_ops_batch_create_##name();                \
         return pao;                                                       \
     }
 
 #define PATOMIC_DEFINE_OPS_CREATE_R(type, name, vis_p, inv, order, ops)      \
     PATOMIC_DEFINE_STORE_OP(type, name, vis_p, order)                        \
+    PATOMIC_DEFINE_STORE_ARRAY_OP(type, name, vis_p, order)                  \
     /* no load in release */                                                 \
     PATOMIC_DEFINE_XCHG_OPS_CREATE(type, name, vis_p, inv, order, ops)       \
     PATOMIC_DEFINE_BITWISE_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops) \
     PATOMIC_DEFINE_BINARY_OPS_CREATE(type, name, vis_p, order, ops)          \
     PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)      \
+    PATOMIC_DEFINE_WAIT_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops)    \
+    PATOMIC_DEFINE_BATCH_OPS_CREATE(                                         \
+        type, name, vis_p, inv, order, ops,                                  \
+        patomic_opimpl_store_array_##name, NULL                              \
+    )                                                                        \
     static patomic_##ops##_t                                                 \
     patomic_ops_create_##name(void)                                          \
     {                                                                        \
@@ -438,6 +949,8 @@
         pao.bitwise_ops = patomic_ops_bitwise_create_##name();               \
         pao.binary_ops = patomic_ops_binary_create_##name();                 \
         pao.arithmetic_ops = patomic_ops_arithmetic_create_##name();         \
+        pao.wait_ops = patomic_ops_wait_create_##name();                     \
+        pao.batch_ops = patomic_ops_batch_create_##name();                   \
         return pao;                                                          \
     }
 
@@ -447,6 +960,11 @@
     PATOMIC_DEFINE_BITWISE_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops) \
     PATOMIC_DEFINE_BINARY_OPS_CREATE(type, name, vis_p, order, ops)          \
     PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)      \
+    PATOMIC_DEFINE_WAIT_OPS_CREATE_NO_LOAD(type, name, vis_p, order, ops)    \
+    PATOMIC_DEFINE_BATCH_OPS_CREATE(                                         \
+        type, name, vis_p, inv, order, ops,                                  \
+        NULL, NULL                                                           \
+    )                                                                        \
     static patomic_##ops##_t                                                 \
     patomic_ops_create_##name(void)                                          \
     {                                                                        \
@@ -457,27 +975,38 @@
         pao.bitwise_ops = patomic_ops_bitwise_create_##name();               \
         pao.binary_ops = patomic_ops_binary_create_##name();                 \
         pao.arithmetic_ops = patomic_ops_arithmetic_create_##name();         \
+        pao.wait_ops = patomic_ops_wait_create_##name();                     \
+        pao.batch_ops = patomic_ops_batch_create_##name();                   \
         return pao;                                                          \
     }
 
-#define PATOMIC_DEFINE_OPS_CREATE_RSC(type, name, vis_p, inv, order, ops) \
-    PATOMIC_DEFINE_STORE_OP(type, name, vis_p, order)                     \
-    PATOMIC_DEFINE_LOAD_OP(type, name, vis_p, order)                      \
-    PATOMIC_DEFINE_XCHG_OPS_CREATE(type, name, vis_p, inv, order, ops)    \
-    PATOMIC_DEFINE_BITWISE_OPS_CREATE_LOAD(type, name, vis_p, order, ops) \
-    PATOMIC_DEFINE_BINARY_OPS_CREATE(type, name, vis_p, order, ops)       \
-    PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)   \
-    static patomic_##ops##_t                                              \
-    patomic_ops_create_##name(void)                                       \
-    {                                                                     \
-        patomic_##ops##_t pao;                                            \
-        pao.fp_store = patomic_opimpl_store_##name;                       \
-        pao.fp_load = patomic_opimpl_load_##name;                         \
-        pao.xchg_ops = patomic_ops_xchg_create_##name();                  \
-        pao.bitwise_ops = patomic_ops_bitwise_create_##name();            \
-        pao.binary_ops = patomic_ops_binary_create_##name();              \
-        pao.arithmetic_ops = patomic_ops_arithmetic_create_##name();      \
-        return pao;                                                       \
+#define PATOMIC_DEFINE_OPS_CREATE_RSC(type, name, vis_p, inv, order, ops)   \
+    PATOMIC_DEFINE_STORE_OP(type, name, vis_p, order)                       \
+    PATOMIC_DEFINE_STORE_ARRAY_OP(type, name, vis_p, order)                 \
+    PATOMIC_DEFINE_LOAD_OP(type, name, vis_p, order)                        \
+    PATOMIC_DEFINE_LOAD_ARRAY_OP(type, name, vis_p, order)                  \
+    PATOMIC_DEFINE_XCHG_OPS_CREATE(type, name, vis_p, inv, order, ops)      \
+    PATOMIC_DEFINE_BITWISE_OPS_CREATE_LOAD(type, name, vis_p, order, ops)   \
+    PATOMIC_DEFINE_BINARY_OPS_CREATE(type, name, vis_p, order, ops)         \
+    PATOMIC_DEFINE_ARITHMETIC_OPS_CREATE(type, name, vis_p, order, ops)     \
+    PATOMIC_DEFINE_WAIT_OPS_CREATE_LOAD(type, name, vis_p, order, ops)      \
+    PATOMIC_DEFINE_BATCH_OPS_CREATE(                                        \
+        type, name, vis_p, inv, order, ops,                                 \
+        patomic_opimpl_store_array_##name, patomic_opimpl_load_array_##name \
+    )                                                                       \
+    static patomic_##ops##_t                                                \
+    patomic_ops_create_##name(void)                                         \
+    {                                                                       \
+        patomic_##ops##_t pao;                                              \
+        pao.fp_store = patomic_opimpl_store_##name;                         \
+        pao.fp_load = patomic_opimpl_load_##name;                           \
+        pao.xchg_ops = patomic_ops_xchg_create_##name();                    \
+        pao.bitwise_ops = patomic_ops_bitwise_create_##name();              \
+        pao.binary_ops = patomic_ops_binary_create_##name();                \
+        pao.arithmetic_ops = patomic_ops_arithmetic_create_##name();        \
+        pao.wait_ops = patomic_ops_wait_create_##name();                    \
+        pao.batch_ops = patomic_ops_batch_create_##name();                  \
+        return pao;                                                         \
     }
 
 #define PATOMIC_DEFINE_OPS_CREATE_ALL(type, name)                \
@@ -526,6 +1055,16 @@
     #define HAS_LLONG_IMPL 0
 #endif
 
+/* there are no lock-free macros for floating types, so assume they match the
+ * integer types with the same width; this is checked again at runtime */
+#if ATOMIC_INT_LOCK_FREE
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE_ALL(float, float)
+#endif
+
+#if HAS_LLONG_IMPL
+    PATOMIC_DEFINE_FLOAT_OPS_CREATE_ALL(double, double)
+#endif
+
 
 #define PATOMIC_RET_OPS(type, name, byte_width, order, ops)             \
     if ((byte_width == sizeof(type)) &&                                 \
@@ -573,6 +1112,52 @@
         PATOMIC_IGNORE_UNUSED(obj);                           \
     }
 
+#define PATOMIC_RET_FLOAT_OPS(type, name, byte_width, order, ops)       \
+    if ((byte_width == sizeof(type)) &&                                 \
+        (byte_width == sizeof(_Atomic(type))))                          \
+    {                                                                   \
+        _Atomic(type) obj;                                              \
+        if (atomic_is_lock_free(&obj))                                  \
+        {                                                               \
+            switch (order)                                              \
+            {                                                           \
+                case patomic_RELAXED:                                   \
+                    ops = patomic_ops_float_create_##name##_relaxed();  \
+                    break;                                              \
+                case patomic_CONSUME:                                   \
+                case patomic_ACQUIRE:                                   \
+                    ops = patomic_ops_float_create_##name##_acquire();  \
+                    break;                                              \
+                case patomic_RELEASE:                                   \
+                    ops = patomic_ops_float_create_##name##_release();  \
+                    break;                                              \
+                case patomic_ACQ_REL:                                   \
+                    ops = patomic_ops_float_create_##name##_acq_rel();  \
+                    break;                                              \
+                case patomic_SEQ_CST:                                   \
+                    ops = patomic_ops_float_create_##name##_seq_cst();  \
+                    break;                                              \
+                default:                                                \
+                    patomic_assert_always("invalid memory order" && 0); \
+            }                                                           \
+            return ops;                                                 \
+        }                                                               \
+        PATOMIC_IGNORE_UNUSED(obj);                                     \
+    }
+
+#define PATOMIC_RET_FLOAT_OPS_EXPLICIT(type, name, byte_width, ops) \
+    if ((byte_width == sizeof(type)) &&                             \
+        (byte_width == sizeof(_Atomic(type))))                      \
+    {                                                               \
+        _Atomic(type) obj;                                          \
+        if (atomic_is_lock_free(&obj))                              \
+        {                                                           \
+            ops = patomic_ops_float_create_##name##_explicit();     \
+            return ops;                                             \
+        }                                                           \
+        PATOMIC_IGNORE_UNUSED(obj);                                 \
+    }
+
 #define PATOMIC_RET_ALIGN(type, byte_width)                          \
     if ((byte_width == sizeof(type)) &&                              \
         (byte_width == sizeof(_Atomic(type))))                       \
@@ -653,6 +1238,48 @@ patomic_create_ops_explicit(
     return ops;
 }
 
+static patomic_ops_float_t
+patomic_create_ops_float(
+    const size_t byte_width,
+    const patomic_memory_order_t order
+)
+{
+    /* setup */
+    patomic_ops_float_t ops = {0};
+    patomic_assert_always(patomic_is_valid_order((int) order));
+
+    /* set and return implicit floating-point atomic ops */
+#if ATOMIC_INT_LOCK_FREE
+    PATOMIC_RET_FLOAT_OPS(float, float, byte_width, order, ops)
+#endif
+#if HAS_LLONG_IMPL
+    PATOMIC_RET_FLOAT_OPS(double, double, byte_width, order, ops)
+#endif
+
+    /* fallback, width not supported */
+    return ops;
+}
+
+static patomic_ops_explicit_float_t
+patomic_create_ops_explicit_float(
+    const size_t byte_width
+)
+{
+    /* setup */
+    patomic_ops_explicit_float_t ops = {0};
+
+    /* set and return explicit floating-point atomic ops */
+#if ATOMIC_INT_LOCK_FREE
+    PATOMIC_RET_FLOAT_OPS_EXPLICIT(float, float, byte_width, ops)
+#endif
+#if HAS_LLONG_IMPL
+    PATOMIC_RET_FLOAT_OPS_EXPLICIT(double, double, byte_width, ops)
+#endif
+
+    /* fallback, width not supported */
+    return ops;
+}
+
 static patomic_align_t
 patomic_create_align(
     const size_t byte_width
@@ -697,12 +1324,21 @@ patomic_impl_create_std(
 {
     /* setup */
     patomic_t impl;
-    PATOMIC_IGNORE_UNUSED(options);
 
     /* set members */
     impl.ops = patomic_create_ops(byte_width, order);
+    impl.ops.float_ops = patomic_create_ops_float(byte_width, order);
     impl.align = patomic_create_align(byte_width);
 
+    /* wait operations use process-local buckets and private futexes */
+    if (options & (unsigned int) patomic_option_PROCESS_SHARED)
+    {
+        impl.ops.wait_ops.fp_wait = NULL;
+        impl.ops.wait_ops.fp_wait_timed = NULL;
+        impl.ops.wait_ops.fp_notify_one = NULL;
+        impl.ops.wait_ops.fp_notify_all = NULL;
+    }
+
     /* return */
     return impl;
 }
@@ -715,12 +1351,211 @@ patomic_impl_create_explicit_std(
 {
     /* setup */
     patomic_explicit_t impl;
-    PATOMIC_IGNORE_UNUSED(options);
 
     /* set members */
     impl.ops = patomic_create_ops_explicit(byte_width);
+    impl.ops.float_ops = patomic_create_ops_explicit_float(byte_width);
     impl.align = patomic_create_align(byte_width);
 
+    /* wait operations use process-local buckets and private futexes */
+    if (options & (unsigned int) patomic_option_PROCESS_SHARED)
+    {
+        impl.ops.wait_ops.fp_wait = NULL;
+        impl.ops.wait_ops.fp_wait_timed = NULL;
+        impl.ops.wait_ops.fp_notify_one = NULL;
+        impl.ops.wait_ops.fp_notify_all = NULL;
+    }
+
+    /* return */
+    return impl;
+}
+
+
+static void
+patomic_opimpl_thread_fence_std(
+    const int order
+)
+{
+    patomic_assert(patomic_is_valid_order(order));
+    atomic_thread_fence((memory_order) order);
+}
+
+static void
+patomic_opimpl_signal_fence_std(
+    const int order
+)
+{
+    patomic_assert(patomic_is_valid_order(order));
+    atomic_signal_fence((memory_order) order);
+}
+
+patomic_fence_t
+patomic_impl_create_fence_std(void)
+{
+    /* setup */
+    patomic_fence_t impl;
+
+    /* set members */
+    impl.fp_thread_fence = patomic_opimpl_thread_fence_std;
+    impl.fp_signal_fence = patomic_opimpl_signal_fence_std;
+
+    /* return */
+    return impl;
+}
+
+
+/* bytes are copied in whole chunks of the widest lock-free type, with only
+ * the unaligned head and the tail copied a byte at a time */
+#undef HAS_MEMCPY_IMPL
+#if !ATOMIC_CHAR_LOCK_FREE
+    #define HAS_MEMCPY_IMPL 0
+#elif HAS_LLONG_IMPL
+    #define HAS_MEMCPY_IMPL 1
+    #define MEMCPY_CHUNK_SIZE sizeof(patomic_llong_unsigned_t)
+    #define patomic_opimpl_load_memcpy_chunks  patomic_opimpl_load_array_llong_relaxed
+    #define patomic_opimpl_store_memcpy_chunks patomic_opimpl_store_array_llong_relaxed
+#elif ATOMIC_LONG_LOCK_FREE
+    #define HAS_MEMCPY_IMPL 1
+    #define MEMCPY_CHUNK_SIZE sizeof(unsigned long)
+    #define patomic_opimpl_load_memcpy_chunks  patomic_opimpl_load_array_long_relaxed
+    #define patomic_opimpl_store_memcpy_chunks patomic_opimpl_store_array_long_relaxed
+#elif ATOMIC_INT_LOCK_FREE
+    #define HAS_MEMCPY_IMPL 1
+    #define MEMCPY_CHUNK_SIZE sizeof(unsigned int)
+    #define patomic_opimpl_load_memcpy_chunks  patomic_opimpl_load_array_int_relaxed
+    #define patomic_opimpl_store_memcpy_chunks patomic_opimpl_store_array_int_relaxed
+#else
+    #define HAS_MEMCPY_IMPL 1
+    #define MEMCPY_CHUNK_SIZE sizeof(unsigned char)
+    #define patomic_opimpl_load_memcpy_chunks  patomic_opimpl_load_array_char_relaxed
+    #define patomic_opimpl_store_memcpy_chunks patomic_opimpl_store_array_char_relaxed
+#endif
+
+
+#if HAS_MEMCPY_IMPL
+
+static void
+patomic_memcpy_split(
+    const volatile void *const shared,
+    const size_t byte_count,
+    size_t *const head,
+    size_t *const body
+)
+{
+    /* declarations */
+    const size_t chunk_size = MEMCPY_CHUNK_SIZE;
+    const patomic_intptr_unsigned_t addr = (patomic_intptr_unsigned_t) shared;
+    const size_t misalign = (size_t) (addr % chunk_size);
+
+    /* bytes before the first chunk aligned address */
+    *head = (misalign == 0) ? 0 : chunk_size - misalign;
+    if (*head > byte_count)
+    {
+        *head = byte_count;
+    }
+
+    /* bytes in whole chunks after the head */
+    *body = ((byte_count - *head) / chunk_size) * chunk_size;
+}
+
+static void
+patomic_opimpl_load_memcpy_std(
+    void *const dst,
+    const volatile void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    /* declarations */
+    const volatile unsigned char *const bsrc = (const volatile unsigned char *) src;
+    unsigned char *const bdst = (unsigned char *) dst;
+    size_t head;
+    size_t body;
+
+    /* assertions */
+    patomic_assert(byte_count == 0 || src != NULL);
+    patomic_assert(byte_count == 0 || dst != NULL);
+    patomic_assert(PATOMIC_IS_VALID_LOAD_ORDER(order));
+
+    /* operation */
+    if (byte_count != 0)
+    {
+        patomic_memcpy_split(src, byte_count, &head, &body);
+        patomic_opimpl_load_array_char_relaxed(bsrc, bdst, head);
+        if (body != 0)
+        {
+            patomic_opimpl_load_memcpy_chunks(
+                bsrc + head, bdst + head, body / MEMCPY_CHUNK_SIZE
+            );
+        }
+        patomic_opimpl_load_array_char_relaxed(
+            bsrc + head + body, bdst + head + body, byte_count - head - body
+        );
+    }
+
+    /* order subsequent accesses after the loads */
+    if (order != patomic_RELAXED)
+    {
+        atomic_thread_fence((memory_order) order);
+    }
+}
+
+static void
+patomic_opimpl_store_memcpy_std(
+    volatile void *const dst,
+    const void *const src,
+    const size_t byte_count,
+    const int order
+)
+{
+    /* declarations */
+    volatile unsigned char *const bdst = (volatile unsigned char *) dst;
+    const unsigned char *const bsrc = (const unsigned char *) src;
+    size_t head;
+    size_t body;
+
+    /* assertions */
+    patomic_assert(byte_count == 0 || src != NULL);
+    patomic_assert(byte_count == 0 || dst != NULL);
+    patomic_assert(PATOMIC_IS_VALID_STORE_ORDER(order));
+
+    /* order prior accesses before the stores */
+    if (order != patomic_RELAXED)
+    {
+        atomic_thread_fence((memory_order) order);
+    }
+
+    /* operation */
+    if (byte_count != 0)
+    {
+        patomic_memcpy_split(dst, byte_count, &head, &body);
+        patomic_opimpl_store_array_char_relaxed(bdst, bsrc, head);
+        if (body != 0)
+        {
+            patomic_opimpl_store_memcpy_chunks(
+                bdst + head, bsrc + head, body / MEMCPY_CHUNK_SIZE
+            );
+        }
+        patomic_opimpl_store_array_char_relaxed(
+            bdst + head + body, bsrc + head + body, byte_count - head - body
+        );
+    }
+}
+
+#endif  /* HAS_MEMCPY_IMPL */
+
+patomic_memcpy_t
+patomic_impl_create_memcpy_std(void)
+{
+    /* zero all fields */
+    patomic_memcpy_t impl = {0};
+
+    /* set members */
+#if HAS_MEMCPY_IMPL
+    impl.fp_load_memcpy = patomic_opimpl_load_memcpy_std;
+    impl.fp_store_memcpy = patomic_opimpl_store_memcpy_std;
+#endif
+
     /* return */
     return impl;
 }
@@ -775,9 +1610,194 @@ patomic_impl_create_explicit_std(
 }
 
 
+patomic_fence_t
+patomic_impl_create_fence_std(void)
+{
+    /* zero all fields */
+    patomic_fence_t impl = {0};
+
+    /* return */
+    return impl;
+}
+
+
+patomic_memcpy_t
+patomic_impl_create_memcpy_std(void)
+{
+    /* zero all fields */
+    patomic_memcpy_t impl = {0};
+
+    /* return */
+    return impl;
+}
+
+
 #endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && PATOMIC_HAS_IR_TWOS_COMPL */
 
 
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && PATOMIC_HAS_IR_TWOS_COMPL && \
+    !PATOMIC_THREAD_LOCAL_IS_EMPTY
+
+
+#include <patomic/stdlib/assert.h>
+
+#include <patomic/wrapped/tsx.h>
+
+#include <stdatomic.h>
+
+
+/*
+ * TRANSACTION (emulated):
+ * - every transaction holds a single global spinlock
+ * - the lock is reentrant, with each thread tracking its nesting depth
+ * - writes cannot be rolled back, so transactions never abort and explicit
+ *   aborts are not supported
+ */
+static atomic_int patomic_transaction_lock_std;
+
+static PATOMIC_THREAD_LOCAL int patomic_transaction_depth_std;
+
+
+static unsigned long
+patomic_opimpl_tbegin_std(void)
+{
+    /* only the outermost transaction takes the lock */
+    if (patomic_transaction_depth_std == 0)
+    {
+        while (atomic_exchange_explicit(
+            &patomic_transaction_lock_std, 1, memory_order_acquire
+        ))
+        {
+            while (atomic_load_explicit(
+                &patomic_transaction_lock_std, memory_order_relaxed
+            ))
+            {
+                /* spin on load to avoid contended writes */
+            }
+        }
+    }
+    ++patomic_transaction_depth_std;
+
+    /* transaction always starts successfully */
+    return 0ul;
+}
+
+
+static void
+patomic_opimpl_tcommit_std(void)
+{
+    /* assertions */
+    patomic_assert(patomic_transaction_depth_std > 0);
+
+    /* only the outermost transaction releases the lock */
+    if (--patomic_transaction_depth_std == 0)
+    {
+        atomic_store_explicit(
+            &patomic_transaction_lock_std, 0, memory_order_release
+        );
+    }
+}
+
+
+static int
+patomic_opimpl_tdepth_std(void)
+{
+    return patomic_transaction_depth_std;
+}
+
+
+static int
+patomic_opimpl_flag_test_std(
+    const patomic_transaction_flag_t *const flag
+)
+{
+    /* assertions */
+    patomic_assert(flag != NULL);
+
+    /* operation */
+    return atomic_load_explicit(
+        (const volatile _Atomic(unsigned char) *) flag, memory_order_acquire
+    ) != 0;
+}
+
+
+static int
+patomic_opimpl_flag_test_set_std(
+    patomic_transaction_flag_t *const flag
+)
+{
+    /* assertions */
+    patomic_assert(flag != NULL);
+
+    /* operation */
+    return atomic_exchange_explicit(
+        (volatile _Atomic(unsigned char) *) flag, 1, memory_order_acquire
+    ) != 0;
+}
+
+
+static void
+patomic_opimpl_flag_clear_std(
+    patomic_transaction_flag_t *const flag
+)
+{
+    /* assertions */
+    patomic_assert(flag != NULL);
+
+    /* operation */
+    atomic_store_explicit(
+        (volatile _Atomic(unsigned char) *) flag, 0, memory_order_release
+    );
+}
+
+
+PATOMIC_WRAPPED_TSX_DEFINE_OPS_CREATE(
+    lock_std, patomic_opimpl_tbegin_std, patomic_opimpl_tcommit_std
+)
+
+
+patomic_transaction_t
+patomic_impl_create_transaction_std(
+    const unsigned int options
+)
+{
+    /* zero all fields */
+    patomic_transaction_t impl = {0};
+
+    /* emulation is opt-in, since it serializes all transactions */
+    if (!(options & (unsigned int) patomic_option_TRANSACTION_LOCK))
+    {
+        return impl;
+    }
+
+    /* the lock and nesting depth are process-local */
+    if (options & (unsigned int) patomic_option_PROCESS_SHARED)
+    {
+        return impl;
+    }
+
+    /* operations */
+    impl.ops = patomic_ops_create_lock_std();
+
+    /* flag operations */
+    impl.ops.flag_ops.fp_test = patomic_opimpl_flag_test_std;
+    impl.ops.flag_ops.fp_test_set = patomic_opimpl_flag_test_set_std;
+    impl.ops.flag_ops.fp_clear = patomic_opimpl_flag_clear_std;
+
+    /* raw operations (no abort) */
+    impl.ops.raw_ops.fp_tbegin = patomic_opimpl_tbegin_std;
+    impl.ops.raw_ops.fp_tcommit = patomic_opimpl_tcommit_std;
+    impl.ops.raw_ops.fp_ttest = patomic_opimpl_tdepth_std;
+    impl.ops.raw_ops.fp_tdepth = patomic_opimpl_tdepth_std;
+
+    /* return */
+    return impl;
+}
+
+
+#else  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && PATOMIC_HAS_IR_TWOS_COMPL && !PATOMIC_THREAD_LOCAL_IS_EMPTY */
+
+
 patomic_transaction_t
 patomic_impl_create_transaction_std(
     const unsigned int options
@@ -792,3 +1812,67 @@ patomic_impl_create_transaction_std(
     /* return */
     return impl;
 }
+
+
+#endif  /* PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H && PATOMIC_HAS_IR_TWOS_COMPL && !PATOMIC_THREAD_LOCAL_IS_EMPTY */
+
+
+unsigned int
+patomic_impl_emulated_opkinds_std(
+    const size_t byte_width,
+    const patomic_opcat_t opcat
+)
+{
+    /* ignore parameters */
+    PATOMIC_IGNORE_UNUSED(byte_width);
+
+    /* C11 has no atomic fetch_update, bit test-modify, not, negate, minimum,
+     * maximum, saturating arithmetic, or floating-point arithmetic */
+    if (opcat == patomic_opcat_XCHG)
+    {
+        return (unsigned int) patomic_opkind_FETCH_UPDATE;
+    }
+    else if (opcat == patomic_opcat_BIT)
+    {
+        return (unsigned int) patomic_opkind_TEST_COMPL |
+               (unsigned int) patomic_opkind_TEST_SET   |
+               (unsigned int) patomic_opkind_TEST_RESET;
+    }
+    else if (opcat == patomic_opcat_BIN_V || opcat == patomic_opcat_BIN_F)
+    {
+        return (unsigned int) patomic_opkind_NOT;
+    }
+    else if (opcat == patomic_opcat_ARI_V || opcat == patomic_opcat_ARI_F)
+    {
+#if PATOMIC_HAS_C11_ATOMIC_MINMAX
+        return (unsigned int) patomic_opkind_NEG      |
+               (unsigned int) patomic_opkind_ADD_SAT  |
+               (unsigned int) patomic_opkind_SUB_SAT  |
+               (unsigned int) patomic_opkind_UADD_SAT |
+               (unsigned int) patomic_opkind_USUB_SAT;
+#else
+        return (unsigned int) patomic_opkind_NEG      |
+               (unsigned int) patomic_opkind_MIN      |
+               (unsigned int) patomic_opkind_MAX      |
+               (unsigned int) patomic_opkind_UMIN     |
+               (unsigned int) patomic_opkind_UMAX     |
+               (unsigned int) patomic_opkind_ADD_SAT  |
+               (unsigned int) patomic_opkind_SUB_SAT  |
+               (unsigned int) patomic_opkind_UADD_SAT |
+               (unsigned int) patomic_opkind_USUB_SAT;
+#endif
+    }
+    else if (opcat == patomic_opcat_FLT_V || opcat == patomic_opcat_FLT_F)
+    {
+#if PATOMIC_HAS_C11_ATOMIC_FADD
+        return 0u;
+#else
+        return (unsigned int) patomic_opkind_FADD |
+               (unsigned int) patomic_opkind_FSUB;
+#endif
+    }
+    else
+    {
+        return 0u;
+    }
+}
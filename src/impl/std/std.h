@@ -25,7 +25,8 @@
  *   The minimum memory order to perform the operation with.
  *
  * @param options
- *   Value is currently unused.
+ *   If patomic_option_PROCESS_SHARED is set, wait operations are not
+ *   supported. Other values are ignored.
  *
  * @return
  *   Implementation where operations are as C11 atomic operations would be.
@@ -53,7 +54,8 @@ patomic_impl_create_std(
  *   The width of an object to operate on.
  *
  * @param options
- *   Value is currently unused.
+ *   If patomic_option_PROCESS_SHARED is set, wait operations are not
+ *   supported. Other values are ignored.
  *
  * @return
  *   Implementation where operations are as C11 atomic operations would be.
@@ -69,15 +71,22 @@ patomic_impl_create_explicit_std(
  * @addtogroup impl.std
  *
  * @brief
- *   No operations are supported here, since C11 does not provide transactional
- *   operations.
+ *   C11 does not provide transactional operations, so they are only supported
+ *   if emulated with a global reentrant lock.
  *
  * @param options
- *   Value is ignored.
+ *   If patomic_option_TRANSACTION_LOCK is set, all operations except explicit
+ *   aborts are emulated with a global reentrant lock. Otherwise, or if
+ *   patomic_option_PROCESS_SHARED is also set, no operations are supported.
+ *
+ * @warning
+ *   Emulated operations access memory with plain copies while holding the
+ *   lock, so they are not isolated from concurrent non-transactional
+ *   operations on the same memory.
  *
  * @return
- *   Implementation where no operations are supported and alignment requirements
- *   are the minimum possible.
+ *   Implementation where either emulated operations or no operations are
+ *   supported.
  */
 patomic_transaction_t
 patomic_impl_create_transaction_std(
@@ -85,4 +94,56 @@ patomic_impl_create_transaction_std(
 );
 
 
+/**
+ * @addtogroup impl.std
+ *
+ * @brief
+ *   Obtains which operations are implemented as a cmpxchg loop, since C11 does
+ *   not provide an equivalent primitive.
+ *
+ * @param byte_width
+ *   Value is ignored.
+ *
+ * @param opcat
+ *   Any single patomic_opcat_t value with a single bit set.
+ *
+ * @return
+ *   The opkinds in the opcat which are emulated with a cmpxchg loop, if they
+ *   are supported.
+ */
+unsigned int
+patomic_impl_emulated_opkinds_std(
+    size_t byte_width,
+    patomic_opcat_t opcat
+);
+
+
+/**
+ * @addtogroup impl.std
+ *
+ * @brief
+ *   Support for fences depends on the availability of C11 atomics.
+ *
+ * @return
+ *   Fences as C11 atomic_thread_fence and atomic_signal_fence would be.
+ */
+patomic_fence_t
+patomic_impl_create_fence_std(void);
+
+
+/**
+ * @addtogroup impl.std
+ *
+ * @brief
+ *   Support for atomic memcpy depends on the availability of lock-free C11
+ *   atomics for char.
+ *
+ * @return
+ *   Atomic memcpy operations using relaxed C11 atomic loads and stores of
+ *   the widest lock-free integer type, followed or preceded by a C11 fence.
+ */
+patomic_memcpy_t
+patomic_impl_create_memcpy_std(void);
+
+
 #endif  /* PATOMIC_IMPL_STD_H */
@@ -102,6 +102,34 @@
 #endif
 
 
+#ifndef PATOMIC_HAS_THREAD_LOCAL
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '_Thread_local' is available as a keyword.
+     *
+     * @note
+     *   Usually required: C11.
+     */
+    #define PATOMIC_HAS_THREAD_LOCAL 0
+#endif
+
+
+#ifndef PATOMIC_HAS_GNU_THREAD_LOCAL
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '__thread' is available as a keyword.
+     *
+     * @note
+     *   Usually required: GNU compatible(-ish) compiler.
+     */
+    #define PATOMIC_HAS_GNU_THREAD_LOCAL 0
+#endif
+
+
 #ifndef PATOMIC_HAS_STDATOMIC_H
     /**
      * @addtogroup config.safe
@@ -144,6 +172,20 @@
 #endif
 
 
+#ifndef PATOMIC_HAS_IMMINTRIN_H
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   <immintrin.h> header is available.
+     *
+     * @note
+     *   Usually requires: x86 compiler.
+     */
+    #define PATOMIC_HAS_IMMINTRIN_H 0
+#endif
+
+
 #ifndef PATOMIC_HAS_LONG_LONG
     /**
      * @addtogroup config.safe
@@ -415,6 +457,20 @@
 #endif
 
 
+#ifndef PATOMIC_HAS_THREAD_LOCAL_DSPC
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '__declspec(thread)' is available as a variable attribute.
+     *
+     * @note
+     *   Usually requires: Microsoft compatible(-ish) compiler.
+     */
+    #define PATOMIC_HAS_THREAD_LOCAL_DSPC 0
+#endif
+
+
 #ifndef PATOMIC_HAS_MS_ASSUME
     /**
      * @addtogroup config.safe
@@ -443,6 +499,20 @@
 #endif
 
 
+#ifndef PATOMIC_HAS_BUILTIN_PREFETCH
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '__builtin_prefetch(const void*)' is available as a function.
+     *
+     * @note
+     *   Usually requires: GNU compatible(-ish) compiler.
+     */
+    #define PATOMIC_HAS_BUILTIN_PREFETCH 0
+#endif
+
+
 #ifndef PATOMIC_HAS_WCHAR_FWIDE
     /**
      * @addtogroup config.safe
@@ -585,6 +655,96 @@
 #endif
 
 
+#ifndef PATOMIC_HAS_LINUX_FUTEX
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   'syscall(SYS_futex, ...)' and 'clock_gettime(CLOCK_MONOTONIC, ...)' are
+     *   available as functions.
+     *
+     * @note
+     *   Usually required: Linux.
+     */
+    #define PATOMIC_HAS_LINUX_FUTEX 0
+#endif
+
+
+#ifndef PATOMIC_HAS_C11_ATOMIC_MINMAX
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '__c11_atomic_fetch_min(volatile _Atomic(T)*, T, int)' and
+     *   '__c11_atomic_fetch_max(volatile _Atomic(T)*, T, int)' are available as
+     *   functions.
+     *
+     * @note
+     *   Usually requires: clang compatible(-ish) compiler.
+     */
+    #define PATOMIC_HAS_C11_ATOMIC_MINMAX 0
+#endif
+
+
+#ifndef PATOMIC_HAS_C11_ATOMIC_FADD
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   '__c11_atomic_fetch_add(volatile _Atomic(F)*, F, int)' and
+     *   '__c11_atomic_fetch_sub(volatile _Atomic(F)*, F, int)' are available as
+     *   functions where F is float or double.
+     *
+     * @note
+     *   Usually requires: clang compatible(-ish) compiler.
+     */
+    #define PATOMIC_HAS_C11_ATOMIC_FADD 0
+#endif
+
+
+#ifndef PATOMIC_HAS_SYSCONF_L1_DCACHE
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   'sysconf(_SC_LEVEL1_DCACHE_LINESIZE)' is available as a function.
+     *
+     * @note
+     *   Usually requires: glibc.
+     */
+    #define PATOMIC_HAS_SYSCONF_L1_DCACHE 0
+#endif
+
+
+#ifndef PATOMIC_HAS_MADV_HUGEPAGE
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   'madvise(void*, size_t, MADV_HUGEPAGE)' is available as a function.
+     *
+     * @note
+     *   Usually requires: Linux.
+     */
+    #define PATOMIC_HAS_MADV_HUGEPAGE 0
+#endif
+
+
+#ifndef PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    /**
+     * @addtogroup config.safe
+     *
+     * @brief
+     *   Operations implemented with a cmpxchg loop record how many iterations
+     *   each call took, readable with patomic_profile_cmpxchg_histogram.
+     *
+     * @note
+     *   Usually set by: the PATOMIC_ENABLE_CMPXCHG_HISTOGRAM CMake option.
+     */
+    #define PATOMIC_ENABLE_CMPXCHG_HISTOGRAM 0
+#endif
+
+
 /*
  * UNSAFE CONSTANTS
  * ================
@@ -0,0 +1,97 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_INTERNAL_BULK_H
+#define PATOMIC_INTERNAL_BULK_H
+
+#include <patomic/config.h>
+
+#include <stddef.h>
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Size in bytes of a vector load or store which the architecture guarantees
+ *   is performed as a single atomic access when naturally aligned, or 0 if no
+ *   such access is known to be available.
+ *
+ * @note
+ *   x86 processors which support AVX guarantee that 16 byte aligned vector
+ *   accesses are atomic. Without AVX, vector accesses may be split, so bulk
+ *   operations fall back to scalar atomic accesses.
+ */
+#undef PATOMIC_INTERNAL_BULK_VECTOR_SIZE
+#if PATOMIC_HAS_IMMINTRIN_H && defined(__AVX__)
+    #define PATOMIC_INTERNAL_BULK_VECTOR_SIZE 16
+#else
+    #define PATOMIC_INTERNAL_BULK_VECTOR_SIZE 0
+#endif
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Computes the range of elements in a contiguous array of objects which can
+ *   be accessed with vector loads and stores.
+ *
+ * @details
+ *   Elements in the range [*begin, *end) start on a vector aligned address and
+ *   fill a whole number of vectors. If no elements can be accessed with vector
+ *   loads and stores, both *begin and *end are set to 'count'.
+ *
+ * @param objs
+ *   Pointer to contiguous array of objects, each aligned to at least
+ *   'byte_width'.
+ */
+void
+patomic_internal_bulk_vector_range(
+    const volatile void *objs,
+    size_t byte_width,
+    size_t count,
+    size_t *begin,
+    size_t *end
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Copies 'byte_count' bytes from an aligned atomic source to a destination
+ *   with no alignment requirements, with each vector atomically loaded.
+ *
+ * @note
+ *   Must only be called with a range computed by
+ *   patomic_internal_bulk_vector_range.
+ */
+void
+patomic_internal_bulk_load_vectors(
+    const volatile void *src,
+    void *dst,
+    size_t byte_count
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Copies 'byte_count' bytes from a source with no alignment requirements to
+ *   an aligned atomic destination, with each vector atomically stored.
+ *
+ * @note
+ *   Must only be called with a range computed by
+ *   patomic_internal_bulk_vector_range.
+ */
+void
+patomic_internal_bulk_store_vectors(
+    volatile void *dst,
+    const void *src,
+    size_t byte_count
+);
+
+
+#endif  /* PATOMIC_INTERNAL_BULK_H */
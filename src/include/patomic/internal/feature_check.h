@@ -80,4 +80,42 @@ patomic_internal_feature_check_leaf_transaction(
 );
 
 
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Sets every operation in "ops" to NULL if its opcat is not in "opcats" or
+ *   its opkind is not in "opkinds".
+ *
+ * @note
+ *   The same "opkinds" is applied to every opcat in "opcats". Transaction
+ *   opcats are ignored.
+ */
+void
+patomic_internal_feature_mask(
+    patomic_ops_t *ops,
+    unsigned int opcats,
+    unsigned int opkinds
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Sets every operation in "ops" to NULL if its opcat is not in "opcats" or
+ *   its opkind is not in "opkinds".
+ *
+ * @note
+ *   The same "opkinds" is applied to every opcat in "opcats". Transaction
+ *   opcats are ignored.
+ */
+void
+patomic_internal_feature_mask_explicit(
+    patomic_ops_explicit_t *ops,
+    unsigned int opcats,
+    unsigned int opkinds
+);
+
+
 #endif  /* PATOMIC_INTERNAL_FEATURE_CHECK */
@@ -0,0 +1,106 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_INTERNAL_PROFILE_H
+#define PATOMIC_INTERNAL_PROFILE_H
+
+#include <patomic/api/core.h>
+#include <patomic/api/profile.h>
+
+#include <stddef.h>
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Replaces each supported operation with a wrapper which updates the
+ *   profiling counters and forwards to the original operation.
+ *
+ * @note
+ *   There is a fixed number of distinct sets of operations which can be
+ *   wrapped. If none are left, or profiling is not supported, the operations
+ *   are left unmodified.
+ */
+void
+patomic_internal_profile_wrap(
+    patomic_t *obj
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Replaces each supported operation with a wrapper which updates the
+ *   profiling counters and forwards to the original operation.
+ *
+ * @note
+ *   There is a fixed number of distinct sets of operations which can be
+ *   wrapped. If none are left, or profiling is not supported, the operations
+ *   are left unmodified.
+ */
+void
+patomic_internal_profile_wrap_explicit(
+    patomic_explicit_t *obj
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Checks whether the operations were wrapped by
+ *   patomic_internal_profile_wrap, and if so obtains the operations they
+ *   forward to.
+ *
+ * @returns
+ *   Returns 1 and writes the forwarded operations to 'unwrapped' if the
+ *   operations are wrapped, otherwise returns 0 and leaves 'unwrapped' as is.
+ */
+int
+patomic_internal_profile_unwrap(
+    const patomic_ops_t *ops,
+    patomic_ops_t *unwrapped
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Checks whether the operations were wrapped by
+ *   patomic_internal_profile_wrap_explicit, and if so obtains the operations
+ *   they forward to.
+ *
+ * @returns
+ *   Returns 1 and writes the forwarded operations to 'unwrapped' if the
+ *   operations are wrapped, otherwise returns 0 and leaves 'unwrapped' as is.
+ */
+int
+patomic_internal_profile_unwrap_explicit(
+    const patomic_ops_explicit_t *ops,
+    patomic_ops_explicit_t *unwrapped
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Records the number of iterations a cmpxchg loop took in the calling
+ *   thread's histogram for the given slot and width.
+ *
+ * @note
+ *   Only called from operations defined with PATOMIC_WRAPPED_CMPXCHG_* macros
+ *   when PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
+ */
+void
+patomic_internal_profile_record_cmpxchg(
+    patomic_profile_slot_t slot,
+    size_t byte_width,
+    unsigned long iterations
+);
+
+
+#endif  /* PATOMIC_INTERNAL_PROFILE_H */
@@ -0,0 +1,27 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_INTERNAL_THREAD_H
+#define PATOMIC_INTERNAL_THREAD_H
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Obtains a small index identifying the calling thread, used to pick which
+ *   shard of per-thread accumulators to update.
+ *
+ * @details
+ *   Each thread is assigned an index on first use, in increasing order of
+ *   first use starting from zero.
+ *
+ * @warning
+ *   If thread local storage or atomics are not available, all threads share
+ *   index zero. Callers must remain correct in that case.
+ */
+unsigned int
+patomic_internal_thread_index(void);
+
+
+#endif  /* PATOMIC_INTERNAL_THREAD_H */
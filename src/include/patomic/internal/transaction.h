@@ -6,6 +6,8 @@
 
 #include <patomic/api/transaction.h>
 
+#include <stddef.h>
+
 
 /**
  * @addtogroup internal
@@ -28,4 +30,77 @@
       ((((unsigned long) (reason)) & 0xFFul) << 8ul) )
 
 
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Records the final status and attempts made of a single path of a
+ *   transaction operation in the calling thread's statistics.
+ *
+ * @param status
+ *   The status from the final attempt on the path.
+ *
+ * @param attempts_made
+ *   The number of attempts made on the path.
+ *
+ * @param is_fallback
+ *   Non-zero if the path is a fallback path, otherwise zero.
+ */
+void
+patomic_internal_transaction_stats_record(
+    unsigned long status,
+    unsigned long attempts_made,
+    int is_fallback
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Copies "count" bytes from "src" to "dest" in a manner which is safe to
+ *   use inside a transaction.
+ *
+ * @details
+ *   If both buffers have the same alignment relative to a word, the bulk of
+ *   the buffers is copied with aligned word (or vector, if available)
+ *   accesses, and only the head and tail are copied one byte at a time.
+ *   Otherwise every byte is copied individually.
+ *
+ * @note
+ *   Necessary because on some platforms memcpy uses instructions which will
+ *   cause a transaction to abort.
+ */
+void
+patomic_internal_transaction_memcpy(
+    volatile void *dest,
+    const volatile void *src,
+    size_t count
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Compares "count" bytes of "lhs" and "rhs" as memcmp would, in a manner
+ *   which is safe to use inside a transaction.
+ *
+ * @details
+ *   Buffers are compared with the same access widths as
+ *   patomic_internal_transaction_memcpy. If a word or vector differs, its
+ *   bytes are compared individually to determine the ordering.
+ *
+ * @returns
+ *   -1 if "lhs" compares less than "rhs", 1 if it compares greater, and 0 if
+ *   all bytes are equal.
+ */
+int
+patomic_internal_transaction_memcmp(
+    const volatile void *lhs,
+    const volatile void *rhs,
+    size_t count
+);
+
+
 #endif  /* PATOMIC_INTERNAL_TRANSACTION */
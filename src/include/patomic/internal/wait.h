@@ -0,0 +1,98 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_INTERNAL_WAIT_H
+#define PATOMIC_INTERNAL_WAIT_H
+
+#include <patomic/config.h>
+
+#include <stddef.h>
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Whether patomic_internal_wait and patomic_internal_notify are able to
+ *   block and unblock threads.
+ *
+ * @note
+ *   If this is 0, implementations should not provide wait and notify
+ *   operations.
+ */
+#undef PATOMIC_INTERNAL_WAIT_IS_SUPPORTED
+#define PATOMIC_INTERNAL_WAIT_IS_SUPPORTED \
+    (PATOMIC_HAS_LINUX_FUTEX && PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H)
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Function signature for checking whether the value of an object no longer
+ *   compares equal to an old value.
+ *
+ * @details
+ *   The value of the object is atomically loaded with the given memory order.
+ *
+ * @returns
+ *   The value 1 if the values differ, otherwise the value 0.
+ */
+typedef int (* patomic_internal_wait_differs_t) (
+    const volatile void *obj,
+    const void *old,
+    int order
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Blocks the calling thread until the value of an object no longer compares
+ *   equal to an old value, or until a timeout elapses.
+ *
+ * @details
+ *   Objects which are 4 bytes wide are waited on directly with a futex. Objects
+ *   of any other width wait on a futex in one of a fixed number of parking
+ *   buckets, chosen by hashing the object's address.
+ *
+ * @param timeout_us
+ *   Pointer to the maximum time to wait for in microseconds, or NULL to wait
+ *   without a timeout.
+ *
+ * @returns
+ *   The value 1 if the values differ, otherwise the value 0 if the timeout
+ *   elapsed first.
+ */
+int
+patomic_internal_wait(
+    const volatile void *obj,
+    const void *old,
+    size_t byte_width,
+    int order,
+    patomic_internal_wait_differs_t differs,
+    const unsigned long *timeout_us
+);
+
+
+/**
+ * @addtogroup internal
+ *
+ * @brief
+ *   Unblocks threads blocked in patomic_internal_wait on an object.
+ *
+ * @details
+ *   If 'notify_all' is zero, at least one waiting thread is unblocked, if any
+ *   are waiting. Objects which share a parking bucket always unblock all
+ *   threads waiting on that bucket.
+ */
+void
+patomic_internal_notify(
+    const volatile void *obj,
+    size_t byte_width,
+    int notify_all
+);
+
+
+#endif  /* PATOMIC_INTERNAL_WAIT_H */
@@ -0,0 +1,33 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_PREFETCH
+
+#include <patomic/config.h>
+
+#include <patomic/stdlib/stdint.h>
+
+/* used internally */
+#undef PATOMIC_PREFETCH_
+
+#if PATOMIC_HAS_BUILTIN_PREFETCH
+    #define PATOMIC_PREFETCH_(ptr) \
+        __builtin_prefetch((const void *) (patomic_intptr_unsigned_t) (ptr))
+#else
+    #define PATOMIC_PREFETCH_(ptr) ((void) 0)
+#endif
+
+/**
+ * @addtogroup macros
+ *
+ * @brief
+ *   The expression hints to the processor that the memory pointed to by 'ptr'
+ *   will soon be accessed. Has no observable effects, and does not require
+ *   'ptr' to point to a valid object.
+ *
+ * @note
+ *   If no implementation is available, this is a void cast zero ((void) 0).
+ */
+#define PATOMIC_PREFETCH(ptr) PATOMIC_PREFETCH_(ptr)
+
+#endif  /* PATOMIC_PREFETCH */
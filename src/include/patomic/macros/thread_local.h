@@ -0,0 +1,52 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_THREAD_LOCAL
+
+#include <patomic/config.h>
+
+/* used internally */
+#undef PATOMIC_THREAD_LOCAL_
+#undef PATOMIC_THREAD_LOCAL_IS_EMPTY_
+
+/* availability flag */
+#undef PATOMIC_THREAD_LOCAL_IS_EMPTY
+
+#if PATOMIC_HAS_THREAD_LOCAL
+    #define PATOMIC_THREAD_LOCAL_ _Thread_local
+    #define PATOMIC_THREAD_LOCAL_IS_EMPTY_ 0
+#elif PATOMIC_HAS_GNU_THREAD_LOCAL
+    #define PATOMIC_THREAD_LOCAL_ __thread
+    #define PATOMIC_THREAD_LOCAL_IS_EMPTY_ 0
+#elif PATOMIC_HAS_THREAD_LOCAL_DSPC
+    #define PATOMIC_THREAD_LOCAL_ __declspec(thread)
+    #define PATOMIC_THREAD_LOCAL_IS_EMPTY_ 0
+#else
+    #define PATOMIC_THREAD_LOCAL_
+    #define PATOMIC_THREAD_LOCAL_IS_EMPTY_ 1
+#endif
+
+/**
+ * @addtogroup macros
+ *
+ * @brief
+ *   Storage class specifier to declare that an object with static storage
+ *   duration has one instance per thread. This must come after the static
+ *   qualifier.
+ *
+ * @warning
+ *   If no implementation is available this expands to nothing, and the object
+ *   is shared between all threads. Callers must remain correct in that case.
+ */
+#define PATOMIC_THREAD_LOCAL PATOMIC_THREAD_LOCAL_
+
+/**
+ * @addtogroup macros
+ *
+ * @brief
+ *   Boolean flag is set if PATOMIC_THREAD_LOCAL has no available
+ *   implementation and expands to nothing.
+ */
+#define PATOMIC_THREAD_LOCAL_IS_EMPTY PATOMIC_THREAD_LOCAL_IS_EMPTY_
+
+#endif  /* PATOMIC_THREAD_LOCAL */
@@ -110,17 +110,13 @@
  * @note
  *   Necessary because on some platforms memcpy uses instructions which will
  *   cause a transaction to abort.
+ *
+ * @note
+ *   The bulk of the buffers is accessed with aligned words or vectors where
+ *   possible, see patomic_internal_transaction_memcpy.
  */
-#define PATOMIC_WRAPPED_DO_TSX_MEMCPY(dest, src, count)                                      \
-    do {                                                                                     \
-        volatile unsigned char *const uc_dest = (volatile unsigned char *) (dest);           \
-        const volatile unsigned char *const uc_src = (const volatile unsigned char *) (src); \
-        for (size_t i = 0; i < ((size_t) (count)); ++i)                                      \
-        {                                                                                    \
-            uc_dest[i] = uc_src[i];                                                          \
-        }                                                                                    \
-    }                                                                                        \
-    while (0)
+#define PATOMIC_WRAPPED_DO_TSX_MEMCPY(dest, src, count) \
+    patomic_internal_transaction_memcpy((dest), (src), (size_t) (count))
 
 
 /**
@@ -133,32 +129,15 @@
  * @note
  *   Necessary because on some platforms memcmp uses instructions which will
  *   cause a transaction to abort.
+ *
+ * @note
+ *   The bulk of the buffers is accessed with aligned words or vectors where
+ *   possible, see patomic_internal_transaction_memcmp.
  */
 #define PATOMIC_WRAPPED_DO_TSX_MEMCMP(res, lhs, rhs, count) \
-    do {                                                    \
-        const volatile unsigned char *const uc_lhs =        \
-            (const volatile unsigned char *) (lhs);         \
-        const volatile unsigned char *const uc_rhs =        \
-            (const volatile unsigned char *) (rhs);         \
-        size_t i;                                           \
-        (res) = 0;                                          \
-        for (i = 0; i < ((size_t) (count)); ++i)            \
-        {                                                   \
-            const unsigned char a = uc_lhs[i];              \
-            const unsigned char b = uc_rhs[i];              \
-            if (a < b)                                      \
-            {                                               \
-                (res) = -1;                                 \
-                break;                                      \
-            }                                               \
-            else if (a > b)                                 \
-            {                                               \
-                (res) = 1;                                  \
-                break;                                      \
-            }                                               \
-        }                                                   \
-    }                                                       \
-    while (0)
+    (res) = patomic_internal_transaction_memcmp(            \
+        (lhs), (rhs), (size_t) (count)                      \
+    )
 
 
 /**
@@ -254,4 +233,80 @@
     do {} while (0)
 
 
+/**
+ * @addtogroup wrapped.base
+ *
+ * @brief
+ *   Limits config.attempts to the adaptive budget of config.policy_nullable,
+ *   if the policy is not NULL.
+ */
+#define PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config)  \
+    (config).attempts = patomic_transaction_policy_attempts( \
+        (config).policy_nullable, (config).attempts          \
+    )
+
+
+/**
+ * @addtogroup wrapped.base
+ *
+ * @brief
+ *   Breaks out of the enclosing attempt loop if no attempts remain, or if
+ *   config.policy_nullable decides that the aborted attempt whose status is
+ *   in result should not be retried.
+ *
+ * @note
+ *   The policy is only consulted if attempts remain, so that it does not back
+ *   off before the loop exits anyway.
+ */
+#define PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, result) \
+    if ((config).attempts == 0ul ||                             \
+        !patomic_transaction_policy_retry(                      \
+            (config).policy_nullable,                           \
+            (result).status, (result).attempts_made             \
+        ))                                                      \
+    {                                                           \
+        break;                                                  \
+    }                                                           \
+    /* require semicolon */                                     \
+    do {} while (0)
+
+
+/**
+ * @addtogroup wrapped.base
+ *
+ * @brief
+ *   Records the final status and attempts made of a transaction operation in
+ *   the transaction statistics, and updates the adaptive budget of
+ *   config.policy_nullable with the final status.
+ */
+#define PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, result) \
+    patomic_internal_transaction_stats_record(            \
+        (result).status, (result).attempts_made, 0        \
+    );                                                    \
+    patomic_transaction_policy_record(                    \
+        (config).policy_nullable, (result).status         \
+    )
+
+
+/**
+ * @addtogroup wrapped.base
+ *
+ * @brief
+ *   Records the final status and attempts made of both paths of a transaction
+ *   operation with a fallback path in the transaction statistics. The
+ *   fallback path is only recorded if the primary path did not succeed. Only
+ *   the primary path updates the adaptive budget of config.policy_nullable.
+ */
+#define PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, result)            \
+    PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, result);                   \
+    if ((result).status != 0ul)                                          \
+    {                                                                    \
+        patomic_internal_transaction_stats_record(                       \
+            (result).fallback_status, (result).fallback_attempts_made, 1 \
+        );                                                               \
+    }                                                                    \
+    /* require semicolon */                                              \
+    do {} while (0)
+
+
 #endif  /* PATOMIC_WRAPPED_BASE_H */
@@ -0,0 +1,533 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_WRAPPED_BATCH_H
+#define PATOMIC_WRAPPED_BATCH_H
+
+#include "base.h"
+
+#include <patomic/internal/bulk.h>
+
+#include <patomic/macros/prefetch.h>
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   How many elements ahead of the current element a batch operation hints
+ *   to the processor that an object will soon be accessed.
+ */
+#define PATOMIC_WRAPPED_BATCH_PREFETCH_DISTANCE ((size_t) 8)
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Hints to the processor that the object which will be operated on
+ *   PATOMIC_WRAPPED_BATCH_PREFETCH_DISTANCE elements after index 'i' will
+ *   soon be accessed, if there is such an object.
+ */
+#define PATOMIC_WRAPPED_BATCH_DO_PREFETCH(objs, i, count)             \
+    do {                                                              \
+        if ((count) - (i) > PATOMIC_WRAPPED_BATCH_PREFETCH_DISTANCE)  \
+        {                                                             \
+            PATOMIC_PREFETCH(                                         \
+                (objs)[(i) + PATOMIC_WRAPPED_BATCH_PREFETCH_DISTANCE] \
+            );                                                        \
+        }                                                             \
+    }                                                                 \
+    while (0)
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Defines a function which implements a batch of atomic void operations
+ *   using void as the underlying atomic operation.
+ *
+ * @details
+ *   The defined function's signature will match either patomic_opsig_void_n_t
+ *   or patomic_opsig_explicit_void_n_t (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_void_explicit
+ *   A macro, M, callable as 'M(type, obj, arg, order);' in block scope, with
+ *   the same requirements as the macro of the same name passed to
+ *   PATOMIC_WRAPPED_DIRECT_DEFINE_OP_VOID.
+ */
+#define PATOMIC_WRAPPED_BATCH_DEFINE_OP_VOID_N(                         \
+    atomic_type, type, fn_name, vis_p, order,                           \
+    do_atomic_void_explicit                                             \
+)                                                                       \
+    static void                                                         \
+    fn_name(                                                            \
+        volatile void *const *const objs                                \
+        ,const void *const arguments                                    \
+ vis_p(_,const int order)                                               \
+        ,const size_t count                                             \
+    )                                                                   \
+    {                                                                   \
+        /* static assertions */                                         \
+        PATOMIC_STATIC_ASSERT(                                          \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type)); \
+                                                                        \
+        /* declarations */                                              \
+        const unsigned char *const args =                               \
+            (const unsigned char *) arguments;                          \
+        type arg;                                                       \
+        size_t i;                                                       \
+                                                                        \
+        /* assertions */                                                \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || objs != NULL);          \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || arguments != NULL);     \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_ORDER((int) order)); \
+                                                                        \
+        /* operation */                                                 \
+        for (i = 0; i < count; ++i)                                     \
+        {                                                               \
+            PATOMIC_WRAPPED_BATCH_DO_PREFETCH(objs, i, count);          \
+            PATOMIC_WRAPPED_DO_ASSERT(objs[i] != NULL);                 \
+            PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(objs[i], atomic_type);    \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                  \
+                &arg, args + (i * sizeof(type)), sizeof(type));         \
+            do_atomic_void_explicit(                                    \
+                type,                                                   \
+                (volatile atomic_type *) objs[i],                       \
+                arg,                                                    \
+                (int) order                                             \
+            );                                                          \
+        }                                                               \
+    }
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Defines a function which implements a batch of atomic fetch operations
+ *   using fetch as the underlying atomic operation.
+ *
+ * @details
+ *   The defined function's signature will match either patomic_opsig_fetch_n_t
+ *   or patomic_opsig_explicit_fetch_n_t (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_fetch_explicit
+ *   A macro, M, callable as 'M(type, obj, arg, order, res);' in block scope,
+ *   with the same requirements as the macro of the same name passed to
+ *   PATOMIC_WRAPPED_DIRECT_DEFINE_OP_FETCH. A macro passed as
+ *   'do_atomic_exchange_explicit' to PATOMIC_WRAPPED_DIRECT_DEFINE_OP_EXCHANGE
+ *   also meets these requirements.
+ */
+#define PATOMIC_WRAPPED_BATCH_DEFINE_OP_FETCH_N(                        \
+    atomic_type, type, fn_name, vis_p, order,                           \
+    do_atomic_fetch_explicit                                            \
+)                                                                       \
+    static void                                                         \
+    fn_name(                                                            \
+        volatile void *const *const objs                                \
+        ,const void *const arguments                                    \
+ vis_p(_,const int order)                                               \
+        ,void *const results                                            \
+        ,const size_t count                                             \
+    )                                                                   \
+    {                                                                   \
+        /* static assertions */                                         \
+        PATOMIC_STATIC_ASSERT(                                          \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type)); \
+                                                                        \
+        /* declarations */                                              \
+        const unsigned char *const args =                               \
+            (const unsigned char *) arguments;                          \
+        unsigned char *const rets = (unsigned char *) results;          \
+        type arg;                                                       \
+        type res;                                                       \
+        size_t i;                                                       \
+                                                                        \
+        /* assertions */                                                \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || objs != NULL);          \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || arguments != NULL);     \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || results != NULL);       \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_ORDER((int) order)); \
+                                                                        \
+        /* operation */                                                 \
+        for (i = 0; i < count; ++i)                                     \
+        {                                                               \
+            PATOMIC_WRAPPED_BATCH_DO_PREFETCH(objs, i, count);          \
+            PATOMIC_WRAPPED_DO_ASSERT(objs[i] != NULL);                 \
+            PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(objs[i], atomic_type);    \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                  \
+                &arg, args + (i * sizeof(type)), sizeof(type));         \
+            do_atomic_fetch_explicit(                                   \
+                type,                                                   \
+                (volatile atomic_type *) objs[i],                       \
+                arg,                                                    \
+                (int) order,                                            \
+                res                                                     \
+            );                                                          \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                  \
+                rets + (i * sizeof(type)), &res, sizeof(type));         \
+        }                                                               \
+    }
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Defines a function which implements a batch of atomic cmpxchg operations
+ *   using cmpxchg as the underlying atomic operation.
+ *
+ * @details
+ *   The defined function's signature will match either
+ *   patomic_opsig_cmpxchg_n_t or patomic_opsig_explicit_cmpxchg_n_t
+ *   (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param inv
+ *   Either the macro 'HIDE' if 'vis_p' is 'SHOW_P', or the macro 'SHOW' if
+ *   'vis_p' is 'HIDE_P'.
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_cmpxchg_explicit
+ *   A macro, M, callable as 'M(type, obj, exp, des, succ, fail, ok);' in block
+ *   scope, with the same requirements as the macro of the same name passed to
+ *   PATOMIC_WRAPPED_DIRECT_DEFINE_OP_CMPXCHG. The operation must not fail
+ *   spuriously.
+ */
+#define PATOMIC_WRAPPED_BATCH_DEFINE_OP_CMPXCHG_N(                          \
+    atomic_type, type, fn_name, vis_p, inv, order,                          \
+    do_atomic_cmpxchg_explicit                                              \
+)                                                                           \
+    static size_t                                                           \
+    fn_name(                                                                \
+        volatile void *const *const objs                                    \
+        ,void *const expecteds                                              \
+        ,const void *const desireds                                         \
+ vis_p(_,const int succ)                                                    \
+ vis_p(_,const int fail)                                                    \
+        ,const size_t count                                                 \
+    )                                                                       \
+    {                                                                       \
+        /* static assertions */                                             \
+        PATOMIC_STATIC_ASSERT(                                              \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type));     \
+                                                                            \
+        /* declarations */                                                  \
+        unsigned char *const exps = (unsigned char *) expecteds;            \
+        const unsigned char *const dess = (const unsigned char *) desireds; \
+        type exp;                                                           \
+        type des;                                                           \
+        int ok;                                                             \
+        size_t i;                                                           \
+        size_t successes = 0;                                               \
+    inv(const int succ = (int) order;)                                      \
+    inv(const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);)                 \
+                                                                            \
+        /* assertions */                                                    \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || objs != NULL);              \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || expecteds != NULL);         \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || desireds != NULL);          \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_ORDER(succ));            \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_FAIL_ORDER(succ, fail)); \
+                                                                            \
+        /* operation */                                                     \
+        for (i = 0; i < count; ++i)                                         \
+        {                                                                   \
+            PATOMIC_WRAPPED_BATCH_DO_PREFETCH(objs, i, count);              \
+            PATOMIC_WRAPPED_DO_ASSERT(objs[i] != NULL);                     \
+            PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(objs[i], atomic_type);        \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                      \
+                &des, dess + (i * sizeof(type)), sizeof(type));             \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                      \
+                &exp, exps + (i * sizeof(type)), sizeof(type));             \
+            do_atomic_cmpxchg_explicit(                                     \
+                type,                                                       \
+                (volatile atomic_type *) objs[i],                           \
+                exp, des,                                                   \
+                succ, fail,                                                 \
+                ok                                                          \
+            );                                                              \
+            if (ok)                                                         \
+            {                                                               \
+                ++successes;                                                \
+            }                                                               \
+            else                                                            \
+            {                                                               \
+                PATOMIC_WRAPPED_DO_MEMCPY(                                  \
+                    exps + (i * sizeof(type)), &exp, sizeof(type));         \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        /* outputs */                                                       \
+        return successes;                                                   \
+    }
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Defines a function which implements a bulk atomic store operation over a
+ *   contiguous array of objects, using store as the underlying atomic
+ *   operation.
+ *
+ * @details
+ *   The defined function's signature will match either
+ *   patomic_opsig_store_array_t or patomic_opsig_explicit_store_array_t
+ *   (depending on the value of 'vis_p').
+ *
+ *   If the memory order is relaxed, elements which fill whole naturally
+ *   aligned vectors are stored with vector stores which the architecture
+ *   guarantees are atomic (see PATOMIC_INTERNAL_BULK_VECTOR_SIZE).
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_store_explicit
+ *   A macro, M, callable as 'M(type, obj, des, order);' in block scope, with
+ *   the same requirements as the macro of the same name passed to
+ *   PATOMIC_WRAPPED_DIRECT_DEFINE_OP_STORE.
+ */
+#define PATOMIC_WRAPPED_BATCH_DEFINE_OP_STORE_ARRAY(                          \
+    atomic_type, type, fn_name, vis_p, order,                                 \
+    do_atomic_store_explicit                                                  \
+)                                                                             \
+    static void                                                               \
+    fn_name(                                                                  \
+        volatile void *const objs                                             \
+        ,const void *const desireds                                           \
+ vis_p(_,const int order)                                                     \
+        ,const size_t count                                                   \
+    )                                                                         \
+    {                                                                         \
+        /* static assertions */                                               \
+        PATOMIC_STATIC_ASSERT(                                                \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type));       \
+                                                                              \
+        /* declarations */                                                    \
+        volatile atomic_type *const dst = (volatile atomic_type *) objs;      \
+        const unsigned char *const dess = (const unsigned char *) desireds;   \
+        type des;                                                             \
+        size_t begin = count;                                                 \
+        size_t end = count;                                                   \
+        size_t i;                                                             \
+                                                                              \
+        /* assertions */                                                      \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || objs != NULL);                \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || desireds != NULL);            \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(objs, atomic_type);                 \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_STORE_ORDER((int) order)); \
+                                                                              \
+        /* vector accesses are only used when no ordering is required */      \
+        if ((int) order == patomic_RELAXED)                                   \
+        {                                                                     \
+            patomic_internal_bulk_vector_range(                               \
+                objs, sizeof(type), count, &begin, &end);                     \
+        }                                                                     \
+                                                                              \
+        /* operation */                                                       \
+        for (i = 0; i < begin; ++i)                                           \
+        {                                                                     \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                        \
+                &des, dess + (i * sizeof(type)), sizeof(type));               \
+            do_atomic_store_explicit(type, &dst[i], des, (int) order);        \
+        }                                                                     \
+        if (begin != end)                                                     \
+        {                                                                     \
+            patomic_internal_bulk_store_vectors(                              \
+                &dst[begin],                                                  \
+                dess + (begin * sizeof(type)),                                \
+                (end - begin) * sizeof(type)                                  \
+            );                                                                \
+        }                                                                     \
+        for (i = end; i < count; ++i)                                         \
+        {                                                                     \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                        \
+                &des, dess + (i * sizeof(type)), sizeof(type));               \
+            do_atomic_store_explicit(type, &dst[i], des, (int) order);        \
+        }                                                                     \
+    }
+
+
+/**
+ * @addtogroup wrapped.batch
+ *
+ * @brief
+ *   Defines a function which implements a bulk atomic load operation over a
+ *   contiguous array of objects, using load as the underlying atomic
+ *   operation.
+ *
+ * @details
+ *   The defined function's signature will match either
+ *   patomic_opsig_load_array_t or patomic_opsig_explicit_load_array_t
+ *   (depending on the value of 'vis_p').
+ *
+ *   If the memory order is relaxed, elements which fill whole naturally
+ *   aligned vectors are loaded with vector loads which the architecture
+ *   guarantees are atomic (see PATOMIC_INTERNAL_BULK_VECTOR_SIZE).
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_load_explicit
+ *   A macro, M, callable as 'M(type, obj, order, res);' in block scope, with
+ *   the same requirements as the macro of the same name passed to
+ *   PATOMIC_WRAPPED_DIRECT_DEFINE_OP_LOAD.
+ */
+#define PATOMIC_WRAPPED_BATCH_DEFINE_OP_LOAD_ARRAY(                          \
+    atomic_type, type, fn_name, vis_p, order,                                \
+    do_atomic_load_explicit                                                  \
+)                                                                            \
+    static void                                                              \
+    fn_name(                                                                 \
+        const volatile void *const objs                                      \
+ vis_p(_,const int order)                                                    \
+        ,void *const results                                                 \
+        ,const size_t count                                                  \
+    )                                                                        \
+    {                                                                        \
+        /* static assertions */                                              \
+        PATOMIC_STATIC_ASSERT(                                               \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type));      \
+                                                                             \
+        /* declarations */                                                   \
+        const volatile atomic_type *const src =                              \
+            (const volatile atomic_type *) objs;                             \
+        unsigned char *const rets = (unsigned char *) results;               \
+        type res;                                                            \
+        size_t begin = count;                                                \
+        size_t end = count;                                                  \
+        size_t i;                                                            \
+                                                                             \
+        /* assertions */                                                     \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || objs != NULL);               \
+        PATOMIC_WRAPPED_DO_ASSERT(count == 0 || results != NULL);            \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(objs, atomic_type);                \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_LOAD_ORDER((int) order)); \
+                                                                             \
+        /* vector accesses are only used when no ordering is required */     \
+        if ((int) order == patomic_RELAXED)                                  \
+        {                                                                    \
+            patomic_internal_bulk_vector_range(                              \
+                objs, sizeof(type), count, &begin, &end);                    \
+        }                                                                    \
+                                                                             \
+        /* operation */                                                      \
+        for (i = 0; i < begin; ++i)                                          \
+        {                                                                    \
+            do_atomic_load_explicit(type, &src[i], (int) order, res);        \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                       \
+                rets + (i * sizeof(type)), &res, sizeof(type));              \
+        }                                                                    \
+        if (begin != end)                                                    \
+        {                                                                    \
+            patomic_internal_bulk_load_vectors(                              \
+                &src[begin],                                                 \
+                rets + (begin * sizeof(type)),                               \
+                (end - begin) * sizeof(type)                                 \
+            );                                                               \
+        }                                                                    \
+        for (i = end; i < count; ++i)                                        \
+        {                                                                    \
+            do_atomic_load_explicit(type, &src[i], (int) order, res);        \
+            PATOMIC_WRAPPED_DO_MEMCPY(                                       \
+                rets + (i * sizeof(type)), &res, sizeof(type));              \
+        }                                                                    \
+    }
+
+
+#endif  /* PATOMIC_WRAPPED_BATCH_H */
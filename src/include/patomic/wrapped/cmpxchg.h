@@ -6,6 +6,60 @@
 
 #include "base.h"
 
+#include <patomic/config.h>
+
+#if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    #include <patomic/internal/profile.h>
+#endif
+
+
+/**
+ * @addtogroup wrapped.cmpxchg
+ *
+ * @brief
+ *   Declares an identifier used to count the iterations of a cmpxchg loop, if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set. Otherwise expands to nothing.
+ */
+#if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    #define PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(count) \
+        unsigned long count = 0;
+#else
+    #define PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(count)
+#endif
+
+
+/**
+ * @addtogroup wrapped.cmpxchg
+ *
+ * @brief
+ *   Increments the iteration count of a cmpxchg loop, if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set. Otherwise does nothing.
+ */
+#if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    #define PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(count) \
+        ++count
+#else
+    #define PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(count) \
+        PATOMIC_IGNORE_UNUSED(0)
+#endif
+
+
+/**
+ * @addtogroup wrapped.cmpxchg
+ *
+ * @brief
+ *   Records the iteration count of a completed cmpxchg loop against the given
+ *   patomic_profile_slot_t value, if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
+ *   Otherwise does nothing, and the slot is never evaluated.
+ */
+#if PATOMIC_ENABLE_CMPXCHG_HISTOGRAM
+    #define PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(slot, type, count) \
+        patomic_internal_profile_record_cmpxchg(slot, sizeof(type), count)
+#else
+    #define PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(slot, type, count) \
+        PATOMIC_IGNORE_UNUSED(0)
+#endif
+
 
 /**
  * @addtogroup wrapped.cmpxchg
@@ -83,6 +137,7 @@
         type exp = {0};                                                       \
         type des;                                                             \
         int ok;                                                               \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)                \
         const int succ = (int) order;                                         \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);                    \
                                                                               \
@@ -97,6 +152,7 @@
                                                                               \
         /* operation */                                                       \
         do {                                                                  \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);         \
             do_atomic_cmpxchg_weak_explicit(                                  \
                 type,                                                         \
                 (volatile atomic_type *) obj,                                 \
@@ -106,6 +162,9 @@
             );                                                                \
         }                                                                     \
         while (!ok);                                                          \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                            \
+            patomic_profile_slot_STORE, type, iterations                      \
+        );                                                                    \
     }
 
 
@@ -186,6 +245,7 @@
         type exp = {0};                                                 \
         type des;                                                       \
         int ok;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)          \
         const int succ = (int) order;                                   \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);              \
                                                                         \
@@ -201,6 +261,7 @@
                                                                         \
         /* operation */                                                 \
         do {                                                            \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);   \
             do_atomic_cmpxchg_weak_explicit(                            \
                 type,                                                   \
                 (volatile atomic_type *) obj,                           \
@@ -210,6 +271,9 @@
             );                                                          \
         }                                                               \
         while (!ok);                                                    \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                      \
+            patomic_profile_slot_EXCHANGE, type, iterations             \
+        );                                                              \
                                                                         \
         /* outputs */                                                   \
         PATOMIC_WRAPPED_DO_MEMCPY(ret, &exp, sizeof(type));             \
@@ -314,6 +378,7 @@
         type old;                                                           \
         int eq;                                                             \
         int ok;                                                             \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)              \
     inv(const int succ = (int) order;)                                      \
     inv(const int fail = PATOMIC_CMPXCHG_FAIL_ORDER((int) order);)          \
                                                                             \
@@ -331,6 +396,7 @@
                                                                             \
         /* operation */                                                     \
         do {                                                                \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);       \
             /* save expected value for comparison */                        \
             PATOMIC_WRAPPED_DO_MEMCPY(&old, &exp, sizeof(type));            \
                                                                             \
@@ -357,6 +423,9 @@
             }                                                               \
         }                                                                   \
         while (!ok);                                                        \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                          \
+            patomic_profile_slot_CMPXCHG_STRONG, type, iterations           \
+        );                                                                  \
                                                                             \
         /* outputs */                                                       \
         PATOMIC_WRAPPED_DO_MEMCPY(expected, &exp, sizeof(type));            \
@@ -364,6 +433,161 @@
     }
 
 
+/**
+ * @addtogroup wrapped.cmpxchg
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_update operation,
+ *   calling a user provided callback to make the desired value, using
+ *   cmpxchg_weak as the underlying atomic operation.
+ *
+ * @details
+ *   The defined function's signature will match either
+ *   patomic_opsig_fetch_update_t or patomic_opsig_explicit_fetch_update_t
+ *   (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param inv
+ *   Either the macro 'HIDE' if 'vis_p' is 'SHOW_P', or the macro 'SHOW' if
+ *   'vis_p' is 'HIDE_P'.
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param do_atomic_load_explicit
+ *   A macro, M, callable as 'M(type, obj, order, res);' in block scope.
+ *
+ *   The arguments provided are:
+ *   - 'type'  : forwarded directly from the 'type' argument in this macro
+ *   - 'obj'   : an expression of type 'const volatile atomic_type *'
+ *   - 'order' : an expression of type 'int' whose value is a valid load memory
+ *               order
+ *   - 'res'   : the name of an identifier designating an object of type 'type'
+ *
+ *   The expected behaviour of calling the macro M as above is:
+ *   - the value of the object pointed to by 'obj' is atomically read
+ *   - 'res' is set to the value which was read
+ *   - the atomic operation uses a load memory ordering at least as strong as
+ *     'order'
+ *
+ * @param do_atomic_cmpxchg_weak_explicit
+ *   A macro, M, callable as 'M(type, obj, exp, des, succ, fail, ok);' in block
+ *   scope.
+ *
+ *   The arguments provided are:
+ *   - 'type' : forwarded directly from the 'type' argument in this macro
+ *   - 'obj'  : an expression of type 'volatile atomic_type *'
+ *   - 'exp'  : the name of an identifier designating an object of type 'type'
+ *   - 'des'  : the name of an identifier designating an object of type 'type'
+ *   - 'succ' : an expression of type 'int' whose value is a valid memory order
+ *   - 'fail' : an expression of type 'int' whose value is a valid load memory
+ *              order not stronger than 'succ'
+ *   - 'ok'   : the name of an identifier designating an object of type 'int'
+ *
+ *   The expected behaviour of calling the macro M as above is:
+ *   - the values of 'exp' and 'des' are read
+ *   - in a single atomic operation, the value of the object pointed to by
+ *     'obj' is read and, if it compares equal to the value of 'exp', the
+ *     value of 'des' is written to the object pointed to by 'obj'
+ *   - the value read from 'obj' is stored in 'exp'
+ *   - 'ok' is set to non-zero if the value of 'des' was written to the object
+ *     pointed to by 'obj' (success), otherwise it is set to zero (failure)
+ *   - the atomic operation uses a memory ordering at least as strong as 'succ'
+ *     for a successful exchange, and a load memory ordering at least as strong
+ *     as 'fail' for a failed exchange
+ *
+ * @note
+ *   Unlike the other operations in this file, the initial expected value is
+ *   loaded from the object rather than guessed, since the callback may decline
+ *   to modify the object based on the value it is given.
+ */
+#define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_UPDATE(                     \
+    atomic_type, type, fn_name, vis_p, inv, order,                          \
+    do_atomic_load_explicit, do_atomic_cmpxchg_weak_explicit                \
+)                                                                           \
+    static int                                                              \
+    fn_name(                                                                \
+        volatile void *const obj                                            \
+        ,const patomic_update_fn_t update                                   \
+        ,void *const ctx                                                    \
+ vis_p(_,const int succ)                                                    \
+ vis_p(_,const int fail)                                                    \
+        ,void *const ret                                                    \
+    )                                                                       \
+    {                                                                       \
+        /* static assertions */                                             \
+        PATOMIC_STATIC_ASSERT(                                              \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type));     \
+                                                                            \
+        /* declarations */                                                  \
+        type exp;                                                           \
+        type des;                                                           \
+        int ok = 0;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)              \
+    inv(const int succ = (int) order;)                                      \
+    inv(const int fail = PATOMIC_CMPXCHG_FAIL_ORDER((int) order);)          \
+                                                                            \
+        /* assertions */                                                    \
+        PATOMIC_WRAPPED_DO_ASSERT(obj != NULL);                             \
+        PATOMIC_WRAPPED_DO_ASSERT(update != NULL);                          \
+        PATOMIC_WRAPPED_DO_ASSERT(ret != NULL);                             \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(obj, atomic_type);                \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_ORDER(succ));            \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_FAIL_ORDER(succ, fail)); \
+                                                                            \
+        /* inputs */                                                        \
+        do_atomic_load_explicit(                                            \
+            type,                                                           \
+            (const volatile atomic_type *) obj,                             \
+            fail,                                                           \
+            exp                                                             \
+        );                                                                  \
+                                                                            \
+        /* operation */                                                     \
+        do {                                                                \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);       \
+            /* make the desired value from the expected value */            \
+            if (update(&exp, &des, ctx) == 0)                               \
+            {                                                               \
+                break;                                                      \
+            }                                                               \
+                                                                            \
+            /* cmpxchg_weak */                                              \
+            do_atomic_cmpxchg_weak_explicit(                                \
+                type,                                                       \
+                (volatile atomic_type *) obj,                               \
+                exp, des,                                                   \
+                succ, fail,                                                 \
+                ok                                                          \
+            );                                                              \
+        }                                                                   \
+        while (!ok);                                                        \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                          \
+            patomic_profile_slot_FETCH_UPDATE, type, iterations             \
+        );                                                                  \
+                                                                            \
+        /* outputs */                                                       \
+        PATOMIC_WRAPPED_DO_MEMCPY(ret, &exp, sizeof(type));                 \
+        return ok != 0;                                                     \
+    }
+
+
 /**
  * @addtogroup wrapped.cmpxchg
  *
@@ -450,11 +674,16 @@
  *   - 'des' should be set to the value of 'exp' after the desired modify
  *     operation is applied
  *   - 'exp' should not be modified
+ *
+ * @param slot
+ *   The patomic_profile_slot_t value against which the iteration count of the
+ *   cmpxchg loop is recorded. Only evaluated if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
  */
 #define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_BIT_TEST_MODIFY(                      \
     atomic_type, type, fn_name, vis_p, order,                                   \
     do_atomic_cmpxchg_weak_explicit,                                            \
-    do_get_bit, do_make_desired                                                 \
+    do_get_bit, do_make_desired, slot                                           \
 )                                                                               \
     static int                                                                  \
     fn_name(                                                                    \
@@ -472,6 +701,7 @@
         type des;                                                               \
         int exp_bit;                                                            \
         int ok;                                                                 \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)                  \
         const int succ = (int) order;                                           \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);                      \
                                                                                 \
@@ -484,6 +714,7 @@
                                                                                 \
         /* operation */                                                         \
         do {                                                                    \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);           \
             /* get the expected bit */                                          \
             do_get_bit(                                                         \
                 type,                                                           \
@@ -508,6 +739,10 @@
             );                                                                  \
         }                                                                       \
         while (!ok);                                                            \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                              \
+            slot,                                                               \
+            type, iterations                                                    \
+        );                                                                      \
                                                                                 \
         /* outputs */                                                           \
         return exp_bit;                                                         \
@@ -584,11 +819,16 @@
  *   - 'des' should be set to the value of 'exp' after the desired modify
  *     operation is applied
  *   - 'exp' and 'arg' should not be modified
+ *
+ * @param slot
+ *   The patomic_profile_slot_t value against which the iteration count of the
+ *   cmpxchg loop is recorded. Only evaluated if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
  */
 #define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH(                        \
     atomic_type, type, fn_name, vis_p, order,                           \
     do_atomic_cmpxchg_weak_explicit,                                    \
-    do_make_desired                                                     \
+    do_make_desired, slot                                               \
 )                                                                       \
     static void                                                         \
     fn_name(                                                            \
@@ -607,6 +847,7 @@
         type des;                                                       \
         type arg;                                                       \
         int ok;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)          \
         const int succ = (int) order;                                   \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);              \
                                                                         \
@@ -622,6 +863,7 @@
                                                                         \
         /* operation */                                                 \
         do {                                                            \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);   \
             /* make the desired value from the expected value */        \
             do_make_desired(                                            \
                 type,                                                   \
@@ -639,6 +881,10 @@
             );                                                          \
         }                                                               \
         while (!ok);                                                    \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                      \
+            slot,                                                       \
+            type, iterations                                            \
+        );                                                              \
                                                                         \
         /* outputs */                                                   \
         PATOMIC_WRAPPED_DO_MEMCPY(ret, &exp, sizeof(type));             \
@@ -715,11 +961,16 @@
  *   - 'des' should be set to the value of 'exp' after the desired modify
  *     operation is applied
  *   - 'exp' should not be modified
+ *
+ * @param slot
+ *   The patomic_profile_slot_t value against which the iteration count of the
+ *   cmpxchg loop is recorded. Only evaluated if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
  */
 #define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_FETCH_NOARG(                  \
     atomic_type, type, fn_name, vis_p, order,                           \
     do_atomic_cmpxchg_weak_explicit,                                    \
-    do_make_desired                                                     \
+    do_make_desired, slot                                               \
 )                                                                       \
     static void                                                         \
     fn_name(                                                            \
@@ -736,6 +987,7 @@
         type exp = {0};                                                 \
         type des;                                                       \
         int ok;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)          \
         const int succ = (int) order;                                   \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);              \
                                                                         \
@@ -747,6 +999,7 @@
                                                                         \
         /* operation */                                                 \
         do {                                                            \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);   \
             /* make the desired value from the expected value */        \
             do_make_desired(                                            \
                 type,                                                   \
@@ -764,6 +1017,10 @@
             );                                                          \
         }                                                               \
         while (!ok);                                                    \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                      \
+            slot,                                                       \
+            type, iterations                                            \
+        );                                                              \
                                                                         \
         /* outputs */                                                   \
         PATOMIC_WRAPPED_DO_MEMCPY(ret, &exp, sizeof(type));             \
@@ -840,11 +1097,16 @@
  *   - 'des' should be set to the value of 'exp' after the desired modify
  *     operation is applied
  *   - 'exp' and 'arg' should not be modified
+ *
+ * @param slot
+ *   The patomic_profile_slot_t value against which the iteration count of the
+ *   cmpxchg loop is recorded. Only evaluated if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
  */
 #define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID(                         \
     atomic_type, type, fn_name, vis_p, order,                           \
     do_atomic_cmpxchg_weak_explicit,                                    \
-    do_make_desired                                                     \
+    do_make_desired, slot                                               \
 )                                                                       \
     static void                                                         \
     fn_name(                                                            \
@@ -862,6 +1124,7 @@
         type des;                                                       \
         type arg;                                                       \
         int ok;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)          \
         const int succ = (int) order;                                   \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);              \
                                                                         \
@@ -876,6 +1139,7 @@
                                                                         \
         /* operation */                                                 \
         do {                                                            \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);   \
             /* make the desired value from the expected value */        \
             do_make_desired(                                            \
                 type,                                                   \
@@ -893,6 +1157,10 @@
             );                                                          \
         }                                                               \
         while (!ok);                                                    \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                      \
+            slot,                                                       \
+            type, iterations                                            \
+        );                                                              \
     }
 
 
@@ -966,11 +1234,16 @@
  *   - 'des' should be set to the value of 'exp' after the desired modify
  *     operation is applied
  *   - 'exp' should not be modified
+ *
+ * @param slot
+ *   The patomic_profile_slot_t value against which the iteration count of the
+ *   cmpxchg loop is recorded. Only evaluated if
+ *   PATOMIC_ENABLE_CMPXCHG_HISTOGRAM is set.
  */
 #define PATOMIC_WRAPPED_CMPXCHG_DEFINE_OP_VOID_NOARG(                   \
     atomic_type, type, fn_name, vis_p, order,                           \
     do_atomic_cmpxchg_weak_explicit,                                    \
-    do_make_desired                                                     \
+    do_make_desired, slot                                               \
 )                                                                       \
     static void                                                         \
     fn_name(                                                            \
@@ -986,6 +1259,7 @@
         type exp = {0};                                                 \
         type des;                                                       \
         int ok;                                                         \
+        PATOMIC_WRAPPED_CMPXCHG_DECLARE_ITERATIONS(iterations)          \
         const int succ = (int) order;                                   \
         const int fail = PATOMIC_CMPXCHG_FAIL_ORDER(succ);              \
                                                                         \
@@ -996,6 +1270,7 @@
                                                                         \
         /* operation */                                                 \
         do {                                                            \
+            PATOMIC_WRAPPED_CMPXCHG_INCREMENT_ITERATIONS(iterations);   \
             /* make the desired value from the expected value */        \
             do_make_desired(                                            \
                 type,                                                   \
@@ -1013,6 +1288,10 @@
             );                                                          \
         }                                                               \
         while (!ok);                                                    \
+        PATOMIC_WRAPPED_CMPXCHG_RECORD_ITERATIONS(                      \
+            slot,                                                       \
+            type, iterations                                            \
+        );                                                              \
     }
 
 
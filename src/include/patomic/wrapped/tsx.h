@@ -60,6 +60,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(desired != NULL);                  \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -79,10 +80,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -140,6 +143,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(ret != NULL);                      \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -159,10 +163,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -222,6 +228,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(ret != NULL);                      \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -244,10 +251,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -314,6 +323,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(desired != NULL);                     \
                                                                         \
         /* operation */                                                 \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);              \
         while (config.attempts-- > 0ul)                                 \
         {                                                               \
             ++res.attempts_made;                                        \
@@ -345,6 +355,7 @@
                 ok = 1;                                                 \
                 goto cleanup;                                           \
             }                                                           \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);        \
         }                                                               \
                                                                         \
         /* fallback */                                                  \
@@ -383,6 +394,7 @@
                                                                         \
         /* cleanup */                                                   \
     cleanup:                                                            \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, res);             \
         *result = res;                                                  \
         return ok;                                                      \
     }
@@ -445,6 +457,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(byte_offset < config.width);              \
                                                                             \
         /* operation */                                                     \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);                  \
         while (config.attempts-- > 0ul)                                     \
         {                                                                   \
             ++res.attempts_made;                                            \
@@ -462,10 +475,12 @@
                 );                                                          \
                 goto cleanup;                                               \
             }                                                               \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);            \
         }                                                                   \
                                                                             \
         /* cleanup */                                                       \
     cleanup:                                                                \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);                     \
         *result = res;                                                      \
         return bit;                                                         \
     }
@@ -535,6 +550,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(byte_offset < config.width);              \
                                                                             \
         /* operation */                                                     \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);                  \
         while (config.attempts-- > 0ul)                                     \
         {                                                                   \
             ++res.attempts_made;                                            \
@@ -555,10 +571,12 @@
                 );                                                          \
                 goto cleanup;                                               \
             }                                                               \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);            \
         }                                                                   \
                                                                             \
         /* cleanup */                                                       \
     cleanup:                                                                \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);                     \
         *result = res;                                                      \
         return bit;                                                         \
     }
@@ -728,6 +746,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(ret != NULL);                          \
                                                                          \
         /* operation */                                                  \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);               \
         while (config.attempts-- > 0ul)                                  \
         {                                                                \
             ++res.attempts_made;                                         \
@@ -748,10 +767,12 @@
                 );                                                       \
                 goto cleanup;                                            \
             }                                                            \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);         \
         }                                                                \
                                                                          \
         /* cleanup */                                                    \
     cleanup:                                                             \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);                  \
         *result = res;                                                   \
     }
 
@@ -815,6 +836,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(ret != NULL);                      \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -835,10 +857,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -903,6 +927,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(arg != NULL);                          \
                                                                          \
         /* operation */                                                  \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);               \
         while (config.attempts-- > 0ul)                                  \
         {                                                                \
             ++res.attempts_made;                                         \
@@ -920,10 +945,12 @@
                 );                                                       \
                 goto cleanup;                                            \
             }                                                            \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);         \
         }                                                                \
                                                                          \
         /* cleanup */                                                    \
     cleanup:                                                             \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);                  \
         *result = res;                                                   \
     }
 
@@ -985,6 +1012,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(obj != NULL);                      \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -1002,10 +1030,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -1295,7 +1325,8 @@
         );                                                                   \
         /* setup */                                                          \
         unsigned long carry = 0ul;                                           \
-        const int is_le = IMPL_DEFINED_IS_LE();                              \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
         for (size_t i = 0; i < (width); ++i) {                               \
             const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
             /* sum: obj[i] + arg[i] + carry */                               \
@@ -1316,7 +1347,8 @@
         );                                                                   \
         /* setup */                                                          \
         long borrow = 0l;                                                    \
-        const int is_le = IMPL_DEFINED_IS_LE();                              \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
         for (size_t i = 0; i < (width); ++i) {                               \
             const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
             /* diff: obj[i] - arg[i] - borrow */                             \
@@ -1343,7 +1375,8 @@
         );                                                                   \
         /* setup */                                                          \
         unsigned long carry = 1ul;                                           \
-        const int is_le = IMPL_DEFINED_IS_LE();                              \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
         for (size_t i = 0; i < (width); ++i) {                               \
             const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
             /* sum: obj[i] + carry */                                        \
@@ -1363,7 +1396,8 @@
         );                                                                   \
         /* setup */                                                          \
         long borrow = 1l;                                                    \
-        const int is_le = IMPL_DEFINED_IS_LE();                              \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
         for (size_t i = 0; i < (width); ++i) {                               \
             const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
             /* diff: obj[i] - borrow */                                      \
@@ -1393,7 +1427,8 @@
         );                                                                   \
         /* setup */                                                          \
         unsigned long carry = 1ul;                                           \
-        const int is_le = IMPL_DEFINED_IS_LE();                              \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
         for (size_t i = 0; i < (width); ++i) {                               \
             const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
             /* inv -> sum: ~obj[i] + carry */                                \
@@ -1405,6 +1440,104 @@
             carry = (sum >> 8ul);                                            \
         }                                                                    \
     } while (0)
+#define patomic_wrapped_tsx_do_minmax(obj, arg, width, is_signed, is_min)   \
+    do {                                                                     \
+        /* setup */                                                          \
+        int cmp = 0;                                                         \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
+        /* compare: arg <=> obj, starting from the most significant byte */  \
+        for (size_t i = 0; i < (width) && cmp == 0; ++i) {                   \
+            const size_t idx = (is_le) ? ((size_t) ((width) - 1ul - i)) : i; \
+            unsigned int o = (unsigned int) ((obj)[idx]);                    \
+            unsigned int a = (unsigned int) ((arg)[idx]);                    \
+            /* flipping the sign bit makes unsigned comparison order */      \
+            /* signed values */                                              \
+            if ((is_signed) && i == 0) {                                     \
+                o ^= 0x80u;                                                  \
+                a ^= 0x80u;                                                  \
+            }                                                                \
+            cmp = (a < o) ? -1 : (a > o);                                    \
+        }                                                                    \
+        /* do min/max: replace obj with arg if it is preferred */            \
+        if ((is_min) ? (cmp < 0) : (cmp > 0)) {                              \
+            for (size_t i = 0; i < (width); ++i) {                           \
+                (obj)[i] = (arg)[i];                                         \
+            }                                                                \
+        }                                                                    \
+    } while (0)
+#define patomic_wrapped_tsx_do_min(obj, arg, width) \
+    patomic_wrapped_tsx_do_minmax(obj, arg, width, 1, 1)
+#define patomic_wrapped_tsx_do_max(obj, arg, width) \
+    patomic_wrapped_tsx_do_minmax(obj, arg, width, 1, 0)
+#define patomic_wrapped_tsx_do_umin(obj, arg, width) \
+    patomic_wrapped_tsx_do_minmax(obj, arg, width, 0, 1)
+#define patomic_wrapped_tsx_do_umax(obj, arg, width) \
+    patomic_wrapped_tsx_do_minmax(obj, arg, width, 0, 0)
+#define patomic_wrapped_tsx_do_addsub_sat(obj, arg, width, is_signed, is_sub) \
+    do {                                                                     \
+        /* static assert */                                                  \
+        PATOMIC_STATIC_ASSERT(                                               \
+            ulong_big_enough,                                                \
+            (ULONG_MAX / 2ul) > ((unsigned long) UCHAR_MAX)                  \
+        );                                                                   \
+        /* setup */                                                          \
+        /* subtraction is done as addition of ~arg with a carry of 1 */      \
+        unsigned long carry = (is_sub) ? 1ul : 0ul;                          \
+        const unsigned int one = 1u;                                         \
+        const int is_le = (*((const unsigned char *) &one) == 1u);           \
+        const size_t msb = (is_le) ? ((size_t) ((width) - 1ul)) : 0u;        \
+        const unsigned int obj_neg = ((obj)[msb] & 0x80u) != 0u;             \
+        const unsigned int arg_neg = (((arg)[msb] & 0x80u) != 0u) ^          \
+                                     ((is_sub) ? 1u : 0u);                   \
+        int clamp = 0;                                                       \
+        unsigned char fill = 0u;                                             \
+        unsigned char fill_msb = 0u;                                         \
+        for (size_t i = 0; i < (width); ++i) {                               \
+            const size_t idx = (is_le) ? i : ((size_t) ((width) - 1ul - i)); \
+            /* sum: obj[i] + (~)arg[i] + carry */                            \
+            unsigned long sum = (unsigned long) ((obj)[idx]);                \
+            unsigned char a = (arg)[idx];                                    \
+            if (is_sub) {                                                    \
+                a = (unsigned char) ~a;                                      \
+            }                                                                \
+            sum += (unsigned long) a;                                        \
+            sum += carry;                                                    \
+            /* do add */                                                     \
+            (obj)[idx] = (unsigned char) (sum & 0xFFu);                      \
+            carry = (sum >> 8ul);                                            \
+        }                                                                    \
+        /* check overflow */                                                 \
+        if (is_signed) {                                                     \
+            /* operands have the same sign, and result has a different */    \
+            /* sign, so clamp to the limit with the sign of obj */           \
+            const unsigned int res_neg = ((obj)[msb] & 0x80u) != 0u;         \
+            clamp = (obj_neg == arg_neg) && (res_neg != obj_neg);            \
+            fill = obj_neg ? 0x00u : 0xFFu;                                  \
+            fill_msb = obj_neg ? 0x80u : 0x7Fu;                              \
+        }                                                                    \
+        else {                                                               \
+            /* carry out of addition, or no carry out of subtraction */      \
+            clamp = (is_sub) ? (carry == 0ul) : (carry != 0ul);              \
+            fill = (is_sub) ? 0x00u : 0xFFu;                                 \
+            fill_msb = fill;                                                 \
+        }                                                                    \
+        /* do clamp */                                                       \
+        if (clamp) {                                                         \
+            for (size_t i = 0; i < (width); ++i) {                           \
+                (obj)[i] = fill;                                             \
+            }                                                                \
+            (obj)[msb] = fill_msb;                                           \
+        }                                                                    \
+    } while (0)
+#define patomic_wrapped_tsx_do_add_sat(obj, arg, width) \
+    patomic_wrapped_tsx_do_addsub_sat(obj, arg, width, 1, 0)
+#define patomic_wrapped_tsx_do_sub_sat(obj, arg, width) \
+    patomic_wrapped_tsx_do_addsub_sat(obj, arg, width, 1, 1)
+#define patomic_wrapped_tsx_do_uadd_sat(obj, arg, width) \
+    patomic_wrapped_tsx_do_addsub_sat(obj, arg, width, 0, 0)
+#define patomic_wrapped_tsx_do_usub_sat(obj, arg, width) \
+    patomic_wrapped_tsx_do_addsub_sat(obj, arg, width, 0, 1)
 
 
 /**
@@ -1717,166 +1850,949 @@
     )
 
 
-/**
- * @addtogroup wrapped.tsx
- *
- * @brief
- *   Defines a function which implements an atomic double_cmpxchg operation
- *   using tbegin and tcommit as the underlying atomic transaction primitives.
- *
- * @details
- *   The defined function's signature will match
- *   patomic_opsig_transaction_double_cmpxchg_t.
- *
- * @param fn_name
- *   The name of the function to be defined.
- *
- * @param tbegin
- *   A callable with the signature and semantics of
- *   patomic_opsig_transaction_tbegin_t.
- *
- * @param tcommit
- *   A callable with the signature and semantics of
- *   patomic_opsig_transaction_tcommit_t.
- */
-#define PATOMIC_WRAPPED_TSX_DEFINE_OP_DOUBLE_CMPXCHG(                             \
-    fn_name, tbegin, tcommit                                                      \
-)                                                                                 \
-    static int                                                                    \
-    fn_name(                                                                      \
-        const patomic_transaction_cmpxchg_t cxa,                                  \
-        const patomic_transaction_cmpxchg_t cxb,                                  \
-        patomic_transaction_config_wfb_t config,                                  \
-        patomic_transaction_result_wfb_t *const result                            \
-    )                                                                             \
-    {                                                                             \
-        /* declarations */                                                        \
-        int ok = 0;                                                               \
-        unsigned char flag_value = 0;                                             \
-        patomic_transaction_result_wfb_t res = {0};                               \
-        const patomic_transaction_flag_t flag = 0;                                \
-        if (config.flag_nullable == NULL)                                         \
-        {                                                                         \
-            config.flag_nullable = &flag;                                         \
-        }                                                                         \
-        if (config.fallback_flag_nullable == NULL)                                \
-        {                                                                         \
-            config.fallback_flag_nullable = &flag;                                \
-        }                                                                         \
-                                                                                  \
-        /* assert early */                                                        \
-        PATOMIC_WRAPPED_DO_ASSERT(result != NULL);                                \
-                                                                                  \
-        /* check zero */                                                          \
-        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_WFB(                                \
-            config, res, fallback, cleanup                                        \
-        );                                                                        \
-                                                                                  \
-        /* assertions */                                                          \
-        PATOMIC_WRAPPED_DO_ASSERT(cxa.obj != NULL);                               \
-        PATOMIC_WRAPPED_DO_ASSERT(cxa.expected != NULL);                          \
-        PATOMIC_WRAPPED_DO_ASSERT(cxa.desired != NULL);                           \
-        PATOMIC_WRAPPED_DO_ASSERT(cxb.obj != NULL);                               \
-        PATOMIC_WRAPPED_DO_ASSERT(cxb.expected != NULL);                          \
-        PATOMIC_WRAPPED_DO_ASSERT(cxb.desired != NULL);                           \
-                                                                                  \
-        /* operation */                                                           \
-        while (config.attempts-- > 0ul)                                           \
-        {                                                                         \
-            ++res.attempts_made;                                                  \
-            res.status = tbegin();                                                \
-            if (res.status == 0ul)                                                \
-            {                                                                     \
-                int cmp_a = 0;                                                    \
-                int cmp_b = 0;                                                    \
-                flag_value = *config.flag_nullable;                               \
-                if (flag_value == 0)                                              \
-                {                                                                 \
-                    PATOMIC_WRAPPED_DO_TSX_MEMCMP(                                \
-                        cmp_a, cxa.obj, cxa.expected, config.width                \
-                    );                                                            \
-                    PATOMIC_WRAPPED_DO_TSX_MEMCMP(                                \
-                        cmp_b, cxb.obj, cxb.expected, config.width                \
-                    );                                                            \
-                    if (cmp_a == 0 && cmp_b == 0)                                 \
-                    {                                                             \
-                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                            \
-                            cxa.obj, cxa.desired, config.width                    \
-                        );                                                        \
-                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                            \
-                            cxb.obj, cxb.desired, config.width                    \
-                        );                                                        \
-                    }                                                             \
-                }                                                                 \
-                tcommit();                                                        \
-                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(                       \
-                    res.status, flag_value                                        \
-                );                                                                \
-                if (flag_value != 0 || !(cmp_a == 0 && cmp_b == 0))               \
-                {                                                                 \
-                    goto fallback;                                                \
-                }                                                                 \
-                ok = 1;                                                           \
-                goto cleanup;                                                     \
-            }                                                                     \
-        }                                                                         \
-                                                                                  \
-        /* fallback */                                                            \
-    fallback:                                                                     \
-                                                                                  \
-        /* check zero */                                                          \
-        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_FALLBACK(                           \
-            config, res, cleanup                                                  \
-        );                                                                        \
-                                                                                  \
-        /* assertions */                                                          \
-        PATOMIC_WRAPPED_DO_ASSERT(cxa.obj != NULL);                               \
-        PATOMIC_WRAPPED_DO_ASSERT(cxa.expected != NULL);                          \
-        PATOMIC_WRAPPED_DO_ASSERT(cxb.obj != NULL);                               \
-        PATOMIC_WRAPPED_DO_ASSERT(cxb.expected != NULL);                          \
-                                                                                  \
-        /* operation */                                                           \
-        while (config.fallback_attempts-- > 0ul)                                  \
-        {                                                                         \
-            ++res.fallback_attempts_made;                                         \
-            res.fallback_status = tbegin();                                       \
-            if (res.fallback_status == 0ul)                                       \
-            {                                                                     \
-                flag_value = *config.fallback_flag_nullable;                      \
-                if (flag_value == 0)                                              \
-                {                                                                 \
-                    PATOMIC_WRAPPED_DO_TSX_MEMCPY(                                \
-                        cxa.expected, cxa.obj, config.width                       \
-                    );                                                            \
-                    PATOMIC_WRAPPED_DO_TSX_MEMCPY(                                \
-                        cxb.expected, cxb.obj, config.width                       \
-                    );                                                            \
-                }                                                                 \
-                tcommit();                                                        \
-                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(                       \
-                    res.fallback_status, flag_value                               \
-                );                                                                \
-                goto cleanup;                                                     \
-            }                                                                     \
-        }                                                                         \
-                                                                                  \
-        /* cleanup */                                                             \
-    cleanup:                                                                      \
-        *result = res;                                                            \
-        return ok;                                                                \
-    }
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic min operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MIN( \
+    fn_name, tbegin, tcommit               \
+)                                          \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(    \
+        fn_name, tbegin, tcommit,          \
+        patomic_wrapped_tsx_do_min         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic max operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MAX( \
+    fn_name, tbegin, tcommit               \
+)                                          \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(    \
+        fn_name, tbegin, tcommit,          \
+        patomic_wrapped_tsx_do_max         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic umin operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_UMIN( \
+    fn_name, tbegin, tcommit                \
+)                                           \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(     \
+        fn_name, tbegin, tcommit,           \
+        patomic_wrapped_tsx_do_umin         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic umax operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_UMAX( \
+    fn_name, tbegin, tcommit                \
+)                                           \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(     \
+        fn_name, tbegin, tcommit,           \
+        patomic_wrapped_tsx_do_umax         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_min operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_MIN( \
+    fn_name, tbegin, tcommit                     \
+)                                                \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(         \
+        fn_name, tbegin, tcommit,                \
+        patomic_wrapped_tsx_do_min               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_max operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_MAX( \
+    fn_name, tbegin, tcommit                     \
+)                                                \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(         \
+        fn_name, tbegin, tcommit,                \
+        patomic_wrapped_tsx_do_max               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_umin operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UMIN( \
+    fn_name, tbegin, tcommit                      \
+)                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(          \
+        fn_name, tbegin, tcommit,                 \
+        patomic_wrapped_tsx_do_umin               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_umax operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UMAX( \
+    fn_name, tbegin, tcommit                      \
+)                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(          \
+        fn_name, tbegin, tcommit,                 \
+        patomic_wrapped_tsx_do_umax               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic add_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_ADD_SAT( \
+    fn_name, tbegin, tcommit                   \
+)                                              \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(        \
+        fn_name, tbegin, tcommit,              \
+        patomic_wrapped_tsx_do_add_sat         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic sub_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_SUB_SAT( \
+    fn_name, tbegin, tcommit                   \
+)                                              \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(        \
+        fn_name, tbegin, tcommit,              \
+        patomic_wrapped_tsx_do_sub_sat         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic uadd_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_UADD_SAT( \
+    fn_name, tbegin, tcommit                    \
+)                                               \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(         \
+        fn_name, tbegin, tcommit,               \
+        patomic_wrapped_tsx_do_uadd_sat         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic usub_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_void_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_USUB_SAT( \
+    fn_name, tbegin, tcommit                    \
+)                                               \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_VOID(         \
+        fn_name, tbegin, tcommit,               \
+        patomic_wrapped_tsx_do_usub_sat         \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_add_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_ADD_SAT( \
+    fn_name, tbegin, tcommit                         \
+)                                                    \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(             \
+        fn_name, tbegin, tcommit,                    \
+        patomic_wrapped_tsx_do_add_sat               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_sub_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_SUB_SAT( \
+    fn_name, tbegin, tcommit                         \
+)                                                    \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(             \
+        fn_name, tbegin, tcommit,                    \
+        patomic_wrapped_tsx_do_sub_sat               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_uadd_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UADD_SAT( \
+    fn_name, tbegin, tcommit                          \
+)                                                     \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(              \
+        fn_name, tbegin, tcommit,                     \
+        patomic_wrapped_tsx_do_uadd_sat               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic fetch_usub_sat operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_fetch_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_USUB_SAT( \
+    fn_name, tbegin, tcommit                          \
+)                                                     \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH(              \
+        fn_name, tbegin, tcommit,                     \
+        patomic_wrapped_tsx_do_usub_sat               \
+    )
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic double_cmpxchg operation
+ *   using tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_double_cmpxchg_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_DOUBLE_CMPXCHG(                             \
+    fn_name, tbegin, tcommit                                                      \
+)                                                                                 \
+    static int                                                                    \
+    fn_name(                                                                      \
+        const patomic_transaction_cmpxchg_t cxa,                                  \
+        const patomic_transaction_cmpxchg_t cxb,                                  \
+        patomic_transaction_config_wfb_t config,                                  \
+        patomic_transaction_result_wfb_t *const result                            \
+    )                                                                             \
+    {                                                                             \
+        /* declarations */                                                        \
+        int ok = 0;                                                               \
+        unsigned char flag_value = 0;                                             \
+        patomic_transaction_result_wfb_t res = {0};                               \
+        const patomic_transaction_flag_t flag = 0;                                \
+        if (config.flag_nullable == NULL)                                         \
+        {                                                                         \
+            config.flag_nullable = &flag;                                         \
+        }                                                                         \
+        if (config.fallback_flag_nullable == NULL)                                \
+        {                                                                         \
+            config.fallback_flag_nullable = &flag;                                \
+        }                                                                         \
+                                                                                  \
+        /* assert early */                                                        \
+        PATOMIC_WRAPPED_DO_ASSERT(result != NULL);                                \
+                                                                                  \
+        /* check zero */                                                          \
+        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_WFB(                                \
+            config, res, fallback, cleanup                                        \
+        );                                                                        \
+                                                                                  \
+        /* assertions */                                                          \
+        PATOMIC_WRAPPED_DO_ASSERT(cxa.obj != NULL);                               \
+        PATOMIC_WRAPPED_DO_ASSERT(cxa.expected != NULL);                          \
+        PATOMIC_WRAPPED_DO_ASSERT(cxa.desired != NULL);                           \
+        PATOMIC_WRAPPED_DO_ASSERT(cxb.obj != NULL);                               \
+        PATOMIC_WRAPPED_DO_ASSERT(cxb.expected != NULL);                          \
+        PATOMIC_WRAPPED_DO_ASSERT(cxb.desired != NULL);                           \
+                                                                                  \
+        /* operation */                                                           \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);                        \
+        while (config.attempts-- > 0ul)                                           \
+        {                                                                         \
+            ++res.attempts_made;                                                  \
+            res.status = tbegin();                                                \
+            if (res.status == 0ul)                                                \
+            {                                                                     \
+                int cmp_a = 0;                                                    \
+                int cmp_b = 0;                                                    \
+                flag_value = *config.flag_nullable;                               \
+                if (flag_value == 0)                                              \
+                {                                                                 \
+                    PATOMIC_WRAPPED_DO_TSX_MEMCMP(                                \
+                        cmp_a, cxa.obj, cxa.expected, config.width                \
+                    );                                                            \
+                    PATOMIC_WRAPPED_DO_TSX_MEMCMP(                                \
+                        cmp_b, cxb.obj, cxb.expected, config.width                \
+                    );                                                            \
+                    if (cmp_a == 0 && cmp_b == 0)                                 \
+                    {                                                             \
+                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                            \
+                            cxa.obj, cxa.desired, config.width                    \
+                        );                                                        \
+                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                            \
+                            cxb.obj, cxb.desired, config.width                    \
+                        );                                                        \
+                    }                                                             \
+                }                                                                 \
+                tcommit();                                                        \
+                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(                       \
+                    res.status, flag_value                                        \
+                );                                                                \
+                if (flag_value != 0 || !(cmp_a == 0 && cmp_b == 0))               \
+                {                                                                 \
+                    goto fallback;                                                \
+                }                                                                 \
+                ok = 1;                                                           \
+                goto cleanup;                                                     \
+            }                                                                     \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);                  \
+        }                                                                         \
+                                                                                  \
+        /* fallback */                                                            \
+    fallback:                                                                     \
+                                                                                  \
+        /* check zero */                                                          \
+        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_FALLBACK(                           \
+            config, res, cleanup                                                  \
+        );                                                                        \
+                                                                                  \
+        /* assertions */                                                          \
+        PATOMIC_WRAPPED_DO_ASSERT(cxa.obj != NULL);                               \
+        PATOMIC_WRAPPED_DO_ASSERT(cxa.expected != NULL);                          \
+        PATOMIC_WRAPPED_DO_ASSERT(cxb.obj != NULL);                               \
+        PATOMIC_WRAPPED_DO_ASSERT(cxb.expected != NULL);                          \
+                                                                                  \
+        /* operation */                                                           \
+        while (config.fallback_attempts-- > 0ul)                                  \
+        {                                                                         \
+            ++res.fallback_attempts_made;                                         \
+            res.fallback_status = tbegin();                                       \
+            if (res.fallback_status == 0ul)                                       \
+            {                                                                     \
+                flag_value = *config.fallback_flag_nullable;                      \
+                if (flag_value == 0)                                              \
+                {                                                                 \
+                    PATOMIC_WRAPPED_DO_TSX_MEMCPY(                                \
+                        cxa.expected, cxa.obj, config.width                       \
+                    );                                                            \
+                    PATOMIC_WRAPPED_DO_TSX_MEMCPY(                                \
+                        cxb.expected, cxb.obj, config.width                       \
+                    );                                                            \
+                }                                                                 \
+                tcommit();                                                        \
+                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(                       \
+                    res.fallback_status, flag_value                               \
+                );                                                                \
+                goto cleanup;                                                     \
+            }                                                                     \
+        }                                                                         \
+                                                                                  \
+        /* cleanup */                                                             \
+    cleanup:                                                                      \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, res);                       \
+        *result = res;                                                            \
+        return ok;                                                                \
+    }
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic multi_cmpxchg operation
+ *   using tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_multi_cmpxchg_t.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_CMPXCHG(                   \
+    fn_name, tbegin, tcommit                                           \
+)                                                                      \
+    static int                                                         \
+    fn_name(                                                           \
+        const patomic_transaction_cmpxchg_t *const cxs_buf,            \
+        const size_t cxs_len,                                          \
+        patomic_transaction_config_wfb_t config,                       \
+        patomic_transaction_result_wfb_t *const result                 \
+    )                                                                  \
+    {                                                                  \
+        /* declarations */                                             \
+        size_t i;                                                      \
+        int ok = 0;                                                    \
+        unsigned char flag_value = 0;                                  \
+        patomic_transaction_result_wfb_t res = {0};                    \
+        const patomic_transaction_flag_t flag = 0;                     \
+        if (config.flag_nullable == NULL)                              \
+        {                                                              \
+            config.flag_nullable = &flag;                              \
+        }                                                              \
+        if (config.fallback_flag_nullable == NULL)                     \
+        {                                                              \
+            config.fallback_flag_nullable = &flag;                     \
+        }                                                              \
+                                                                       \
+        /* assert early */                                             \
+        PATOMIC_WRAPPED_DO_ASSERT(result != NULL);                     \
+                                                                       \
+        /* check zero */                                               \
+        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_WFB(                     \
+            config, res, fallback, cleanup                             \
+        );                                                             \
+                                                                       \
+        /* assertions */                                               \
+        for (i = 0; i < cxs_len; ++i)                                  \
+        {                                                              \
+            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].obj != NULL);         \
+            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].expected != NULL);    \
+            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].desired != NULL);     \
+        }                                                              \
+                                                                       \
+        /* operation */                                                \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);             \
+        while (config.attempts-- > 0ul)                                \
+        {                                                              \
+            ++res.attempts_made;                                       \
+            res.status = tbegin();                                     \
+            if (res.status == 0ul)                                     \
+            {                                                          \
+                int cmp = 0;                                           \
+                flag_value = *config.flag_nullable;                    \
+                if (flag_value == 0)                                   \
+                {                                                      \
+                    for (i = 0; i < cxs_len && cmp == 0; ++i)          \
+                    {                                                  \
+                        PATOMIC_WRAPPED_DO_TSX_MEMCMP(                 \
+                            cmp,                                       \
+                            cxs_buf[i].obj,                            \
+                            cxs_buf[i].expected,                       \
+                            config.width                               \
+                        );                                             \
+                    }                                                  \
+                    if (cmp == 0)                                      \
+                    {                                                  \
+                        for (i = 0; i < cxs_len; ++i)                  \
+                        {                                              \
+                            PATOMIC_WRAPPED_DO_TSX_MEMCPY(             \
+                                cxs_buf[i].obj,                        \
+                                cxs_buf[i].desired,                    \
+                                config.width                           \
+                            );                                         \
+                        }                                              \
+                    }                                                  \
+                }                                                      \
+                tcommit();                                             \
+                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(            \
+                    res.status, flag_value                             \
+                );                                                     \
+                if (flag_value != 0 || cmp != 0)                       \
+                {                                                      \
+                    goto fallback;                                     \
+                }                                                      \
+                ok = 1;                                                \
+                goto cleanup;                                          \
+            }                                                          \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);       \
+        }                                                              \
+                                                                       \
+        /* fallback */                                                 \
+    fallback:                                                          \
+                                                                       \
+        /* check zero */                                               \
+        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO_FALLBACK(                \
+            config, res, cleanup                                       \
+        );                                                             \
+                                                                       \
+        /* assertions */                                               \
+        for (i = 0; i < cxs_len; ++i)                                  \
+        {                                                              \
+            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].obj != NULL);         \
+            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].expected != NULL);    \
+        }                                                              \
+                                                                       \
+        /* operation */                                                \
+        while (config.fallback_attempts-- > 0ul)                       \
+        {                                                              \
+            ++res.fallback_attempts_made;                              \
+            res.fallback_status = tbegin();                            \
+            if (res.fallback_status == 0ul)                            \
+            {                                                          \
+                flag_value = *config.fallback_flag_nullable;           \
+                if (flag_value == 0)                                   \
+                {                                                      \
+                    for (i = 0; i < cxs_len; ++i)                      \
+                    {                                                  \
+                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                 \
+                            cxs_buf[i].expected,                       \
+                            cxs_buf[i].obj,                            \
+                            config.width                               \
+                        );                                             \
+                    }                                                  \
+                }                                                      \
+                tcommit();                                             \
+                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(            \
+                    res.fallback_status, flag_value                    \
+                );                                                     \
+                goto cleanup;                                          \
+            }                                                          \
+        }                                                              \
+                                                                       \
+        /* cleanup */                                                  \
+    cleanup:                                                           \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, res);            \
+        *result = res;                                                 \
+        return ok;                                                     \
+    }
+
+
+/**
+ * @addtogroup wrapped.tsx
+ *
+ * @brief
+ *   Defines a function which implements an atomic multi_load operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_opsig_transaction_multi_load_t.
+ *
+ *   The transaction only reads from the objects, so it does not take their
+ *   cache lines exclusively.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param tbegin
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tbegin_t.
+ *
+ * @param tcommit
+ *   A callable with the signature and semantics of
+ *   patomic_opsig_transaction_tcommit_t.
+ */
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_LOAD(                      \
+    fn_name, tbegin, tcommit                                           \
+)                                                                      \
+    static void                                                        \
+    fn_name(                                                           \
+        const patomic_transaction_load_t *const lds_buf,               \
+        const size_t lds_len,                                          \
+        patomic_transaction_config_t config,                           \
+        patomic_transaction_result_t *const result                     \
+    )                                                                  \
+    {                                                                  \
+        /* declarations */                                             \
+        size_t i;                                                      \
+        unsigned char flag_value = 0;                                  \
+        patomic_transaction_result_t res = {0};                        \
+        const patomic_transaction_flag_t flag = 0;                     \
+        if (config.flag_nullable == NULL)                              \
+        {                                                              \
+            config.flag_nullable = &flag;                              \
+        }                                                              \
+                                                                       \
+        /* assert early */                                             \
+        PATOMIC_WRAPPED_DO_ASSERT(result != NULL);                     \
+                                                                       \
+        /* check zero */                                               \
+        PATOMIC_WRAPPED_TSX_CHECK_CONFIG_ZERO(config, res, cleanup);   \
+                                                                       \
+        /* assertions */                                               \
+        for (i = 0; i < lds_len; ++i)                                  \
+        {                                                              \
+            PATOMIC_WRAPPED_DO_ASSERT(lds_buf[i].obj != NULL);         \
+            PATOMIC_WRAPPED_DO_ASSERT(lds_buf[i].ret != NULL);         \
+        }                                                              \
+                                                                       \
+        /* operation */                                                \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);             \
+        while (config.attempts-- > 0ul)                                \
+        {                                                              \
+            ++res.attempts_made;                                       \
+            res.status = tbegin();                                     \
+            if (res.status == 0ul)                                     \
+            {                                                          \
+                flag_value = *config.flag_nullable;                    \
+                if (flag_value == 0)                                   \
+                {                                                      \
+                    for (i = 0; i < lds_len; ++i)                      \
+                    {                                                  \
+                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                 \
+                            lds_buf[i].ret,                            \
+                            lds_buf[i].obj,                            \
+                            config.width                               \
+                        );                                             \
+                    }                                                  \
+                }                                                      \
+                tcommit();                                             \
+                PATOMIC_WRAPPED_TSX_UPDATE_STATUS_FOR_FLAG(            \
+                    res.status, flag_value                             \
+                );                                                     \
+                goto cleanup;                                          \
+            }                                                          \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);       \
+        }                                                              \
+                                                                       \
+        /* cleanup */                                                  \
+    cleanup:                                                           \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);                \
+        *result = res;                                                 \
+    }
+
+
+// internal helper macro for MULTI_OP
+#define patomic_wrapped_tsx_do_multi_op(op, width)                            \
+    do {                                                                      \
+        unsigned char *const uc_obj = (unsigned char *) (op).obj;             \
+        const unsigned char *const uc_arg = (const unsigned char *) (op).arg; \
+        switch ((op).kind) {                                                  \
+            case patomic_transaction_op_ADD:                                  \
+                patomic_wrapped_tsx_do_add(uc_obj, uc_arg, width);            \
+                break;                                                        \
+            case patomic_transaction_op_SUB:                                  \
+                patomic_wrapped_tsx_do_sub(uc_obj, uc_arg, width);            \
+                break;                                                        \
+            case patomic_transaction_op_AND:                                  \
+                patomic_wrapped_tsx_do_bin_and(uc_obj, uc_arg, width);        \
+                break;                                                        \
+            case patomic_transaction_op_OR:                                   \
+                patomic_wrapped_tsx_do_bin_or(uc_obj, uc_arg, width);         \
+                break;                                                        \
+            case patomic_transaction_op_XOR:                                  \
+                patomic_wrapped_tsx_do_bin_xor(uc_obj, uc_arg, width);        \
+                break;                                                        \
+            default: /* STORE, EXCHANGE, CMPXCHG */                           \
+                PATOMIC_WRAPPED_DO_TSX_MEMCPY((op).obj, (op).arg, width);     \
+                break;                                                        \
+        }                                                                     \
+    } while (0)
 
 
 /**
  * @addtogroup wrapped.tsx
  *
  * @brief
- *   Defines a function which implements an atomic multi_cmpxchg operation
- *   using tbegin and tcommit as the underlying atomic transaction primitives.
+ *   Defines a function which implements an atomic multi_op operation using
+ *   tbegin and tcommit as the underlying atomic transaction primitives.
  *
  * @details
  *   The defined function's signature will match
- *   patomic_opsig_transaction_multi_cmpxchg_t.
+ *   patomic_opsig_transaction_multi_op_t.
  *
  * @param fn_name
  *   The name of the function to be defined.
@@ -1889,13 +2805,13 @@
  *   A callable with the signature and semantics of
  *   patomic_opsig_transaction_tcommit_t.
  */
-#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_CMPXCHG(                   \
+#define PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_OP(                        \
     fn_name, tbegin, tcommit                                           \
 )                                                                      \
     static int                                                         \
     fn_name(                                                           \
-        const patomic_transaction_cmpxchg_t *const cxs_buf,            \
-        const size_t cxs_len,                                          \
+        const patomic_transaction_op_t *const ops_buf,                 \
+        const size_t ops_len,                                          \
         patomic_transaction_config_wfb_t config,                       \
         patomic_transaction_result_wfb_t *const result                 \
     )                                                                  \
@@ -1924,14 +2840,22 @@
         );                                                             \
                                                                        \
         /* assertions */                                               \
-        for (i = 0; i < cxs_len; ++i)                                  \
+        for (i = 0; i < ops_len; ++i)                                  \
         {                                                              \
-            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].obj != NULL);         \
-            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].expected != NULL);    \
-            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].desired != NULL);     \
+            PATOMIC_WRAPPED_DO_ASSERT(                                 \
+                ops_buf[i].kind >= patomic_transaction_op_STORE &&     \
+                ops_buf[i].kind <= patomic_transaction_op_XOR          \
+            );                                                         \
+            PATOMIC_WRAPPED_DO_ASSERT(ops_buf[i].obj != NULL);         \
+            PATOMIC_WRAPPED_DO_ASSERT(ops_buf[i].arg != NULL);         \
+            PATOMIC_WRAPPED_DO_ASSERT(                                 \
+                ops_buf[i].ret != NULL ||                              \
+                ops_buf[i].kind != patomic_transaction_op_CMPXCHG      \
+            );                                                         \
         }                                                              \
                                                                        \
         /* operation */                                                \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);             \
         while (config.attempts-- > 0ul)                                \
         {                                                              \
             ++res.attempts_made;                                       \
@@ -1942,23 +2866,35 @@
                 flag_value = *config.flag_nullable;                    \
                 if (flag_value == 0)                                   \
                 {                                                      \
-                    for (i = 0; i < cxs_len && cmp == 0; ++i)          \
+                    for (i = 0; i < ops_len && cmp == 0; ++i)          \
                     {                                                  \
-                        PATOMIC_WRAPPED_DO_TSX_MEMCMP(                 \
-                            cmp,                                       \
-                            cxs_buf[i].obj,                            \
-                            cxs_buf[i].expected,                       \
-                            config.width                               \
-                        );                                             \
+                        if (ops_buf[i].kind ==                         \
+                            patomic_transaction_op_CMPXCHG)            \
+                        {                                              \
+                            PATOMIC_WRAPPED_DO_TSX_MEMCMP(             \
+                                cmp,                                   \
+                                ops_buf[i].obj,                        \
+                                ops_buf[i].ret,                        \
+                                config.width                           \
+                            );                                         \
+                        }                                              \
                     }                                                  \
                     if (cmp == 0)                                      \
                     {                                                  \
-                        for (i = 0; i < cxs_len; ++i)                  \
+                        for (i = 0; i < ops_len; ++i)                  \
                         {                                              \
-                            PATOMIC_WRAPPED_DO_TSX_MEMCPY(             \
-                                cxs_buf[i].obj,                        \
-                                cxs_buf[i].desired,                    \
-                                config.width                           \
+                            if (ops_buf[i].ret != NULL &&              \
+                                ops_buf[i].kind !=                     \
+                                patomic_transaction_op_CMPXCHG)        \
+                            {                                          \
+                                PATOMIC_WRAPPED_DO_TSX_MEMCPY(         \
+                                    ops_buf[i].ret,                    \
+                                    ops_buf[i].obj,                    \
+                                    config.width                       \
+                                );                                     \
+                            }                                          \
+                            patomic_wrapped_tsx_do_multi_op(           \
+                                ops_buf[i], config.width               \
                             );                                         \
                         }                                              \
                     }                                                  \
@@ -1974,6 +2910,7 @@
                 ok = 1;                                                \
                 goto cleanup;                                          \
             }                                                          \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);       \
         }                                                              \
                                                                        \
         /* fallback */                                                 \
@@ -1985,10 +2922,9 @@
         );                                                             \
                                                                        \
         /* assertions */                                               \
-        for (i = 0; i < cxs_len; ++i)                                  \
+        for (i = 0; i < ops_len; ++i)                                  \
         {                                                              \
-            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].obj != NULL);         \
-            PATOMIC_WRAPPED_DO_ASSERT(cxs_buf[i].expected != NULL);    \
+            PATOMIC_WRAPPED_DO_ASSERT(ops_buf[i].obj != NULL);         \
         }                                                              \
                                                                        \
         /* operation */                                                \
@@ -2001,13 +2937,16 @@
                 flag_value = *config.fallback_flag_nullable;           \
                 if (flag_value == 0)                                   \
                 {                                                      \
-                    for (i = 0; i < cxs_len; ++i)                      \
+                    for (i = 0; i < ops_len; ++i)                      \
                     {                                                  \
-                        PATOMIC_WRAPPED_DO_TSX_MEMCPY(                 \
-                            cxs_buf[i].expected,                       \
-                            cxs_buf[i].obj,                            \
-                            config.width                               \
-                        );                                             \
+                        if (ops_buf[i].ret != NULL)                    \
+                        {                                              \
+                            PATOMIC_WRAPPED_DO_TSX_MEMCPY(             \
+                                ops_buf[i].ret,                        \
+                                ops_buf[i].obj,                        \
+                                config.width                           \
+                            );                                         \
+                        }                                              \
                     }                                                  \
                 }                                                      \
                 tcommit();                                             \
@@ -2020,6 +2959,7 @@
                                                                        \
         /* cleanup */                                                  \
     cleanup:                                                           \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, res);            \
         *result = res;                                                 \
         return ok;                                                     \
     }
@@ -2077,6 +3017,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(fn != NULL);                       \
                                                                      \
         /* operation */                                              \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);           \
         while (config.attempts-- > 0ul)                              \
         {                                                            \
             ++res.attempts_made;                                     \
@@ -2094,10 +3035,12 @@
                 );                                                   \
                 goto cleanup;                                        \
             }                                                        \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);     \
         }                                                            \
                                                                      \
         /* cleanup */                                                \
     cleanup:                                                         \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT(config, res);              \
         *result = res;                                               \
     }
 
@@ -2162,6 +3105,7 @@
         PATOMIC_WRAPPED_DO_ASSERT(fn != NULL);                               \
                                                                              \
         /* operation */                                                      \
+        PATOMIC_WRAPPED_TSX_APPLY_POLICY_ATTEMPTS(config);                   \
         while (config.attempts-- > 0ul)                                      \
         {                                                                    \
             ++res.attempts_made;                                             \
@@ -2183,6 +3127,7 @@
                 }                                                            \
                 goto cleanup;                                                \
             }                                                                \
+            PATOMIC_WRAPPED_TSX_CHECK_POLICY_RETRY(config, res);             \
         }                                                                    \
                                                                              \
         /* fallback */                                                       \
@@ -2222,6 +3167,7 @@
                                                                              \
         /* cleanup */                                                        \
     cleanup:                                                                 \
+        PATOMIC_WRAPPED_TSX_RECORD_RESULT_WFB(config, res);                  \
         *result = res;                                                       \
         return res.status == 0ul;                                            \
     }
@@ -2261,6 +3207,7 @@
         pao.fp_exchange = patomic_opimpl_exchange_##name;         \
         pao.fp_cmpxchg_weak = patomic_opimpl_cmpxchg_weak_##name; \
         pao.fp_cmpxchg_strong = NULL;                             \
+        pao.fp_fetch_update = NULL;                               \
         return pao;                                               \
     }
 
@@ -2392,54 +3339,118 @@
  *   A callable with the signature and semantics of
  *   patomic_opsig_transaction_tcommit_t.
  */
-#define PATOMIC_WRAPPED_TSX_DEFINE_ARITHMETIC_OPS_CREATE(   \
-    name, tbegin, tcommit                                   \
-)                                                           \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_ADD(                      \
-        patomic_opimpl_void_add_##name, tbegin, tcommit     \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_SUB(                      \
-        patomic_opimpl_void_sub_##name, tbegin, tcommit     \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_INC(                      \
-        patomic_opimpl_void_inc_##name, tbegin, tcommit     \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_DEC(                      \
-        patomic_opimpl_void_dec_##name, tbegin, tcommit     \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_NEG(                      \
-        patomic_opimpl_void_neg_##name, tbegin, tcommit     \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_ADD(                \
-        patomic_opimpl_fetch_add_##name, tbegin, tcommit    \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_SUB(                \
-        patomic_opimpl_fetch_sub_##name, tbegin, tcommit    \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_INC(                \
-        patomic_opimpl_fetch_inc_##name, tbegin, tcommit    \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_DEC(                \
-        patomic_opimpl_fetch_dec_##name, tbegin, tcommit    \
-    )                                                       \
-    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_NEG(                \
-        patomic_opimpl_fetch_neg_##name, tbegin, tcommit    \
-    )                                                       \
-    static patomic_ops_transaction_arithmetic_t             \
-    patomic_ops_arithmetic_create_##name(void)              \
-    {                                                       \
-        patomic_ops_transaction_arithmetic_t pao = {0};     \
-        pao.fp_add = patomic_opimpl_void_add_##name;        \
-        pao.fp_sub = patomic_opimpl_void_sub_##name;        \
-        pao.fp_inc = patomic_opimpl_void_inc_##name;        \
-        pao.fp_dec = patomic_opimpl_void_dec_##name;        \
-        pao.fp_neg = patomic_opimpl_void_neg_##name;        \
-        pao.fp_fetch_add = patomic_opimpl_fetch_add_##name; \
-        pao.fp_fetch_sub = patomic_opimpl_fetch_sub_##name; \
-        pao.fp_fetch_inc = patomic_opimpl_fetch_inc_##name; \
-        pao.fp_fetch_dec = patomic_opimpl_fetch_dec_##name; \
-        pao.fp_fetch_neg = patomic_opimpl_fetch_neg_##name; \
-        return pao;                                         \
+#define PATOMIC_WRAPPED_TSX_DEFINE_ARITHMETIC_OPS_CREATE(             \
+    name, tbegin, tcommit                                             \
+)                                                                     \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_ADD(                                \
+        patomic_opimpl_void_add_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_SUB(                                \
+        patomic_opimpl_void_sub_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_INC(                                \
+        patomic_opimpl_void_inc_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_DEC(                                \
+        patomic_opimpl_void_dec_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_NEG(                                \
+        patomic_opimpl_void_neg_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_MIN(                                \
+        patomic_opimpl_void_min_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_MAX(                                \
+        patomic_opimpl_void_max_##name, tbegin, tcommit               \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_UMIN(                               \
+        patomic_opimpl_void_umin_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_UMAX(                               \
+        patomic_opimpl_void_umax_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_ADD_SAT(                            \
+        patomic_opimpl_void_add_sat_##name, tbegin, tcommit           \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_SUB_SAT(                            \
+        patomic_opimpl_void_sub_sat_##name, tbegin, tcommit           \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_UADD_SAT(                           \
+        patomic_opimpl_void_uadd_sat_##name, tbegin, tcommit          \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_USUB_SAT(                           \
+        patomic_opimpl_void_usub_sat_##name, tbegin, tcommit          \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_ADD(                          \
+        patomic_opimpl_fetch_add_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_SUB(                          \
+        patomic_opimpl_fetch_sub_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_INC(                          \
+        patomic_opimpl_fetch_inc_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_DEC(                          \
+        patomic_opimpl_fetch_dec_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_NEG(                          \
+        patomic_opimpl_fetch_neg_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_MIN(                          \
+        patomic_opimpl_fetch_min_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_MAX(                          \
+        patomic_opimpl_fetch_max_##name, tbegin, tcommit              \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UMIN(                         \
+        patomic_opimpl_fetch_umin_##name, tbegin, tcommit             \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UMAX(                         \
+        patomic_opimpl_fetch_umax_##name, tbegin, tcommit             \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_ADD_SAT(                      \
+        patomic_opimpl_fetch_add_sat_##name, tbegin, tcommit          \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_SUB_SAT(                      \
+        patomic_opimpl_fetch_sub_sat_##name, tbegin, tcommit          \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_UADD_SAT(                     \
+        patomic_opimpl_fetch_uadd_sat_##name, tbegin, tcommit         \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_FETCH_USUB_SAT(                     \
+        patomic_opimpl_fetch_usub_sat_##name, tbegin, tcommit         \
+    )                                                                 \
+    static patomic_ops_transaction_arithmetic_t                       \
+    patomic_ops_arithmetic_create_##name(void)                        \
+    {                                                                 \
+        patomic_ops_transaction_arithmetic_t pao = {0};               \
+        pao.fp_add = patomic_opimpl_void_add_##name;                  \
+        pao.fp_sub = patomic_opimpl_void_sub_##name;                  \
+        pao.fp_inc = patomic_opimpl_void_inc_##name;                  \
+        pao.fp_dec = patomic_opimpl_void_dec_##name;                  \
+        pao.fp_neg = patomic_opimpl_void_neg_##name;                  \
+        pao.fp_min = patomic_opimpl_void_min_##name;                  \
+        pao.fp_max = patomic_opimpl_void_max_##name;                  \
+        pao.fp_umin = patomic_opimpl_void_umin_##name;                \
+        pao.fp_umax = patomic_opimpl_void_umax_##name;                \
+        pao.fp_add_sat = patomic_opimpl_void_add_sat_##name;          \
+        pao.fp_sub_sat = patomic_opimpl_void_sub_sat_##name;          \
+        pao.fp_uadd_sat = patomic_opimpl_void_uadd_sat_##name;        \
+        pao.fp_usub_sat = patomic_opimpl_void_usub_sat_##name;        \
+        pao.fp_fetch_add = patomic_opimpl_fetch_add_##name;           \
+        pao.fp_fetch_sub = patomic_opimpl_fetch_sub_##name;           \
+        pao.fp_fetch_inc = patomic_opimpl_fetch_inc_##name;           \
+        pao.fp_fetch_dec = patomic_opimpl_fetch_dec_##name;           \
+        pao.fp_fetch_neg = patomic_opimpl_fetch_neg_##name;           \
+        pao.fp_fetch_min = patomic_opimpl_fetch_min_##name;           \
+        pao.fp_fetch_max = patomic_opimpl_fetch_max_##name;           \
+        pao.fp_fetch_umin = patomic_opimpl_fetch_umin_##name;         \
+        pao.fp_fetch_umax = patomic_opimpl_fetch_umax_##name;         \
+        pao.fp_fetch_add_sat = patomic_opimpl_fetch_add_sat_##name;   \
+        pao.fp_fetch_sub_sat = patomic_opimpl_fetch_sub_sat_##name;   \
+        pao.fp_fetch_uadd_sat = patomic_opimpl_fetch_uadd_sat_##name; \
+        pao.fp_fetch_usub_sat = patomic_opimpl_fetch_usub_sat_##name; \
+        return pao;                                                   \
     }
 
 
@@ -2477,6 +3488,12 @@
     PATOMIC_WRAPPED_TSX_DEFINE_OP_GENERIC_WFB(                        \
         patomic_opimpl_generic_wfb_##name, tbegin, tcommit            \
     )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_LOAD(                         \
+        patomic_opimpl_multi_load_##name, tbegin, tcommit             \
+    )                                                                 \
+    PATOMIC_WRAPPED_TSX_DEFINE_OP_MULTI_OP(                           \
+        patomic_opimpl_multi_op_##name, tbegin, tcommit               \
+    )                                                                 \
     static patomic_ops_transaction_special_t                          \
     patomic_ops_special_create_##name(void)                           \
     {                                                                 \
@@ -2485,6 +3502,8 @@
         pao.fp_multi_cmpxchg = patomic_opimpl_multi_cmpxchg_##name;   \
         pao.fp_generic = patomic_opimpl_generic_##name;               \
         pao.fp_generic_wfb = patomic_opimpl_generic_wfb_##name;       \
+        pao.fp_multi_load = patomic_opimpl_multi_load_##name;         \
+        pao.fp_multi_op = patomic_opimpl_multi_op_##name;             \
         return pao;                                                   \
     }
 
@@ -0,0 +1,251 @@
+/* Copyright (c) doodspav. */
+/* SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception */
+
+#ifndef PATOMIC_WRAPPED_WAIT_H
+#define PATOMIC_WRAPPED_WAIT_H
+
+#include "base.h"
+
+#include <patomic/internal/wait.h>
+
+
+/**
+ * @addtogroup wrapped.wait
+ *
+ * @brief
+ *   Defines a function which checks whether the value of an object no longer
+ *   compares equal to an old value, using load as the underlying atomic
+ *   operation.
+ *
+ * @details
+ *   The defined function's signature will match
+ *   patomic_internal_wait_differs_t.
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param do_atomic_load_explicit
+ *   A macro, M, callable as 'M(type, obj, order, res);' in block scope.
+ *
+ *   The arguments provided are:
+ *   - 'type'  : forwarded directly from the 'type' argument in this macro
+ *   - 'obj'   : an expression of type 'const volatile atomic_type *'
+ *   - 'order' : an expression of type 'int' whose value is a valid load memory
+ *               order
+ *   - 'res'   : the name of an identifier designating an object of type 'type'
+ *
+ *   The expected behaviour of calling the macro M as above is:
+ *   - the value of the object pointed to by 'obj' is atomically read
+ *   - 'res' is set to the value which was read
+ *   - the atomic operation uses a load memory ordering at least as strong as
+ *     'order'
+ */
+#define PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS(                         \
+    atomic_type, type, fn_name,                                         \
+    do_atomic_load_explicit                                             \
+)                                                                       \
+    static int                                                          \
+    fn_name(                                                            \
+        const volatile void *const obj,                                 \
+        const void *const old,                                          \
+        const int order                                                 \
+    )                                                                   \
+    {                                                                   \
+        /* static assertions */                                         \
+        PATOMIC_STATIC_ASSERT(                                          \
+            sizeof_type_eq_atype, sizeof(type) == sizeof(atomic_type)); \
+                                                                        \
+        /* declarations */                                              \
+        type res;                                                       \
+        type exp;                                                       \
+                                                                        \
+        /* inputs */                                                    \
+        PATOMIC_WRAPPED_DO_MEMCPY(&exp, old, sizeof(type));             \
+                                                                        \
+        /* operation */                                                 \
+        do_atomic_load_explicit(                                        \
+            type,                                                       \
+            (const volatile atomic_type *) obj,                         \
+            order,                                                      \
+            res                                                         \
+        );                                                              \
+                                                                        \
+        /* outputs */                                                   \
+        return memcmp(&res, &exp, sizeof(type)) != 0;                   \
+    }
+
+
+/**
+ * @addtogroup wrapped.wait
+ *
+ * @brief
+ *   Defines a function which implements an atomic wait operation using a
+ *   function defined by PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS to load the
+ *   value of the object.
+ *
+ * @details
+ *   The defined function's signature will match either patomic_opsig_wait_t
+ *   or patomic_opsig_explicit_wait_t (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param differs_fn_name
+ *   The name of a function defined by PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS
+ *   with the same 'atomic_type' and 'type'.
+ */
+#define PATOMIC_WRAPPED_WAIT_DEFINE_OP_WAIT(                                 \
+    atomic_type, type, fn_name, vis_p, order,                                \
+    differs_fn_name                                                          \
+)                                                                            \
+    static void                                                              \
+    fn_name(                                                                 \
+        const volatile void *const obj                                       \
+        ,const void *const old                                               \
+ vis_p(_,const int order)                                                    \
+    )                                                                        \
+    {                                                                        \
+        /* assertions */                                                     \
+        PATOMIC_WRAPPED_DO_ASSERT(obj != NULL);                              \
+        PATOMIC_WRAPPED_DO_ASSERT(old != NULL);                              \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(obj, atomic_type);                 \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_LOAD_ORDER((int) order)); \
+                                                                             \
+        /* operation */                                                      \
+        PATOMIC_IGNORE_UNUSED(patomic_internal_wait(                         \
+            obj, old, sizeof(type), (int) order, differs_fn_name, NULL       \
+        ));                                                                  \
+    }
+
+
+/**
+ * @addtogroup wrapped.wait
+ *
+ * @brief
+ *   Defines a function which implements an atomic timed wait operation using
+ *   a function defined by PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS to load the
+ *   value of the object.
+ *
+ * @details
+ *   The defined function's signature will match either
+ *   patomic_opsig_wait_timed_t or patomic_opsig_explicit_wait_timed_t
+ *   (depending on the value of 'vis_p').
+ *
+ * @param atomic_type
+ *   The type of the object on which the atomic operation is to be performed.
+ *   Must not be a VLA or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param vis_p
+ *   Either the macro 'SHOW_P' if the function should be defined as taking a
+ *   memory order parameter (a.k.a. explicit), or the macro 'HIDE_P' if it
+ *   should not (a.k.a. implicit).
+ *
+ * @param order
+ *   The literal token 'order' if 'vis_p' is 'SHOW_P', otherwise the desired
+ *   memory order to be used implicitly by the atomic operation.
+ *
+ * @param differs_fn_name
+ *   The name of a function defined by PATOMIC_WRAPPED_WAIT_DEFINE_OP_DIFFERS
+ *   with the same 'atomic_type' and 'type'.
+ */
+#define PATOMIC_WRAPPED_WAIT_DEFINE_OP_WAIT_TIMED(                           \
+    atomic_type, type, fn_name, vis_p, order,                                \
+    differs_fn_name                                                          \
+)                                                                            \
+    static int                                                               \
+    fn_name(                                                                 \
+        const volatile void *const obj                                       \
+        ,const void *const old                                               \
+ vis_p(_,const int order)                                                    \
+        ,const unsigned long timeout_us                                      \
+    )                                                                        \
+    {                                                                        \
+        /* assertions */                                                     \
+        PATOMIC_WRAPPED_DO_ASSERT(obj != NULL);                              \
+        PATOMIC_WRAPPED_DO_ASSERT(old != NULL);                              \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(obj, atomic_type);                 \
+        PATOMIC_WRAPPED_DO_ASSERT(PATOMIC_IS_VALID_LOAD_ORDER((int) order)); \
+                                                                             \
+        /* operation */                                                      \
+        return patomic_internal_wait(                                        \
+            obj, old, sizeof(type), (int) order, differs_fn_name,            \
+            &timeout_us                                                      \
+        );                                                                   \
+    }
+
+
+/**
+ * @addtogroup wrapped.wait
+ *
+ * @brief
+ *   Defines a function which implements an atomic notify operation.
+ *
+ * @details
+ *   The defined function's signature will match both patomic_opsig_notify_t
+ *   and patomic_opsig_explicit_notify_t.
+ *
+ * @param atomic_type
+ *   The type of the object on which threads may be waiting. Must not be a VLA
+ *   or an array of unknown size.
+ *
+ * @param type
+ *   The non-atomic counterpart of 'atomic_type'. This must have the same size
+ *   as 'atomic_type' and must not have a stricter alignment.
+ *
+ * @param fn_name
+ *   The name of the function to be defined.
+ *
+ * @param notify_all
+ *   The literal token '0' if at least one waiting thread should be unblocked,
+ *   or '1' if all waiting threads should be unblocked.
+ */
+#define PATOMIC_WRAPPED_WAIT_DEFINE_OP_NOTIFY(                  \
+    atomic_type, type, fn_name, notify_all                      \
+)                                                               \
+    static void                                                 \
+    fn_name(                                                    \
+        const volatile void *const obj                          \
+    )                                                           \
+    {                                                           \
+        /* assertions */                                        \
+        PATOMIC_WRAPPED_DO_ASSERT(obj != NULL);                 \
+        PATOMIC_WRAPPED_DO_ASSERT_ALIGNED(obj, atomic_type);    \
+                                                                \
+        /* operation */                                         \
+        patomic_internal_notify(obj, sizeof(type), notify_all); \
+    }
+
+
+#endif  /* PATOMIC_WRAPPED_WAIT_H */
@@ -6,6 +6,7 @@
 #include <patomic/internal/align.h>
 #include <patomic/internal/combine.h>
 #include <patomic/internal/feature_check.h>
+#include <patomic/internal/profile.h>
 
 #include <patomic/stdlib/assert.h>
 #include <patomic/stdlib/math.h>
@@ -51,17 +52,20 @@ compare_explicit(
 }
 
 
-patomic_t
-patomic_create(
+static patomic_t
+create_implicit(
     const size_t byte_width,
     const patomic_memory_order_t order,
     const unsigned int options,
     const unsigned int kinds,
-    const unsigned long ids
+    const unsigned long ids,
+    const unsigned int opcats_mask,
+    const unsigned int opkinds_mask
 )
 {
     /* declare variables */
     const unsigned int opcats = ~0u;
+    const int is_masked = (opcats_mask != ~0u) || (opkinds_mask != ~0u);
     patomic_t ret;
     patomic_t objs[PATOMIC_IMPL_REGISTER_SIZE];
     patomic_t *begin = objs;
@@ -96,7 +100,15 @@ patomic_create(
                 patomic_assert_always(end->ops.bitwise_ops.fp_test == NULL);
             }
 
-            /* only add to array if some operation is supported */
+            /* remove operations which were not requested */
+            if (is_masked)
+            {
+                patomic_internal_feature_mask(
+                    &end->ops, opcats_mask, opkinds_mask
+                );
+            }
+
+            /* only add to array if some requested operation is supported */
             if (opcats != patomic_internal_feature_check_any(&end->ops, opcats))
             {
                 ++end;
@@ -119,20 +131,29 @@ patomic_create(
         patomic_internal_combine(&ret, begin);
     }
 
+    /* wrap operations if profiling was requested */
+    if (options & (unsigned int) patomic_option_PROFILE)
+    {
+        patomic_internal_profile_wrap(&ret);
+    }
+
     return ret;
 }
 
 
-patomic_explicit_t
-patomic_create_explicit(
+static patomic_explicit_t
+create_explicit(
     const size_t byte_width,
     const unsigned int options,
     const unsigned int kinds,
-    const unsigned long ids
+    const unsigned long ids,
+    const unsigned int opcats_mask,
+    const unsigned int opkinds_mask
 )
 {
     /* declare variables */
     const unsigned int opcats = ~0u;
+    const int is_masked = (opcats_mask != ~0u) || (opkinds_mask != ~0u);
     patomic_explicit_t ret;
     patomic_explicit_t objs[PATOMIC_IMPL_REGISTER_SIZE];
     patomic_explicit_t *begin = objs;
@@ -151,7 +172,15 @@ patomic_create_explicit(
             /* check that alignment values are valid */
             assert_valid_alignment(end->align);
 
-            /* only add to array if some operation is supported */
+            /* remove operations which were not requested */
+            if (is_masked)
+            {
+                patomic_internal_feature_mask_explicit(
+                    &end->ops, opcats_mask, opkinds_mask
+                );
+            }
+
+            /* only add to array if some requested operation is supported */
             if (opcats != patomic_internal_feature_check_any_explicit(&end->ops, opcats))
             {
                 ++end;
@@ -174,10 +203,76 @@ patomic_create_explicit(
         patomic_internal_combine_explicit(&ret, begin);
     }
 
+    /* wrap operations if profiling was requested */
+    if (options & (unsigned int) patomic_option_PROFILE)
+    {
+        patomic_internal_profile_wrap_explicit(&ret);
+    }
+
     return ret;
 }
 
 
+patomic_t
+patomic_create(
+    const size_t byte_width,
+    const patomic_memory_order_t order,
+    const unsigned int options,
+    const unsigned int kinds,
+    const unsigned long ids
+)
+{
+    /* defer to internal implementation with all operations requested */
+    return create_implicit(byte_width, order, options, kinds, ids, ~0u, ~0u);
+}
+
+
+patomic_t
+patomic_create_masked(
+    const size_t byte_width,
+    const patomic_memory_order_t order,
+    const unsigned int options,
+    const unsigned int kinds,
+    const unsigned long ids,
+    const unsigned int opcats,
+    const unsigned int opkinds
+)
+{
+    /* defer to internal implementation */
+    return create_implicit(
+        byte_width, order, options, kinds, ids, opcats, opkinds
+    );
+}
+
+
+patomic_explicit_t
+patomic_create_explicit(
+    const size_t byte_width,
+    const unsigned int options,
+    const unsigned int kinds,
+    const unsigned long ids
+)
+{
+    /* defer to internal implementation with all operations requested */
+    return create_explicit(byte_width, options, kinds, ids, ~0u, ~0u);
+}
+
+
+patomic_explicit_t
+patomic_create_explicit_masked(
+    const size_t byte_width,
+    const unsigned int options,
+    const unsigned int kinds,
+    const unsigned long ids,
+    const unsigned int opcats,
+    const unsigned int opkinds
+)
+{
+    /* defer to internal implementation */
+    return create_explicit(byte_width, options, kinds, ids, opcats, opkinds);
+}
+
+
 patomic_transaction_t
 patomic_create_transaction(
     const unsigned int options,
@@ -249,6 +344,9 @@ patomic_create_transaction(
                 /* not possible for cmpxchg_strong to be implemented */
                 patomic_assert_always(ret.ops.xchg_ops.fp_cmpxchg_strong == NULL);
 
+                /* not possible to run a user callback inside a transaction */
+                patomic_assert_always(ret.ops.xchg_ops.fp_fetch_update == NULL);
+
                 /* ignore previous implementations if current one has a better kind */
                 if (patomic_impl_register[i].kind > last_kind)
                 {
@@ -270,3 +368,83 @@ patomic_create_transaction(
         return patomic_impl_create_transaction_null(options);
     }
 }
+
+
+patomic_fence_t
+patomic_create_fence(
+    const unsigned int kinds,
+    const unsigned long ids
+)
+{
+    /* declare variables */
+    patomic_kind_t last_kind = patomic_kind_UNKN;
+    patomic_fence_t ret = patomic_impl_create_fence_null();
+    patomic_fence_t fence;
+    size_t i;
+
+    /* find first implementation with the best kind */
+    for (i = 0; i < PATOMIC_IMPL_REGISTER_SIZE; ++i)
+    {
+        if( ((unsigned long) patomic_impl_register[i].id & ids) &&
+            ((unsigned int)  patomic_impl_register[i].kind & kinds))
+        {
+            fence = patomic_impl_register[i].fp_create_fence();
+
+            /* thread and signal fences are either both supported or neither is */
+            patomic_assert_always(
+                (fence.fp_thread_fence == NULL) == (fence.fp_signal_fence == NULL)
+            );
+
+            /* only replace previous implementation if current one has a better kind */
+            if (fence.fp_thread_fence != NULL &&
+                (ret.fp_thread_fence == NULL || patomic_impl_register[i].kind > last_kind))
+            {
+                last_kind = patomic_impl_register[i].kind;
+                ret = fence;
+            }
+        }
+    }
+
+    /* return */
+    return ret;
+}
+
+
+patomic_memcpy_t
+patomic_create_memcpy(
+    const unsigned int kinds,
+    const unsigned long ids
+)
+{
+    /* declare variables */
+    patomic_kind_t last_kind = patomic_kind_UNKN;
+    patomic_memcpy_t ret = patomic_impl_create_memcpy_null();
+    patomic_memcpy_t ops;
+    size_t i;
+
+    /* find first implementation with the best kind */
+    for (i = 0; i < PATOMIC_IMPL_REGISTER_SIZE; ++i)
+    {
+        if( ((unsigned long) patomic_impl_register[i].id & ids) &&
+            ((unsigned int)  patomic_impl_register[i].kind & kinds))
+        {
+            ops = patomic_impl_register[i].fp_create_memcpy();
+
+            /* load and store are either both supported or neither is */
+            patomic_assert_always(
+                (ops.fp_load_memcpy == NULL) == (ops.fp_store_memcpy == NULL)
+            );
+
+            /* only replace previous implementation if current one has a better kind */
+            if (ops.fp_load_memcpy != NULL &&
+                (ret.fp_load_memcpy == NULL || patomic_impl_register[i].kind > last_kind))
+            {
+                last_kind = patomic_impl_register[i].kind;
+                ret = ops;
+            }
+        }
+    }
+
+    /* return */
+    return ret;
+}
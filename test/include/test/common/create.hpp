@@ -0,0 +1,76 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#ifndef PATOMIC_TEST_COMMON_CREATE_HPP
+#define PATOMIC_TEST_COMMON_CREATE_HPP
+
+#include <patomic/patomic.h>
+
+#include <cstddef>
+
+// header only, since the common test sources do not link against patomic
+namespace test
+{
+
+
+/// @brief
+///   Creates the best available implicit operations for the given width from
+///   all implementations, with seq_cst memory order.
+inline patomic_t
+create_best(std::size_t width, unsigned int options = 0u) noexcept
+{
+    return patomic_create(
+        width, patomic_SEQ_CST, options,
+        patomic_kinds_ALL, patomic_ids_ALL
+    );
+}
+
+
+/// @brief
+///   Creates the best available implicit operations for objects of type T
+///   from all implementations, with seq_cst memory order.
+template <class T>
+patomic_t
+create_best(unsigned int options = 0u) noexcept
+{
+    return create_best(sizeof(T), options);
+}
+
+
+/// @brief
+///   Creates the best available explicit operations for the given width from
+///   all implementations.
+inline patomic_explicit_t
+create_best_explicit(std::size_t width, unsigned int options = 0u) noexcept
+{
+    return patomic_create_explicit(
+        width, options, patomic_kinds_ALL, patomic_ids_ALL
+    );
+}
+
+
+/// @brief
+///   Creates the best available explicit operations for objects of type T
+///   from all implementations.
+template <class T>
+patomic_explicit_t
+create_best_explicit(unsigned int options = 0u) noexcept
+{
+    return create_best_explicit(sizeof(T), options);
+}
+
+
+/// @brief
+///   Creates the best available atomic memcpy operations from all
+///   implementations.
+inline patomic_memcpy_t
+create_best_memcpy() noexcept
+{
+    return patomic_create_memcpy(patomic_kinds_ALL, patomic_ids_ALL);
+}
+
+
+}  // namespace test
+
+
+#endif  // PATOMIC_TEST_COMMON_CREATE_HPP
@@ -40,6 +40,13 @@ KilledByAbortPredicateType
 KilledByAbort();
 
 
+/// @brief
+///   Update callback for fetch_update operations which always declines to
+///   modify the object.
+int
+decline_update(const void *current, void *desired, void *ctx) noexcept;
+
+
 /// @brief
 ///   Assert that calling the given function pointer with the given params will
 ///   die, but only perform the test if the function pointer is non-null.
@@ -41,7 +41,9 @@ struct ops_types;
 template <>
 struct ops_types<ops_domain::IMPLICIT>
 {
-    static constexpr unsigned int full_opcat = patomic_opcats_IMPLICIT;
+    static constexpr unsigned int full_opcat =
+        patomic_opcats_IMPLICIT | patomic_opcat_WAIT | patomic_opcats_BATCH |
+        patomic_opcats_FLT;
 
     using base_t = patomic_t;
     using ldst_t = patomic_ops_t;
@@ -49,12 +51,17 @@ struct ops_types<ops_domain::IMPLICIT>
     using bitwise_t = patomic_ops_bitwise_t;
     using binary_t = patomic_ops_binary_t;
     using arithmetic_t = patomic_ops_arithmetic_t;
+    using wait_t = patomic_ops_wait_t;
+    using batch_t = patomic_ops_batch_t;
+    using float_t = patomic_ops_float_t;
 };
 
 template <>
 struct ops_types<ops_domain::EXPLICIT>
 {
-    static constexpr unsigned int full_opcat = patomic_opcats_EXPLICIT;
+    static constexpr unsigned int full_opcat =
+        patomic_opcats_EXPLICIT | patomic_opcat_WAIT | patomic_opcats_BATCH |
+        patomic_opcats_FLT;
 
     using base_t = patomic_explicit_t;
     using ldst_t = patomic_ops_explicit_t;
@@ -62,6 +69,9 @@ struct ops_types<ops_domain::EXPLICIT>
     using bitwise_t = patomic_ops_explicit_bitwise_t;
     using binary_t = patomic_ops_explicit_binary_t;
     using arithmetic_t = patomic_ops_explicit_arithmetic_t;
+    using wait_t = patomic_ops_explicit_wait_t;
+    using batch_t = patomic_ops_explicit_batch_t;
+    using float_t = patomic_ops_explicit_float_t;
 };
 
 template <>
@@ -199,7 +209,7 @@ make_ops_xchg_combinations();
 ///   Create an array of members in a patomic_ops*_xchg_t object, with the
 ///   types cast to void(*)().
 template <ops_domain D>
-std::array<void(*)(), 3>
+std::array<void(*)(), 4>
 make_ops_xchg_array(const typename ops_types<D>::xchg_t& xchg) noexcept;
 
 
@@ -273,10 +283,111 @@ make_ops_arithmetic_combinations();
 ///   Create an array of members in a patomic_ops*_arithmetic_t object, with the
 ///   types cast to void(*)().
 template <ops_domain D>
-std::array<void(*)(), 10>
+std::array<void(*)(), 26>
 make_ops_arithmetic_array(const typename ops_types<D>::arithmetic_t& arithmetic) noexcept;
 
 
+/// @brief
+///   Create a set of patomic_ops*_wait_t objects with all combinations of
+///   members set to a provided value. All other members are null.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all<typename ops_types<D>::wait_t>>
+make_ops_wait_combinations(void(*nonnull_value)());
+
+
+/// @brief
+///   Create a set of patomic_ops*_wait_t objects with all combinations of
+///   members set to null and non-null values.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all<typename ops_types<D>::wait_t>>
+make_ops_wait_combinations();
+
+
+/// @brief
+///   Create an array of members in a patomic_ops*_wait_t object, with the
+///   types cast to void(*)().
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::array<void(*)(), 4>
+make_ops_wait_array(const typename ops_types<D>::wait_t& wait) noexcept;
+
+
+/// @brief
+///   Create a set of patomic_ops*_batch_t objects with all combinations of
+///   void and fetch members set to a provided value. All other members are
+///   null.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all_vf<typename ops_types<D>::batch_t>>
+make_ops_batch_combinations(void(*nonnull_value)());
+
+
+/// @brief
+///   Create a set of patomic_ops*_batch_t objects with all combinations of
+///   void and fetch members set to null and non-null values.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all_vf<typename ops_types<D>::batch_t>>
+make_ops_batch_combinations();
+
+
+/// @brief
+///   Create an array of members in a patomic_ops*_batch_t object, with the
+///   types cast to void(*)().
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::array<void(*)(), 14>
+make_ops_batch_array(const typename ops_types<D>::batch_t& batch) noexcept;
+
+
+/// @brief
+///   Create a set of patomic_ops*_float_t objects with all combinations of
+///   void and fetch members set to a provided value. All other members are
+///   null.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all_vf<typename ops_types<D>::float_t>>
+make_ops_float_combinations(void(*nonnull_value)());
+
+
+/// @brief
+///   Create a set of patomic_ops*_float_t objects with all combinations of
+///   void and fetch members set to null and non-null values.
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::vector<ops_any_all_vf<typename ops_types<D>::float_t>>
+make_ops_float_combinations();
+
+
+/// @brief
+///   Create an array of members in a patomic_ops*_float_t object, with the
+///   types cast to void(*)().
+///
+/// @note
+///   Only defined for IMPLICIT and EXPLICIT domains.
+template <ops_domain D>
+std::array<void(*)(), 4>
+make_ops_float_array(const typename ops_types<D>::float_t& float_ops) noexcept;
+
+
 /// @brief
 ///   Create a set of patomic_ops_transaction_special_t objects with all
 ///   combinations of members set to a provided value. All other members are
@@ -295,7 +406,7 @@ make_ops_special_combinations_transaction();
 /// @brief
 ///   Create an array of members in a patomic_ops_transaction_special_t object,
 ///   with the types cast to void(*)().
-std::array<void(*)(), 4>
+std::array<void(*)(), 6>
 make_ops_special_array_transaction(const patomic_ops_transaction_special_t& special) noexcept;
 
 
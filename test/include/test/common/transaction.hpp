@@ -433,6 +433,8 @@ DECL_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_double_cmpxchg_t);
 DECL_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_multi_cmpxchg_t);
 DECL_OVERLOAD_CALL_PATOMIC_OP(patomic_opsig_transaction_generic_t);
 DECL_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_generic_wfb_t);
+DECL_OVERLOAD_CALL_PATOMIC_OP(patomic_opsig_transaction_multi_load_t);
+DECL_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_multi_op_t);
 
 
 }  // namespace _detail
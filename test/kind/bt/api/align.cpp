@@ -66,6 +66,46 @@ TEST_F(BtApiAlign, max_cache_line_size_fn_cmp_le_unstable_macro)
     EXPECT_LE(fnval, macro_unstable);
 }
 
+/// @brief Return value of patomic_cache_line_size() is the same on every
+///        call.
+TEST_F(BtApiAlign, max_cache_line_size_fn_is_stable)
+{
+    // setup
+    const auto fnval = patomic_cache_line_size();
+
+    // test
+    EXPECT_EQ(fnval, patomic_cache_line_size());
+}
+
+/// @brief Return value of patomic_destructive_interference_size() is a
+///        positive power of 2 which compares less than or equal to
+///        PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE, and greater than or equal
+///        to patomic_cache_line_size().
+TEST_F(BtApiAlign, destructive_interference_size_is_pow2_in_range)
+{
+    // setup
+    constexpr auto macro_unstable = PATOMIC_MAX_CACHE_LINE_SIZE_ABI_UNSTABLE;
+    const auto fnval = patomic_destructive_interference_size();
+
+    // test
+    EXPECT_TRUE(test::is_positive_pow2(fnval));
+    EXPECT_LE(fnval, macro_unstable);
+    EXPECT_GE(fnval, patomic_cache_line_size());
+}
+
+/// @brief Return value of patomic_constructive_interference_size() is a
+///        positive power of 2 which compares less than or equal to
+///        patomic_destructive_interference_size().
+TEST_F(BtApiAlign, constructive_interference_size_is_pow2_le_destructive)
+{
+    // setup
+    const auto fnval = patomic_constructive_interference_size();
+
+    // test
+    EXPECT_TRUE(test::is_positive_pow2(fnval));
+    EXPECT_LE(fnval, patomic_destructive_interference_size());
+}
+
 
 /// @brief The check patomic_align_meets_recommended(...) fails when
 ///        "recommended" is zero.
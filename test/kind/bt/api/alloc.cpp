@@ -0,0 +1,130 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+/// @brief Test fixture.
+class BtApiAlloc : public testing::Test
+{
+public:
+    static patomic_align_t
+    make_align(std::size_t recommended) noexcept
+    {
+        patomic_align_t align {};
+        align.recommended = recommended;
+        align.minimum = recommended;
+        align.size_within = 0;
+        return align;
+    }
+
+    static bool
+    is_aligned(const void *ptr, std::size_t alignment) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+    }
+};
+
+
+/// @brief The default stride is the width rounded up to the recommended
+///        alignment, or to the destructive interference size when isolated.
+TEST_F(BtApiAlloc, stride_rounds_up_width)
+{
+    // setup
+    const std::size_t line = patomic_destructive_interference_size();
+    constexpr auto isolate = static_cast<unsigned int>(patomic_alloc_ISOLATE);
+
+    // test
+    EXPECT_EQ(8u, patomic_alloc_stride(make_align(8), 8u, 0u));
+    EXPECT_EQ(16u, patomic_alloc_stride(make_align(8), 12u, 0u));
+    EXPECT_EQ(4u, patomic_alloc_stride(make_align(1), 4u, 0u));
+    EXPECT_EQ(line, patomic_alloc_stride(make_align(8), 8u, isolate));
+    EXPECT_EQ(0u, patomic_alloc_stride(make_align(8), 0u, 0u));
+    EXPECT_EQ(0u, patomic_alloc_stride(make_align(3), 8u, 0u));
+}
+
+/// @brief Single objects meet the recommended alignment, and isolated objects
+///        are aligned to the destructive interference size.
+TEST_F(BtApiAlloc, alloc_meets_alignment)
+{
+    // setup
+    const std::size_t line = patomic_destructive_interference_size();
+    constexpr auto isolate = static_cast<unsigned int>(patomic_alloc_ISOLATE);
+
+    // test
+    for (std::size_t alignment : { 1u, 2u, 4u, 8u, 16u, 64u, 256u })
+    {
+        void *const ptr = patomic_alloc(make_align(alignment), 8u, 0u);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_TRUE(is_aligned(ptr, alignment));
+        std::memset(ptr, 0xA5, 8u);
+        patomic_free(ptr);
+    }
+    void *const ptr = patomic_alloc(make_align(4), 4u, isolate);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_TRUE(is_aligned(ptr, line));
+    std::memset(ptr, 0xA5, line);
+    patomic_free(ptr);
+}
+
+/// @brief Array objects are each aligned with the chosen stride, and the whole
+///        array is writable.
+TEST_F(BtApiAlloc, alloc_array_uses_stride)
+{
+    // setup
+    constexpr std::size_t count = 100;
+    constexpr std::size_t stride = 32;
+
+    // test
+    auto *const ptr = static_cast<unsigned char *>(
+        patomic_alloc_array(make_align(16), 8u, count, stride, 0u)
+    );
+    ASSERT_NE(nullptr, ptr);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_TRUE(is_aligned(ptr + (i * stride), 16u));
+    }
+    std::memset(ptr, 0xA5, count * stride);
+    patomic_free(ptr);
+}
+
+/// @brief Huge page backing is only a hint, so large allocations succeed and
+///        meet their alignment whether or not it is supported.
+TEST_F(BtApiAlloc, alloc_array_huge_pages_is_hint)
+{
+    // setup
+    constexpr std::size_t count = 1024u * 1024u;
+    constexpr auto huge = static_cast<unsigned int>(patomic_alloc_HUGE_PAGES);
+
+    // test
+    auto *const ptr = static_cast<unsigned char *>(
+        patomic_alloc_array(make_align(8), 8u, count, 0u, huge)
+    );
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_TRUE(is_aligned(ptr, 8u));
+    ptr[0] = 1;
+    ptr[(count * 8u) - 1u] = 1;
+    patomic_free(ptr);
+}
+
+/// @brief Invalid parameters return NULL, and freeing NULL has no effect.
+TEST_F(BtApiAlloc, invalid_params_return_null)
+{
+    // test
+    EXPECT_EQ(nullptr, patomic_alloc(make_align(8), 0u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc(make_align(0), 8u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc(make_align(6), 8u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc_array(make_align(8), 8u, 0u, 0u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc_array(make_align(8), 8u, 4u, 4u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc_array(make_align(8), 8u, 4u, 12u, 0u));
+    EXPECT_EQ(nullptr, patomic_alloc_array(
+        make_align(8), 8u, static_cast<std::size_t>(-1), 0u, 0u
+    ));
+    patomic_free(nullptr);
+}
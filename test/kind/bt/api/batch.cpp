@@ -0,0 +1,267 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+/// @brief Test fixture.
+class BtApiBatch : public testing::Test
+{
+public:
+    static constexpr std::size_t count = 20;
+
+    template <class T>
+    static void
+    array_ops_round_trip(const patomic_ops_batch_t& batch_ops)
+    {
+        // setup
+        // first element of array is not vector aligned
+        alignas(64) std::array<T, 2 + array_count> objs_array {};
+        std::array<T, array_count> desireds {};
+        std::array<T, array_count> rets {};
+        for (std::size_t i = 0; i < array_count; ++i)
+        {
+            desireds[i] = static_cast<T>(3u * i + 1u);
+        }
+        T *const objs_begin = &objs_array[1];
+        ASSERT_NE(nullptr, batch_ops.fp_store_array);
+        ASSERT_NE(nullptr, batch_ops.fp_load_array);
+
+        // test
+        batch_ops.fp_store_array(objs_begin, desireds.data(), array_count);
+        batch_ops.fp_load_array(objs_begin, rets.data(), array_count);
+        EXPECT_EQ(desireds, rets);
+        EXPECT_EQ(0u, objs_array.front());
+        EXPECT_EQ(0u, objs_array.back());
+    }
+
+    static constexpr std::size_t array_count = 67;
+
+    std::array<std::uint32_t, count> objs_values {};
+    std::array<volatile void *, count> objs {};
+
+    void
+    SetUp() override
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            objs_values[i] = static_cast<std::uint32_t>(i);
+            objs[i] = &objs_values[i];
+        }
+    }
+};
+
+
+/// @brief The BATCH_V and BATCH_F ops are each either all null or all non-null.
+TEST_F(BtApiBatch, batch_ops_are_all_or_nothing)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    const patomic_explicit_t pat_explicit = test::create_best_explicit<std::uint32_t>();
+
+    // test
+    for (const unsigned int opcat : { patomic_opcat_BATCH_V, patomic_opcat_BATCH_F })
+    {
+        EXPECT_EQ(patomic_feature_check_any(&pat.ops, opcat),
+                  patomic_feature_check_all(&pat.ops, opcat));
+        EXPECT_EQ(patomic_feature_check_any_explicit(&pat_explicit.ops, opcat),
+                  patomic_feature_check_all_explicit(&pat_explicit.ops, opcat));
+    }
+}
+
+/// @brief A batch operation with a count of zero does not access any of its
+///        pointer arguments.
+TEST_F(BtApiBatch, batch_count_zero_is_noop)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    const auto& batch_ops = pat.ops.batch_ops;
+    if (batch_ops.fp_add_n == nullptr || batch_ops.fp_cmpxchg_n == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; batch ops are not supported";
+    }
+
+    // test
+    batch_ops.fp_add_n(nullptr, nullptr, 0u);
+    batch_ops.fp_fetch_add_n(nullptr, nullptr, nullptr, 0u);
+    EXPECT_EQ(0u, batch_ops.fp_cmpxchg_n(nullptr, nullptr, nullptr, 0u));
+}
+
+/// @brief Batch fetch_add adds each argument to its object and returns each
+///        object's original value.
+TEST_F(BtApiBatch, batch_fetch_add_n_is_applied_to_each_object)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    const auto& batch_ops = pat.ops.batch_ops;
+    if (batch_ops.fp_fetch_add_n == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; batch ops are not supported";
+    }
+    std::array<std::uint32_t, count> args {};
+    std::array<std::uint32_t, count> rets {};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args[i] = static_cast<std::uint32_t>(100u * i);
+    }
+
+    // test
+    batch_ops.fp_fetch_add_n(objs.data(), args.data(), rets.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(static_cast<std::uint32_t>(i), rets[i]);
+        EXPECT_EQ(static_cast<std::uint32_t>(101u * i), objs_values[i]);
+    }
+}
+
+/// @brief Batch or applies each argument to its object, and the same object
+///        may appear more than once in a batch.
+TEST_F(BtApiBatch, batch_or_n_is_applied_to_each_object)
+{
+    // setup
+    const patomic_explicit_t pat = test::create_best_explicit<std::uint32_t>();
+    const auto& batch_ops = pat.ops.batch_ops;
+    if (batch_ops.fp_or_n == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; batch ops are not supported";
+    }
+    objs[1] = objs[0];
+    std::array<std::uint32_t, count> args {};
+    args.fill(0x100u);
+    args[1] = 0x200u;
+
+    // test
+    batch_ops.fp_or_n(objs.data(), args.data(), patomic_RELAXED, count);
+    EXPECT_EQ(0x300u, objs_values[0]);
+    EXPECT_EQ(1u, objs_values[1]);
+    for (std::size_t i = 2; i < count; ++i)
+    {
+        EXPECT_EQ(static_cast<std::uint32_t>(0x100u | i), objs_values[i]);
+    }
+}
+
+/// @brief Batch cmpxchg only modifies objects whose value matches the
+///        expected value, updates the expected value of those which do not,
+///        and returns the number of successful exchanges.
+TEST_F(BtApiBatch, batch_cmpxchg_n_reports_successes)
+{
+    // setup
+    const patomic_explicit_t pat = test::create_best_explicit<std::uint32_t>();
+    const auto& batch_ops = pat.ops.batch_ops;
+    if (batch_ops.fp_cmpxchg_n == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; batch ops are not supported";
+    }
+    std::array<std::uint32_t, count> exps {};
+    std::array<std::uint32_t, count> dess {};
+    std::size_t expected_successes = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // every third exchange fails
+        const bool succeeds = (i % 3u) != 0;
+        exps[i] = static_cast<std::uint32_t>(succeeds ? i : i + 1u);
+        dess[i] = static_cast<std::uint32_t>(1000u + i);
+        expected_successes += succeeds ? 1u : 0u;
+    }
+
+    // test
+    const std::size_t successes = batch_ops.fp_cmpxchg_n(
+        objs.data(), exps.data(), dess.data(),
+        patomic_ACQ_REL, patomic_ACQUIRE, count
+    );
+    EXPECT_EQ(expected_successes, successes);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const bool succeeds = (i % 3u) != 0;
+        const auto expected_value = static_cast<std::uint32_t>(
+            succeeds ? 1000u + i : i
+        );
+        EXPECT_EQ(expected_value, objs_values[i]);
+        EXPECT_EQ(static_cast<std::uint32_t>(i), exps[i]);
+    }
+}
+
+/// @brief Bulk loads read back the values written by bulk stores, for arrays
+///        which do not start on a vector boundary, with relaxed ordering.
+TEST_F(BtApiBatch, array_ops_round_trip_relaxed)
+{
+    // setup
+    const auto create_relaxed = [](std::size_t width) noexcept {
+        return patomic_create(
+            width, patomic_RELAXED, 0u, patomic_kinds_ALL, patomic_ids_ALL
+        );
+    };
+    const patomic_t pat_8 = create_relaxed(sizeof(std::uint8_t));
+    const patomic_t pat_16 = create_relaxed(sizeof(std::uint16_t));
+    const patomic_t pat_32 = create_relaxed(sizeof(std::uint32_t));
+    const patomic_t pat_64 = create_relaxed(sizeof(std::uint64_t));
+    for (const patomic_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.batch_ops.fp_store_array == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; array ops are not supported";
+        }
+    }
+
+    // test
+    array_ops_round_trip<std::uint8_t>(pat_8.ops.batch_ops);
+    array_ops_round_trip<std::uint16_t>(pat_16.ops.batch_ops);
+    array_ops_round_trip<std::uint32_t>(pat_32.ops.batch_ops);
+    array_ops_round_trip<std::uint64_t>(pat_64.ops.batch_ops);
+}
+
+/// @brief Bulk loads read back the values written by bulk stores with
+///        sequentially consistent ordering.
+TEST_F(BtApiBatch, array_ops_round_trip_seq_cst)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    if (pat.ops.batch_ops.fp_store_array == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; array ops are not supported";
+    }
+
+    // test
+    array_ops_round_trip<std::uint32_t>(pat.ops.batch_ops);
+}
+
+/// @brief Explicit bulk loads read back the values written by explicit bulk
+///        stores, and an array op with a count of zero does not access any of
+///        its pointer arguments.
+TEST_F(BtApiBatch, explicit_array_ops_round_trip)
+{
+    // setup
+    const patomic_explicit_t pat = test::create_best_explicit<std::uint32_t>();
+    const auto& batch_ops = pat.ops.batch_ops;
+    if (batch_ops.fp_store_array == nullptr ||
+        batch_ops.fp_load_array == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; array ops are not supported";
+    }
+    std::array<std::uint32_t, count> desireds {};
+    std::array<std::uint32_t, count> rets {};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        desireds[i] = static_cast<std::uint32_t>(0x10000u + i);
+    }
+
+    // test
+    batch_ops.fp_store_array(nullptr, nullptr, patomic_RELAXED, 0u);
+    batch_ops.fp_load_array(nullptr, patomic_RELAXED, nullptr, 0u);
+    batch_ops.fp_store_array(
+        objs_values.data(), desireds.data(), patomic_RELAXED, count
+    );
+    batch_ops.fp_load_array(
+        objs_values.data(), patomic_ACQUIRE, rets.data(), count
+    );
+    EXPECT_EQ(desireds, objs_values);
+    EXPECT_EQ(desireds, rets);
+}
@@ -12,6 +12,7 @@
 #include <array>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 
 /// @brief Templated test fixture.
@@ -427,6 +428,211 @@ TYPED_TEST(BtApiCombineT, combine_all_bitwise_combinations_correct_result)
     }}}
 }
 
+/// @brief Calling combine with all combinations of WAIT ops set in both
+///        operands, with all combinations of alignment (stronger, equal,
+///        weaker), copies over the correct ops and adjusts the alignment
+///        correctly. Non-null ops compare unequal.
+TYPED_TEST(BtApiCombineT, combine_all_wait_combinations_correct_result)
+{
+    // setup
+    constexpr test::ops_domain D = TestFixture::domain;
+    using OpsT = typename TestFixture::OpsTypes::ldst_t;
+    using BaseT = typename TestFixture::OpsTypes::base_t;
+
+    for (const auto& wait_from : test::make_ops_wait_combinations<D>(&fn_a))
+    {
+    for (const auto& wait_to : test::make_ops_wait_combinations<D>(&fn_b))
+    {
+    for (const auto align_from : aligns)
+    {
+        // patomic_ops*_t objects
+        OpsT ops_to {};
+        ops_to.wait_ops = wait_to.ops;
+        OpsT ops_from {};
+        ops_from.wait_ops = wait_from.ops;
+        // patomic*_t objects
+        BaseT combined { ops_to, normal_align };
+        const BaseT copied_to = combined;
+        const BaseT copied_from { ops_from, align_from };
+        // arrays of relevant ops
+        const auto arr_to = test::make_ops_wait_array<D>(copied_to.ops.wait_ops);
+        const auto arr_from = test::make_ops_wait_array<D>(copied_from.ops.wait_ops);
+
+        // do combine
+        TTestHelper::combine(combined, copied_from);
+        const auto arr_combined = test::make_ops_wait_array<D>(combined.ops.wait_ops);
+
+        // go through result
+        bool any_ops_copied = false;
+        for (std::size_t i = 0; i < arr_to.size(); ++i)
+        {
+            // test
+            if (arr_to[i] == nullptr && arr_from[i] != nullptr)
+            {
+                // if "to" is null, then we took "from"'s value
+                EXPECT_EQ(arr_combined[i], arr_from[i]);
+                any_ops_copied = true;
+            }
+            else
+            {
+                // if "to" is not null, then it didn't change
+                EXPECT_EQ(arr_combined[i], arr_to[i]);
+            }
+        }
+
+        // check alignment is copied correctly
+        if (any_ops_copied)
+        {
+            const auto combined_align =
+                combine_align(copied_to.align, copied_from.align);
+            EXPECT_EQ(combined.align, combined_align);
+        }
+        else
+        {
+            EXPECT_EQ(combined.align, copied_to.align);
+        }
+    }}}
+}
+
+/// @brief Calling combine with all combinations of BATCH ops set in the "from"
+///        operand and a selection of combinations set in the "to" operand
+///        (the full cross product is too large), with all combinations of
+///        alignment (stronger, equal, weaker), copies over the correct ops and
+///        adjusts the alignment correctly. Non-null ops compare unequal.
+TYPED_TEST(BtApiCombineT, combine_all_batch_combinations_correct_result)
+{
+    // setup
+    constexpr test::ops_domain D = TestFixture::domain;
+    using OpsT = typename TestFixture::OpsTypes::ldst_t;
+    using BaseT = typename TestFixture::OpsTypes::base_t;
+    const auto batch_to_all = test::make_ops_batch_combinations<D>(&fn_b);
+    const std::vector<typename TestFixture::OpsTypes::batch_t> batch_to_ops {
+        batch_to_all.front().ops,
+        batch_to_all[batch_to_all.size() / 3].ops,
+        batch_to_all.back().ops
+    };
+
+    for (const auto& batch_from : test::make_ops_batch_combinations<D>(&fn_a))
+    {
+    for (const auto& batch_to : batch_to_ops)
+    {
+    for (const auto align_from : aligns)
+    {
+        // patomic_ops*_t objects
+        OpsT ops_to {};
+        ops_to.batch_ops = batch_to;
+        OpsT ops_from {};
+        ops_from.batch_ops = batch_from.ops;
+        // patomic*_t objects
+        BaseT combined { ops_to, normal_align };
+        const BaseT copied_to = combined;
+        const BaseT copied_from { ops_from, align_from };
+        // arrays of relevant ops
+        const auto arr_to = test::make_ops_batch_array<D>(copied_to.ops.batch_ops);
+        const auto arr_from = test::make_ops_batch_array<D>(copied_from.ops.batch_ops);
+
+        // do combine
+        TTestHelper::combine(combined, copied_from);
+        const auto arr_combined = test::make_ops_batch_array<D>(combined.ops.batch_ops);
+
+        // go through result
+        bool any_ops_copied = false;
+        for (std::size_t i = 0; i < arr_to.size(); ++i)
+        {
+            // test
+            if (arr_to[i] == nullptr && arr_from[i] != nullptr)
+            {
+                // if "to" is null, then we took "from"'s value
+                EXPECT_EQ(arr_combined[i], arr_from[i]);
+                any_ops_copied = true;
+            }
+            else
+            {
+                // if "to" is not null, then it didn't change
+                EXPECT_EQ(arr_combined[i], arr_to[i]);
+            }
+        }
+
+        // check alignment is copied correctly
+        if (any_ops_copied)
+        {
+            const auto combined_align =
+                combine_align(copied_to.align, copied_from.align);
+            EXPECT_EQ(combined.align, combined_align);
+        }
+        else
+        {
+            EXPECT_EQ(combined.align, copied_to.align);
+        }
+    }}}
+}
+
+/// @brief Calling combine with all combinations of FLT ops set in both
+///        operands, with all combinations of alignment (stronger, equal,
+///        weaker), copies over the correct ops and adjusts the alignment
+///        correctly. Non-null ops compare unequal.
+TYPED_TEST(BtApiCombineT, combine_all_float_combinations_correct_result)
+{
+    // setup
+    constexpr test::ops_domain D = TestFixture::domain;
+    using OpsT = typename TestFixture::OpsTypes::ldst_t;
+    using BaseT = typename TestFixture::OpsTypes::base_t;
+
+    for (const auto& float_from : test::make_ops_float_combinations<D>(&fn_a))
+    {
+    for (const auto& float_to : test::make_ops_float_combinations<D>(&fn_b))
+    {
+    for (const auto align_from : aligns)
+    {
+        // patomic_ops*_t objects
+        OpsT ops_to {};
+        ops_to.float_ops = float_to.ops;
+        OpsT ops_from {};
+        ops_from.float_ops = float_from.ops;
+        // patomic*_t objects
+        BaseT combined { ops_to, normal_align };
+        const BaseT copied_to = combined;
+        const BaseT copied_from { ops_from, align_from };
+        // arrays of relevant ops
+        const auto arr_to = test::make_ops_float_array<D>(copied_to.ops.float_ops);
+        const auto arr_from = test::make_ops_float_array<D>(copied_from.ops.float_ops);
+
+        // do combine
+        TTestHelper::combine(combined, copied_from);
+        const auto arr_combined = test::make_ops_float_array<D>(combined.ops.float_ops);
+
+        // go through result
+        bool any_ops_copied = false;
+        for (std::size_t i = 0; i < arr_to.size(); ++i)
+        {
+            // test
+            if (arr_to[i] == nullptr && arr_from[i] != nullptr)
+            {
+                // if "to" is null, then we took "from"'s value
+                EXPECT_EQ(arr_combined[i], arr_from[i]);
+                any_ops_copied = true;
+            }
+            else
+            {
+                // if "to" is not null, then it didn't change
+                EXPECT_EQ(arr_combined[i], arr_to[i]);
+            }
+        }
+
+        // check alignment is copied correctly
+        if (any_ops_copied)
+        {
+            const auto combined_align =
+                combine_align(copied_to.align, copied_from.align);
+            EXPECT_EQ(combined.align, combined_align);
+        }
+        else
+        {
+            EXPECT_EQ(combined.align, copied_to.align);
+        }
+    }}}
+}
+
 /// @brief Calling combine with all combinations of BIN ops set in both
 ///        operands, with all combinations of alignment (stronger, equal,
 ///        weaker), copies over the correct ops and adjusts the alignment
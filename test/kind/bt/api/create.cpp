@@ -0,0 +1,117 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <gtest/gtest.h>
+
+
+/// @brief Test fixture.
+class BtApiCreate : public testing::Test
+{
+public:
+    static patomic_t
+    create(unsigned int opcats, unsigned int opkinds) noexcept
+    {
+        return patomic_create_masked(
+            sizeof(int), patomic_SEQ_CST, 0u,
+            patomic_kinds_ALL, patomic_ids_ALL, opcats, opkinds
+        );
+    }
+
+    static patomic_explicit_t
+    create_explicit(unsigned int opcats, unsigned int opkinds) noexcept
+    {
+        return patomic_create_explicit_masked(
+            sizeof(int), 0u, patomic_kinds_ALL, patomic_ids_ALL,
+            opcats, opkinds
+        );
+    }
+};
+
+
+/// @brief Requesting every opcat and opkind provides the same operations and
+///        alignment as the unmasked create functions.
+TEST_F(BtApiCreate, masked_with_all_matches_unmasked)
+{
+    // setup
+    const patomic_t full = patomic_create(
+        sizeof(int), patomic_SEQ_CST, 0u, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    const patomic_explicit_t full_explicit = patomic_create_explicit(
+        sizeof(int), 0u, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    const patomic_t masked = create(~0u, ~0u);
+    const patomic_explicit_t masked_explicit = create_explicit(~0u, ~0u);
+    const unsigned int opcats = patomic_opcats_IMPLICIT;
+
+    // test
+    EXPECT_EQ(patomic_feature_check_all(&full.ops, opcats),
+              patomic_feature_check_all(&masked.ops, opcats));
+    EXPECT_EQ(patomic_feature_check_any(&full.ops, opcats),
+              patomic_feature_check_any(&masked.ops, opcats));
+    EXPECT_EQ(full.align.recommended, masked.align.recommended);
+    EXPECT_EQ(full.align.minimum, masked.align.minimum);
+    EXPECT_EQ(patomic_feature_check_all_explicit(&full_explicit.ops, opcats),
+              patomic_feature_check_all_explicit(&masked_explicit.ops, opcats));
+    EXPECT_EQ(patomic_feature_check_any_explicit(&full_explicit.ops, opcats),
+              patomic_feature_check_any_explicit(&masked_explicit.ops, opcats));
+    EXPECT_EQ(full_explicit.align.recommended, masked_explicit.align.recommended);
+    EXPECT_EQ(full_explicit.align.minimum, masked_explicit.align.minimum);
+}
+
+/// @brief Operations outside the requested opcats and opkinds are NULL, and
+///        requested operations are provided whenever they are supported.
+TEST_F(BtApiCreate, masked_only_provides_requested_ops)
+{
+    // setup
+    const patomic_t full = create(~0u, ~0u);
+    const patomic_explicit_t full_explicit = create_explicit(~0u, ~0u);
+    const auto opcat = static_cast<unsigned int>(patomic_opcat_ARI_F);
+    const auto opkind = static_cast<unsigned int>(patomic_opkind_ADD);
+    const unsigned int others = patomic_opcats_IMPLICIT & ~opcat;
+    const patomic_t masked = create(opcat, opkind);
+    const patomic_explicit_t masked_explicit = create_explicit(opcat, opkind);
+
+    // test
+    EXPECT_EQ(others, patomic_feature_check_any(&masked.ops, others));
+    EXPECT_EQ(others, patomic_feature_check_any_explicit(&masked_explicit.ops, others));
+    EXPECT_EQ(full.ops.arithmetic_ops.fp_fetch_add == nullptr,
+              masked.ops.arithmetic_ops.fp_fetch_add == nullptr);
+    EXPECT_EQ(nullptr, masked.ops.arithmetic_ops.fp_fetch_sub);
+    EXPECT_EQ(full_explicit.ops.arithmetic_ops.fp_fetch_add == nullptr,
+              masked_explicit.ops.arithmetic_ops.fp_fetch_add == nullptr);
+    EXPECT_EQ(nullptr, masked_explicit.ops.arithmetic_ops.fp_fetch_sub);
+}
+
+/// @brief Alignment requirements from a masked create are never stricter than
+///        those from an unmasked create.
+TEST_F(BtApiCreate, masked_alignment_is_not_stricter)
+{
+    // setup
+    const patomic_t full = create(~0u, ~0u);
+    const patomic_explicit_t full_explicit = create_explicit(~0u, ~0u);
+    const auto opcat = static_cast<unsigned int>(patomic_opcat_LDST);
+    const auto opkinds = static_cast<unsigned int>(patomic_opkinds_LDST);
+    const patomic_t masked = create(opcat, opkinds);
+    const patomic_explicit_t masked_explicit = create_explicit(opcat, opkinds);
+
+    // test
+    EXPECT_LE(masked.align.recommended, full.align.recommended);
+    EXPECT_LE(masked.align.minimum, full.align.minimum);
+    EXPECT_LE(masked_explicit.align.recommended, full_explicit.align.recommended);
+    EXPECT_LE(masked_explicit.align.minimum, full_explicit.align.minimum);
+}
+
+/// @brief Requesting no opcats provides no operations.
+TEST_F(BtApiCreate, masked_with_none_provides_no_ops)
+{
+    // setup
+    const patomic_t masked = create(0u, ~0u);
+    const patomic_explicit_t masked_explicit = create_explicit(0u, ~0u);
+    const unsigned int opcats = patomic_opcats_IMPLICIT;
+
+    // test
+    EXPECT_EQ(opcats, patomic_feature_check_any(&masked.ops, opcats));
+    EXPECT_EQ(opcats, patomic_feature_check_any_explicit(&masked_explicit.ops, opcats));
+}
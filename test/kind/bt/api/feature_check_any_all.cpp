@@ -153,6 +153,8 @@ TEST_F(BtApiFeatureCheckAnyAll, all_opcats_have_expected_bits)
     // values
     constexpr auto expected_bin = patomic_opcat_BIN_V | patomic_opcat_BIN_F;
     constexpr auto expected_ari = patomic_opcat_ARI_V | patomic_opcat_ARI_F;
+    constexpr auto expected_batch = patomic_opcat_BATCH_V | patomic_opcat_BATCH_F;
+    constexpr auto expected_flt = patomic_opcat_FLT_V | patomic_opcat_FLT_F;
     constexpr auto expected_implicit =
         patomic_opcat_LDST |
         patomic_opcat_XCHG |
@@ -169,6 +171,8 @@ TEST_F(BtApiFeatureCheckAnyAll, all_opcats_have_expected_bits)
     const std::vector<int> expected_vec {
         expected_bin,
         expected_ari,
+        expected_batch,
+        expected_flt,
         expected_implicit,
         expected_explicit,
         expected_transaction
@@ -187,6 +191,8 @@ TEST_F(BtApiFeatureCheckAnyAll, all_opcats_have_expected_bits)
     // checks that each value is assigned the correct variable
     EXPECT_EQ(patomic_opcats_BIN, expected_bin);
     EXPECT_EQ(patomic_opcats_ARI, expected_ari);
+    EXPECT_EQ(patomic_opcats_BATCH, expected_batch);
+    EXPECT_EQ(patomic_opcats_FLT, expected_flt);
     EXPECT_EQ(patomic_opcats_IMPLICIT, expected_implicit);
     EXPECT_EQ(patomic_opcats_EXPLICIT, expected_explicit);
     EXPECT_EQ(patomic_opcats_TRANSACTION, expected_transaction);
@@ -233,6 +239,44 @@ TEST_F(BtApiFeatureCheckAnyAll, opcats_implicit_explicit_subset_of_transaction)
     EXPECT_EQ(masked_explicit, patomic_opcats_EXPLICIT);
 }
 
+/// @brief The bit patomic_opcat_WAIT is not set in any "opcats" opcats.
+TEST_F(BtApiFeatureCheckAnyAll, opcat_wait_not_in_any_opcats)
+{
+    // test
+    for (const unsigned int opcats : test::make_opcats_all_combined())
+    {
+        EXPECT_EQ(0u, opcats & patomic_opcat_WAIT);
+    }
+}
+
+/// @brief The bits in patomic_opcats_BATCH are not set in any other "opcats"
+///        opcats.
+TEST_F(BtApiFeatureCheckAnyAll, opcats_batch_not_in_any_other_opcats)
+{
+    // test
+    for (const unsigned int opcats : test::make_opcats_all_combined())
+    {
+        if (opcats != patomic_opcats_BATCH)
+        {
+            EXPECT_EQ(0u, opcats & patomic_opcats_BATCH);
+        }
+    }
+}
+
+/// @brief The bits in patomic_opcats_FLT are not set in any other "opcats"
+///        opcats.
+TEST_F(BtApiFeatureCheckAnyAll, opcats_flt_not_in_any_other_opcats)
+{
+    // test
+    for (const unsigned int opcats : test::make_opcats_all_combined())
+    {
+        if (opcats != patomic_opcats_FLT)
+        {
+            EXPECT_EQ(0u, opcats & patomic_opcats_FLT);
+        }
+    }
+}
+
 /// @brief Calling check_any with zero opcat bits returns zero.
 TYPED_TEST(BtApiFeatureCheckAnyAllT, check_any_zero_bits_returns_zero)
 {
@@ -638,3 +682,271 @@ TEST_F(BtApiFeatureCheckAnyAll, check_all_raw_bits_match_expected)
         EXPECT_EQ(expected_result, actual_result);
     }
 }
+
+/// @brief Calling check_any with all combinations of WAIT function pointers
+///        set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_wait_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats = wait.any ? patomic_opcat_WAIT : 0;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of WAIT function pointers
+///        set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_wait_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats = wait.all ? patomic_opcat_WAIT : 0;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_any with all combinations of WAIT function pointers
+///        set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_wait_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats = wait.any ? patomic_opcat_WAIT : 0;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of WAIT function pointers
+///        set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_wait_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats = wait.all ? patomic_opcat_WAIT : 0;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_any with all combinations of BATCH(_V/F) function
+///        pointers set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_batch_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (batch.any_void ? patomic_opcat_BATCH_V : 0) |
+            (batch.any_fetch ? patomic_opcat_BATCH_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of BATCH(_V/F) function
+///        pointers set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_batch_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (batch.all_void ? patomic_opcat_BATCH_V : 0) |
+            (batch.all_fetch ? patomic_opcat_BATCH_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_any with all combinations of BATCH(_V/F) function
+///        pointers set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_batch_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (batch.any_void ? patomic_opcat_BATCH_V : 0) |
+            (batch.any_fetch ? patomic_opcat_BATCH_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of BATCH(_V/F) function
+///        pointers set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_batch_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (batch.all_void ? patomic_opcat_BATCH_V : 0) |
+            (batch.all_fetch ? patomic_opcat_BATCH_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_any with all combinations of FLT(_V/F) function
+///        pointers set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_float_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (flt.any_void ? patomic_opcat_FLT_V : 0) |
+            (flt.any_fetch ? patomic_opcat_FLT_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of FLT(_V/F) function
+///        pointers set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_float_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (flt.all_void ? patomic_opcat_FLT_V : 0) |
+            (flt.all_fetch ? patomic_opcat_FLT_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_any with all combinations of FLT(_V/F) function
+///        pointers set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_any_float_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (flt.any_void ? patomic_opcat_FLT_V : 0) |
+            (flt.any_fetch ? patomic_opcat_FLT_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_any(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_all with all combinations of FLT(_V/F) function
+///        pointers set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckAnyAll, check_all_float_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opcats = ~0;
+        const unsigned int set_opcats =
+            (flt.all_void ? patomic_opcat_FLT_V : 0) |
+            (flt.all_fetch ? patomic_opcat_FLT_F : 0);
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opcats);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_all(ops, input_opcats);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
@@ -0,0 +1,266 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/api/feature_check.h>
+
+#include <test/common/death.hpp>
+#include <test/common/make_ops.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+
+/// @brief Templated test fixture.
+template <class T>
+class BtApiFeatureCheckCapsT : public testing::Test
+{
+public:
+    static constexpr test::ops_domain domain = T::value;
+    using OpsTypes = test::ops_types<domain>;
+};
+
+/// @brief Templated test fixture for death tests.
+template <class T>
+class BtApiFeatureCheckCapsT_DeathTest : public testing::Test
+{
+public:
+    static constexpr test::ops_domain domain = T::value;
+    using OpsTypes = test::ops_types<domain>;
+};
+
+using BtApiFeatureCheckCapsT_Types = ::testing::Types<
+    std::integral_constant<test::ops_domain, test::ops_domain::IMPLICIT>,
+    std::integral_constant<test::ops_domain, test::ops_domain::EXPLICIT>,
+    std::integral_constant<test::ops_domain, test::ops_domain::TRANSACTION>
+>;
+
+namespace
+{
+
+/// @brief Helper type for templated test fixture.
+class TTestHelper
+{
+public:
+    template <class T>
+    static std::string
+    GetName(int)
+    {
+        auto name = test::to_string(T::value);
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) noexcept -> char {
+            return static_cast<char>(std::tolower(c));
+        });
+        return name;
+    }
+
+    static patomic_feature_caps_abi_unstable_t
+    caps(const patomic_ops_t& ops) noexcept
+    {
+        return patomic_feature_caps(&ops);
+    }
+
+    static patomic_feature_caps_abi_unstable_t
+    caps(const patomic_ops_explicit_t& ops) noexcept
+    {
+        return patomic_feature_caps_explicit(&ops);
+    }
+
+    static patomic_feature_caps_abi_unstable_t
+    caps(const patomic_ops_transaction_t& ops) noexcept
+    {
+        return patomic_feature_caps_transaction(&ops);
+    }
+
+    /// @brief Check that every caps check matches the direct feature check.
+    template <class Ops>
+    static void
+    expect_caps_match(const Ops& ops)
+    {
+        const patomic_feature_caps_abi_unstable_t caps = TTestHelper::caps(ops);
+        for (const patomic_opcat_t opcat : test::make_opcats_all_solo())
+        {
+            EXPECT_EQ(check_all(ops, opcat),
+                      patomic_feature_caps_check_all(&caps, opcat));
+            EXPECT_EQ(check_any(ops, opcat),
+                      patomic_feature_caps_check_any(&caps, opcat));
+            if (opcat == patomic_opcat_NONE)
+            {
+                continue;
+            }
+            EXPECT_EQ(check_leaf(ops, opcat, ~0u),
+                      patomic_feature_caps_check_leaf(&caps, opcat, ~0u));
+        }
+        for (const patomic_opcat_t opcats : test::make_opcats_all_combined())
+        {
+            EXPECT_EQ(check_all(ops, opcats),
+                      patomic_feature_caps_check_all(&caps, opcats));
+            EXPECT_EQ(check_any(ops, opcats),
+                      patomic_feature_caps_check_any(&caps, opcats));
+        }
+    }
+
+private:
+    static unsigned int
+    check_all(const patomic_ops_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_all(&ops, opcats);
+    }
+
+    static unsigned int
+    check_all(const patomic_ops_explicit_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_all_explicit(&ops, opcats);
+    }
+
+    static unsigned int
+    check_all(const patomic_ops_transaction_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_all_transaction(&ops, opcats);
+    }
+
+    static unsigned int
+    check_any(const patomic_ops_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_any(&ops, opcats);
+    }
+
+    static unsigned int
+    check_any(const patomic_ops_explicit_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_any_explicit(&ops, opcats);
+    }
+
+    static unsigned int
+    check_any(const patomic_ops_transaction_t& ops, unsigned int opcats) noexcept
+    {
+        return patomic_feature_check_any_transaction(&ops, opcats);
+    }
+
+    static unsigned int
+    check_leaf(const patomic_ops_t& ops, patomic_opcat_t opcat,
+               unsigned int opkinds) noexcept
+    {
+        return patomic_feature_check_leaf(&ops, opcat, opkinds);
+    }
+
+    static unsigned int
+    check_leaf(const patomic_ops_explicit_t& ops, patomic_opcat_t opcat,
+               unsigned int opkinds) noexcept
+    {
+        return patomic_feature_check_leaf_explicit(&ops, opcat, opkinds);
+    }
+
+    static unsigned int
+    check_leaf(const patomic_ops_transaction_t& ops, patomic_opcat_t opcat,
+               unsigned int opkinds) noexcept
+    {
+        return patomic_feature_check_leaf_transaction(&ops, opcat, opkinds);
+    }
+};
+
+}  // namespace
+
+TYPED_TEST_SUITE(
+    BtApiFeatureCheckCapsT,
+    BtApiFeatureCheckCapsT_Types,
+    TTestHelper
+);
+
+TYPED_TEST_SUITE(
+    BtApiFeatureCheckCapsT_DeathTest,
+    BtApiFeatureCheckCapsT_Types,
+    TTestHelper
+);
+
+
+/// @brief Caps computed from an ops struct with no operations give the same
+///        results as checking the ops struct directly.
+TYPED_TEST(BtApiFeatureCheckCapsT, caps_match_feature_checks_for_null_ops)
+{
+    // setup
+    const typename TestFixture::OpsTypes::ldst_t ops {};
+
+    // test
+    TTestHelper::expect_caps_match(ops);
+}
+
+/// @brief Caps computed from an ops struct with all operations give the same
+///        results as checking the ops struct directly.
+TYPED_TEST(BtApiFeatureCheckCapsT, caps_match_feature_checks_for_full_ops)
+{
+    // setup
+    const auto ops = test::make_ops_all_nonnull<TestFixture::domain>();
+
+    // test
+    TTestHelper::expect_caps_match(ops);
+}
+
+/// @brief Caps computed from an ops struct with some operations give the same
+///        results as checking the ops struct directly.
+TYPED_TEST(BtApiFeatureCheckCapsT, caps_match_feature_checks_for_partial_ops)
+{
+    // setup
+    typename TestFixture::OpsTypes::ldst_t ops {};
+    ops.fp_load = test::make_ops_all_nonnull<TestFixture::domain>().fp_load;
+    for (const auto& xchg : test::make_ops_xchg_combinations<TestFixture::domain>())
+    {
+        ops.xchg_ops = xchg.ops;
+
+        // test
+        TTestHelper::expect_caps_match(ops);
+    }
+}
+
+/// @brief Calling caps_check_leaf with a single bit opcat value which does
+///        not correspond to any opcat returns the opkinds unmodified.
+TYPED_TEST(BtApiFeatureCheckCapsT, caps_check_leaf_unknown_opcat_ignores_opkinds)
+{
+    // skip this test when running with ubsan because it invokes UB
+    // we cast a value to patomic_opcat_t which has no corresponding label
+#if PATOMIC_HAS_UBSAN
+    GTEST_SKIP() << "Cannot run this test case under ubsan because "
+                    "it invokes UB as part of the test setup";
+#endif
+
+    // setup
+    const auto ops = test::make_ops_all_nonnull<TestFixture::domain>();
+    const patomic_feature_caps_abi_unstable_t caps = TTestHelper::caps(ops);
+    constexpr unsigned int input_opkinds = ~0u;
+
+    // test
+    for (unsigned int bit = PATOMIC_FEATURE_CAPS_OPCAT_COUNT_ABI_UNSTABLE;
+         bit < 32u; ++bit)
+    {
+        const auto opcat = static_cast<patomic_opcat_t>(1ul << bit);
+        EXPECT_EQ(input_opkinds,
+                  patomic_feature_caps_check_leaf(&caps, opcat, input_opkinds));
+    }
+}
+
+/// @brief Calling caps_check_leaf with an opcat value which does not have
+///        exactly one bit set is fatally asserted.
+TYPED_TEST(BtApiFeatureCheckCapsT_DeathTest, caps_check_leaf_asserts_on_non_solo_opcat)
+{
+    // setup
+    const auto ops = test::make_ops_all_nonnull<TestFixture::domain>();
+    const patomic_feature_caps_abi_unstable_t caps = TTestHelper::caps(ops);
+    constexpr unsigned int bad_opcats[] {
+        0u,
+        patomic_opcats_BIN,
+        TestFixture::OpsTypes::full_opcat
+    };
+
+    // test
+    for (const unsigned int opcat : bad_opcats)
+    {
+        EXPECT_EXIT(
+            patomic_feature_caps_check_leaf(
+                &caps, static_cast<patomic_opcat_t>(opcat), 0u),
+            test::KilledByAbort(),
+            ".*"
+        );
+    }
+}
@@ -141,9 +141,10 @@ TEST_F(BtApiFeatureCheckLeaf, all_opkinds_have_expected_bits)
     // values
     constexpr auto expected_ldst = patomic_opkind_LOAD | patomic_opkind_STORE;
     constexpr auto expected_xchg =
-        patomic_opkind_EXCHANGE     |
-        patomic_opkind_CMPXCHG_WEAK |
-        patomic_opkind_CMPXCHG_STRONG;
+        patomic_opkind_EXCHANGE       |
+        patomic_opkind_CMPXCHG_WEAK   |
+        patomic_opkind_CMPXCHG_STRONG |
+        patomic_opkind_FETCH_UPDATE;
     constexpr auto expected_bit =
         patomic_opkind_TEST       |
         patomic_opkind_TEST_COMPL |
@@ -155,16 +156,26 @@ TEST_F(BtApiFeatureCheckLeaf, all_opkinds_have_expected_bits)
         patomic_opkind_AND |
         patomic_opkind_NOT;
     constexpr auto expected_ari =
-        patomic_opkind_ADD |
-        patomic_opkind_SUB |
-        patomic_opkind_INC |
-        patomic_opkind_DEC |
-        patomic_opkind_NEG;
+        patomic_opkind_ADD      |
+        patomic_opkind_SUB      |
+        patomic_opkind_INC      |
+        patomic_opkind_DEC      |
+        patomic_opkind_NEG      |
+        patomic_opkind_MIN      |
+        patomic_opkind_MAX      |
+        patomic_opkind_UMIN     |
+        patomic_opkind_UMAX     |
+        patomic_opkind_ADD_SAT  |
+        patomic_opkind_SUB_SAT  |
+        patomic_opkind_UADD_SAT |
+        patomic_opkind_USUB_SAT;
     constexpr auto expected_tspec =
         patomic_opkind_DOUBLE_CMPXCHG |
         patomic_opkind_MULTI_CMPXCHG  |
         patomic_opkind_GENERIC        |
-        patomic_opkind_GENERIC_WFB;
+        patomic_opkind_GENERIC_WFB    |
+        patomic_opkind_MULTI_LOAD     |
+        patomic_opkind_MULTI_OP;
     constexpr auto expected_tflag =
         patomic_opkind_TEST     |
         patomic_opkind_TEST_SET |
@@ -176,6 +187,24 @@ TEST_F(BtApiFeatureCheckLeaf, all_opkinds_have_expected_bits)
         patomic_opkind_TABORT_SINGLE |
         patomic_opkind_TTEST         |
         patomic_opkind_TDEPTH;
+    constexpr auto expected_wait =
+        patomic_opkind_WAIT       |
+        patomic_opkind_WAIT_TIMED |
+        patomic_opkind_NOTIFY_ONE |
+        patomic_opkind_NOTIFY_ALL;
+    constexpr auto expected_batch =
+        patomic_opkind_ADD_N       |
+        patomic_opkind_SUB_N       |
+        patomic_opkind_OR_N        |
+        patomic_opkind_XOR_N       |
+        patomic_opkind_AND_N       |
+        patomic_opkind_EXCHANGE_N  |
+        patomic_opkind_CMPXCHG_N   |
+        patomic_opkind_STORE_ARRAY |
+        patomic_opkind_LOAD_ARRAY;
+    constexpr auto expected_flt =
+        patomic_opkind_FADD |
+        patomic_opkind_FSUB;
     // sets of values
     const std::vector<int> expected_vec {
         expected_ldst,
@@ -185,7 +214,10 @@ TEST_F(BtApiFeatureCheckLeaf, all_opkinds_have_expected_bits)
         expected_ari,
         expected_tspec,
         expected_tflag,
-        expected_traw
+        expected_traw,
+        expected_wait,
+        expected_batch,
+        expected_flt
     };
     const auto actual_vec = test::make_opkinds_all_combined();
     const std::set<int> expected_set {
@@ -207,6 +239,9 @@ TEST_F(BtApiFeatureCheckLeaf, all_opkinds_have_expected_bits)
     EXPECT_EQ(patomic_opkinds_TSPEC, expected_tspec);
     EXPECT_EQ(patomic_opkinds_TFLAG, expected_tflag);
     EXPECT_EQ(patomic_opkinds_TRAW, expected_traw);
+    EXPECT_EQ(patomic_opkinds_WAIT, expected_wait);
+    EXPECT_EQ(patomic_opkinds_BATCH, expected_batch);
+    EXPECT_EQ(patomic_opkinds_FLT, expected_flt);
     // can't check set sizes in case two opcats have the same value
     EXPECT_EQ(expected_vec.size(), actual_vec.size());
 }
@@ -609,6 +644,276 @@ TEST_F(BtApiFeatureCheckLeaf, check_leaf_raw_bits_match_expected)
     }
 }
 
+/// @brief Calling check_leaf with all WAIT function pointers set in
+///        patomic_ops_t unsets exactly the bits in patomic_opkinds_WAIT.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_wait_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    ops.wait_ops = test::make_ops_all_nonnull<domain>().wait_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    const unsigned int set_opkinds = patomic_opkinds_WAIT;
+    const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result =
+        TTestHelper::check_leaf(ops, patomic_opcat_WAIT, input_opkinds);
+    EXPECT_EQ(expected_result, actual_result);
+}
+
+/// @brief Calling check_leaf with all combinations of WAIT function pointers
+///        set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_wait_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(wait.opkinds);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_leaf(ops, patomic_opcat_WAIT, input_opkinds);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_leaf with all WAIT function pointers set in
+///        patomic_ops_explicit_t unsets exactly the bits in patomic_opkinds_WAIT.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_wait_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    ops.wait_ops = test::make_ops_all_nonnull<domain>().wait_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    const unsigned int set_opkinds = patomic_opkinds_WAIT;
+    const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result =
+        TTestHelper::check_leaf(ops, patomic_opcat_WAIT, input_opkinds);
+    EXPECT_EQ(expected_result, actual_result);
+}
+
+/// @brief Calling check_leaf with all combinations of WAIT function pointers
+///        set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_wait_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& wait : test::make_ops_wait_combinations<domain>())
+    {
+        ops.wait_ops = wait.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(wait.opkinds);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result =
+            TTestHelper::check_leaf(ops, patomic_opcat_WAIT, input_opkinds);
+        EXPECT_EQ(expected_result, actual_result);
+    }
+}
+
+/// @brief Calling check_leaf with all BATCH function pointers set in
+///        patomic_ops_t unsets exactly the bits in patomic_opkinds_BATCH,
+///        except for EXCHANGE_N and CMPXCHG_N which have no void variant, and
+///        STORE_ARRAY and LOAD_ARRAY which are each only in one variant.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_batch_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    ops.batch_ops = test::make_ops_all_nonnull<domain>().batch_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    const unsigned int set_opkinds_fetch =
+        patomic_opkinds_BATCH & ~patomic_opkind_STORE_ARRAY;
+    const unsigned int set_opkinds_void = patomic_opkinds_BATCH &
+        ~(patomic_opkind_EXCHANGE_N | patomic_opkind_CMPXCHG_N |
+          patomic_opkind_LOAD_ARRAY);
+    const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds_void);
+    const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds_fetch);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+        TTestHelper::check_leaf(ops, patomic_opcat_BATCH_V, input_opkinds);
+    const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+        TTestHelper::check_leaf(ops, patomic_opcat_BATCH_F, input_opkinds);
+    EXPECT_EQ(expected_result_void, actual_result_void);
+    EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+}
+
+/// @brief Calling check_leaf with all combinations of BATCH function pointers
+///        set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_batch_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(batch.opkinds_void);
+        const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(batch.opkinds_fetch);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+            TTestHelper::check_leaf(ops, patomic_opcat_BATCH_V, input_opkinds);
+        const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+            TTestHelper::check_leaf(ops, patomic_opcat_BATCH_F, input_opkinds);
+        EXPECT_EQ(expected_result_void, actual_result_void);
+        EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+    }
+}
+
+/// @brief Calling check_leaf with all BATCH function pointers set in
+///        patomic_ops_explicit_t unsets exactly the bits in patomic_opkinds_BATCH,
+///        except for EXCHANGE_N and CMPXCHG_N which have no void variant, and
+///        STORE_ARRAY and LOAD_ARRAY which are each only in one variant.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_batch_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    ops.batch_ops = test::make_ops_all_nonnull<domain>().batch_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    const unsigned int set_opkinds_fetch =
+        patomic_opkinds_BATCH & ~patomic_opkind_STORE_ARRAY;
+    const unsigned int set_opkinds_void = patomic_opkinds_BATCH &
+        ~(patomic_opkind_EXCHANGE_N | patomic_opkind_CMPXCHG_N |
+          patomic_opkind_LOAD_ARRAY);
+    const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds_void);
+    const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds_fetch);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+        TTestHelper::check_leaf(ops, patomic_opcat_BATCH_V, input_opkinds);
+    const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+        TTestHelper::check_leaf(ops, patomic_opcat_BATCH_F, input_opkinds);
+    EXPECT_EQ(expected_result_void, actual_result_void);
+    EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+}
+
+/// @brief Calling check_leaf with all combinations of BATCH function pointers
+///        set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_batch_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& batch : test::make_ops_batch_combinations<domain>())
+    {
+        ops.batch_ops = batch.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(batch.opkinds_void);
+        const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(batch.opkinds_fetch);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+            TTestHelper::check_leaf(ops, patomic_opcat_BATCH_V, input_opkinds);
+        const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+            TTestHelper::check_leaf(ops, patomic_opcat_BATCH_F, input_opkinds);
+        EXPECT_EQ(expected_result_void, actual_result_void);
+        EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+    }
+}
+
+/// @brief Calling check_leaf with all FLT function pointers set in
+///        patomic_ops_t unsets exactly the bits in patomic_opkinds_FLT.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_float_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    ops.float_ops = test::make_ops_all_nonnull<domain>().float_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    constexpr unsigned int set_opkinds = patomic_opkinds_FLT;
+    const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+        TTestHelper::check_leaf(ops, patomic_opcat_FLT_V, input_opkinds);
+    const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+        TTestHelper::check_leaf(ops, patomic_opcat_FLT_F, input_opkinds);
+    EXPECT_EQ(expected_result, actual_result_void);
+    EXPECT_EQ(expected_result, actual_result_fetch);
+}
+
+/// @brief Calling check_leaf with all combinations of FLT function pointers
+///        set in patomic_ops_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_float_bits_match_expected_implicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::IMPLICIT;
+    patomic_ops_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(flt.opkinds_void);
+        const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(flt.opkinds_fetch);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+            TTestHelper::check_leaf(ops, patomic_opcat_FLT_V, input_opkinds);
+        const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+            TTestHelper::check_leaf(ops, patomic_opcat_FLT_F, input_opkinds);
+        EXPECT_EQ(expected_result_void, actual_result_void);
+        EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+    }
+}
+
+/// @brief Calling check_leaf with all FLT function pointers set in
+///        patomic_ops_explicit_t unsets exactly the bits in patomic_opkinds_FLT.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_full_float_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    ops.float_ops = test::make_ops_all_nonnull<domain>().float_ops;
+    constexpr unsigned int input_opkinds = ~0u;
+    constexpr unsigned int set_opkinds = patomic_opkinds_FLT;
+    const auto expected_result = ~std::bitset<UINT_BIT_WIDTH>(set_opkinds);
+
+    // test
+    const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+        TTestHelper::check_leaf(ops, patomic_opcat_FLT_V, input_opkinds);
+    const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+        TTestHelper::check_leaf(ops, patomic_opcat_FLT_F, input_opkinds);
+    EXPECT_EQ(expected_result, actual_result_void);
+    EXPECT_EQ(expected_result, actual_result_fetch);
+}
+
+/// @brief Calling check_leaf with all combinations of FLT function pointers
+///        set in patomic_ops_explicit_t unsets the correct bits.
+TEST_F(BtApiFeatureCheckLeaf, check_leaf_float_bits_match_expected_explicit)
+{
+    // setup
+    constexpr auto domain = test::ops_domain::EXPLICIT;
+    patomic_ops_explicit_t ops {};
+    for (const auto& flt : test::make_ops_float_combinations<domain>())
+    {
+        ops.float_ops = flt.ops;
+        constexpr unsigned int input_opkinds = ~0u;
+        const auto expected_result_void = ~std::bitset<UINT_BIT_WIDTH>(flt.opkinds_void);
+        const auto expected_result_fetch = ~std::bitset<UINT_BIT_WIDTH>(flt.opkinds_fetch);
+
+        // test
+        const std::bitset<UINT_BIT_WIDTH> actual_result_void =
+            TTestHelper::check_leaf(ops, patomic_opcat_FLT_V, input_opkinds);
+        const std::bitset<UINT_BIT_WIDTH> actual_result_fetch =
+            TTestHelper::check_leaf(ops, patomic_opcat_FLT_F, input_opkinds);
+        EXPECT_EQ(expected_result_void, actual_result_void);
+        EXPECT_EQ(expected_result_fetch, actual_result_fetch);
+    }
+}
+
 /// @brief Calling check_leaf with an opcat value which has no bits set is
 ///        fatally asserted.
 TYPED_TEST(BtApiFeatureCheckLeafT_DeathTest, check_leaf_asserts_on_zero_bit_opcat)
@@ -0,0 +1,123 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/support.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiFence : public testing::Test
+{
+public:
+    const std::vector<patomic_id_t> ids {
+        test::supported_ids()
+    };
+
+    const std::vector<int> orders {
+        patomic_RELAXED,
+        patomic_CONSUME,
+        patomic_ACQUIRE,
+        patomic_RELEASE,
+        patomic_ACQ_REL,
+        patomic_SEQ_CST
+    };
+};
+
+
+/// @brief Each implementation supports either both fences or neither.
+TEST_F(BtApiFence, create_fence_is_all_or_nothing)
+{
+    // go through all ids
+    for (const patomic_id_t id : ids)
+    {
+        // setup
+        const patomic_fence_t fence = patomic_create_fence(patomic_kinds_ALL, id);
+
+        // test
+        EXPECT_EQ(fence.fp_thread_fence == nullptr, fence.fp_signal_fence == nullptr);
+    }
+}
+
+/// @brief No fences are provided if no implementation matches kinds and ids.
+TEST_F(BtApiFence, create_fence_without_matching_impl_is_null)
+{
+    // setup
+    const patomic_fence_t fence_no_ids = patomic_create_fence(patomic_kinds_ALL, 0ul);
+    const patomic_fence_t fence_no_kinds = patomic_create_fence(0u, patomic_ids_ALL);
+
+    // test
+    EXPECT_EQ(nullptr, fence_no_ids.fp_thread_fence);
+    EXPECT_EQ(nullptr, fence_no_ids.fp_signal_fence);
+    EXPECT_EQ(nullptr, fence_no_kinds.fp_thread_fence);
+    EXPECT_EQ(nullptr, fence_no_kinds.fp_signal_fence);
+}
+
+/// @brief Fences can be called with every valid memory order, both directly
+///        and through the convenience functions.
+TEST_F(BtApiFence, fences_accept_all_valid_orders)
+{
+    // setup
+    const patomic_fence_t fence = patomic_create_fence(patomic_kinds_ALL, patomic_ids_ALL);
+
+    // test
+    for (const int order : orders)
+    {
+        if (fence.fp_thread_fence != nullptr)
+        {
+            patomic_thread_fence(order);
+            patomic_signal_fence(order);
+            fence.fp_thread_fence(order);
+            fence.fp_signal_fence(order);
+        }
+    }
+}
+
+/// @brief A release fence before a relaxed store and an acquire fence after a
+///        relaxed load make prior writes visible to the loading thread.
+TEST_F(BtApiFence, fences_order_relaxed_ops)
+{
+    // setup
+    using T = std::uint32_t;
+    const patomic_fence_t fence = patomic_create_fence(patomic_kinds_ALL, patomic_ids_ALL);
+    const patomic_t pat = patomic_create(
+        sizeof(T), patomic_RELAXED, 0u, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    if (fence.fp_thread_fence == nullptr ||
+        pat.ops.fp_store == nullptr || pat.ops.fp_load == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; fences or relaxed ops are not supported";
+    }
+    constexpr T iterations = 10000;
+    T data = 0;
+    T flag = 0;
+
+    // test
+    std::thread producer([&]() noexcept {
+        for (T i = 1; i <= iterations; ++i)
+        {
+            pat.ops.fp_store(&data, &i);
+            fence.fp_thread_fence(patomic_RELEASE);
+            pat.ops.fp_store(&flag, &i);
+        }
+    });
+    T last_flag = 0;
+    while (last_flag != iterations)
+    {
+        T seen_flag {};
+        T seen_data {};
+        pat.ops.fp_load(&flag, &seen_flag);
+        fence.fp_thread_fence(patomic_ACQUIRE);
+        pat.ops.fp_load(&data, &seen_data);
+        EXPECT_GE(seen_flag, last_flag);
+        EXPECT_GE(seen_data, seen_flag);
+        last_flag = seen_flag;
+    }
+    producer.join();
+}
@@ -0,0 +1,155 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiFetchUpdate : public testing::Test
+{
+public:
+    /// @brief Adds the value pointed to by ctx to the current value, unless
+    ///        the current value has its top bit set.
+    template <class T>
+    static int
+    add_unless_flagged(const void *current, void *desired, void *ctx) noexcept
+    {
+        constexpr T flag = static_cast<T>(T(1) << (sizeof(T) * 8u - 1u));
+        T cur {};
+        T step {};
+        std::memcpy(&cur, current, sizeof(T));
+        std::memcpy(&step, ctx, sizeof(T));
+        if (cur & flag)
+        {
+            return 0;
+        }
+        const T des = static_cast<T>(cur + step);
+        std::memcpy(desired, &des, sizeof(T));
+        return 1;
+    }
+
+    template <class T>
+    static void
+    fetch_update_adds_unless_flagged(const patomic_ops_xchg_t& ops)
+    {
+        // setup
+        constexpr T flag = static_cast<T>(T(1) << (sizeof(T) * 8u - 1u));
+        T step = 3;
+        T obj = 5;
+        T res {};
+        ASSERT_NE(nullptr, ops.fp_fetch_update);
+
+        // test
+        EXPECT_EQ(1, ops.fp_fetch_update(&obj, &add_unless_flagged<T>, &step, &res));
+        EXPECT_EQ(5u, res);
+        EXPECT_EQ(8u, obj);
+        obj = static_cast<T>(flag | 5u);
+        EXPECT_EQ(0, ops.fp_fetch_update(&obj, &add_unless_flagged<T>, &step, &res));
+        EXPECT_EQ(static_cast<T>(flag | 5u), res);
+        EXPECT_EQ(static_cast<T>(flag | 5u), obj);
+    }
+};
+
+
+/// @brief Fetch update applies the callback to the object's value and returns
+///        the original value, or leaves the object unmodified if the callback
+///        declines, for all supported widths.
+TEST_F(BtApiFetchUpdate, fetch_update_applies_or_declines)
+{
+    // setup
+    const patomic_t pat_8 = test::create_best<std::uint8_t>();
+    const patomic_t pat_16 = test::create_best<std::uint16_t>();
+    const patomic_t pat_32 = test::create_best<std::uint32_t>();
+    const patomic_t pat_64 = test::create_best<std::uint64_t>();
+    for (const patomic_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.xchg_ops.fp_fetch_update == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; fetch_update is not supported";
+        }
+    }
+
+    // test
+    fetch_update_adds_unless_flagged<std::uint8_t>(pat_8.ops.xchg_ops);
+    fetch_update_adds_unless_flagged<std::uint16_t>(pat_16.ops.xchg_ops);
+    fetch_update_adds_unless_flagged<std::uint32_t>(pat_32.ops.xchg_ops);
+    fetch_update_adds_unless_flagged<std::uint64_t>(pat_64.ops.xchg_ops);
+}
+
+/// @brief Explicit fetch update applies the callback with any valid pair of
+///        success and fail orders.
+TEST_F(BtApiFetchUpdate, explicit_fetch_update_applies_or_declines)
+{
+    // setup
+    using T = std::uint32_t;
+    constexpr T flag = static_cast<T>(T(1) << 31u);
+    const patomic_explicit_t pat = test::create_best_explicit<T>();
+    const auto fp_fetch_update = pat.ops.xchg_ops.fp_fetch_update;
+    if (fp_fetch_update == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; fetch_update is not supported";
+    }
+    T step = 10;
+    T obj = 1;
+    T res {};
+
+    // test
+    EXPECT_EQ(1, fp_fetch_update(&obj, &add_unless_flagged<T>, &step,
+                                 patomic_RELAXED, patomic_RELAXED, &res));
+    EXPECT_EQ(1u, res);
+    EXPECT_EQ(11u, obj);
+    EXPECT_EQ(1, fp_fetch_update(&obj, &add_unless_flagged<T>, &step,
+                                 patomic_ACQ_REL, patomic_ACQUIRE, &res));
+    EXPECT_EQ(11u, res);
+    EXPECT_EQ(21u, obj);
+    obj = flag;
+    EXPECT_EQ(0, fp_fetch_update(&obj, &add_unless_flagged<T>, &step,
+                                 patomic_SEQ_CST, patomic_SEQ_CST, &res));
+    EXPECT_EQ(flag, res);
+    EXPECT_EQ(flag, obj);
+}
+
+/// @brief Concurrent fetch updates on the same object are each applied
+///        exactly once, with the callback retried on contention.
+TEST_F(BtApiFetchUpdate, fetch_update_is_atomic_under_contention)
+{
+    // setup
+    using T = std::uint32_t;
+    const patomic_t pat = test::create_best<T>();
+    const auto fp_fetch_update = pat.ops.xchg_ops.fp_fetch_update;
+    if (fp_fetch_update == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; fetch_update is not supported";
+    }
+    constexpr unsigned int thread_count = 4;
+    constexpr unsigned int iterations = 10000;
+    T obj = 0;
+
+    // test
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]() noexcept {
+            T step = 1;
+            T res {};
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                fp_fetch_update(&obj, &add_unless_flagged<T>, &step, &res);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(thread_count * iterations, obj);
+}
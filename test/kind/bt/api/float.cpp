@@ -0,0 +1,230 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiFloat : public testing::Test
+{
+public:
+    template <class T>
+    static void
+    fetch_add_sub_returns_original(const patomic_ops_float_t& ops)
+    {
+        // setup
+        T obj = 1.5;
+        T arg = 0.25;
+        T res {};
+        ASSERT_NE(nullptr, ops.fp_fetch_add);
+        ASSERT_NE(nullptr, ops.fp_fetch_sub);
+
+        // test
+        ops.fp_fetch_add(&obj, &arg, &res);
+        EXPECT_EQ(T(1.5), res);
+        EXPECT_EQ(T(1.75), obj);
+        ops.fp_fetch_sub(&obj, &arg, &res);
+        EXPECT_EQ(T(1.75), res);
+        EXPECT_EQ(T(1.5), obj);
+        ops.fp_add(&obj, &arg);
+        EXPECT_EQ(T(1.75), obj);
+        ops.fp_sub(&obj, &arg);
+        ops.fp_sub(&obj, &arg);
+        EXPECT_EQ(T(1.25), obj);
+    }
+};
+
+
+/// @brief Float ops are only available for the widths of float and double,
+///        and the FLT_V and FLT_F ops are each either all null or all
+///        non-null.
+TEST_F(BtApiFloat, float_ops_only_for_float_widths)
+{
+    // setup
+    // widths which are not the width of float or double
+    const patomic_t pat_8 = test::create_best<std::uint8_t>();
+    const patomic_t pat_16 = test::create_best<std::uint16_t>();
+    const patomic_t pat_float = test::create_best<float>();
+    const patomic_t pat_double = test::create_best<double>();
+
+    // test
+    for (const patomic_t *pat : { &pat_8, &pat_16 })
+    {
+        EXPECT_EQ(patomic_opcats_FLT,
+                  patomic_feature_check_any(&pat->ops, patomic_opcats_FLT));
+    }
+    for (const patomic_t *pat : { &pat_float, &pat_double })
+    {
+        for (const unsigned int opcat : { patomic_opcat_FLT_V, patomic_opcat_FLT_F })
+        {
+            EXPECT_EQ(patomic_feature_check_any(&pat->ops, opcat),
+                      patomic_feature_check_all(&pat->ops, opcat));
+        }
+    }
+}
+
+/// @brief Float and double fetch add and sub return the original value, and
+///        all ops update the object.
+TEST_F(BtApiFloat, fetch_add_sub_returns_original)
+{
+    // setup
+    const patomic_t pat_float = test::create_best<float>();
+    const patomic_t pat_double = test::create_best<double>();
+    for (const patomic_t *pat : { &pat_float, &pat_double })
+    {
+        if (pat->ops.float_ops.fp_fetch_add == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; float ops are not supported";
+        }
+    }
+
+    // test
+    fetch_add_sub_returns_original<float>(pat_float.ops.float_ops);
+    fetch_add_sub_returns_original<double>(pat_double.ops.float_ops);
+}
+
+/// @brief An object or argument holding NaN produces NaN, and an object
+///        holding NaN does not prevent the operation from completing.
+TEST_F(BtApiFloat, nan_propagates)
+{
+    // setup
+    using T = double;
+    const patomic_t pat = test::create_best<T>();
+    const auto& float_ops = pat.ops.float_ops;
+    if (float_ops.fp_fetch_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; float ops are not supported";
+    }
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    T obj = nan;
+    T arg = 1.0;
+    T res {};
+
+    // test
+    float_ops.fp_fetch_add(&obj, &arg, &res);
+    EXPECT_TRUE(std::isnan(res));
+    EXPECT_TRUE(std::isnan(obj));
+    obj = 1.0;
+    arg = nan;
+    float_ops.fp_fetch_sub(&obj, &arg, &res);
+    EXPECT_EQ(1.0, res);
+    EXPECT_TRUE(std::isnan(obj));
+}
+
+/// @brief Signed zeros follow IEEE arithmetic, and the original value of a
+///        negative zero is returned with its sign.
+TEST_F(BtApiFloat, signed_zero_semantics)
+{
+    // setup
+    using T = float;
+    const patomic_t pat = test::create_best<T>();
+    const auto& float_ops = pat.ops.float_ops;
+    if (float_ops.fp_fetch_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; float ops are not supported";
+    }
+    T obj = -0.0f;
+    T arg = 0.0f;
+    T res {};
+
+    // test
+    // -0.0 + +0.0 == +0.0
+    float_ops.fp_fetch_add(&obj, &arg, &res);
+    EXPECT_TRUE(std::signbit(res));
+    EXPECT_FALSE(std::signbit(obj));
+    // -0.0 - +0.0 == -0.0
+    obj = -0.0f;
+    float_ops.fp_fetch_sub(&obj, &arg, &res);
+    EXPECT_TRUE(std::signbit(res));
+    EXPECT_TRUE(std::signbit(obj));
+}
+
+/// @brief Explicit float ops apply the operation with any valid memory order.
+TEST_F(BtApiFloat, explicit_fetch_add_sub)
+{
+    // setup
+    using T = double;
+    const patomic_explicit_t pat = test::create_best_explicit<T>();
+    const auto& float_ops = pat.ops.float_ops;
+    if (float_ops.fp_fetch_add == nullptr || float_ops.fp_sub == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; float ops are not supported";
+    }
+    T obj = 10.0;
+    T arg = 2.5;
+    T res {};
+
+    // test
+    float_ops.fp_fetch_add(&obj, &arg, patomic_RELAXED, &res);
+    EXPECT_EQ(10.0, res);
+    EXPECT_EQ(12.5, obj);
+    float_ops.fp_fetch_sub(&obj, &arg, patomic_ACQ_REL, &res);
+    EXPECT_EQ(12.5, res);
+    EXPECT_EQ(10.0, obj);
+    float_ops.fp_sub(&obj, &arg, patomic_RELEASE);
+    EXPECT_EQ(7.5, obj);
+}
+
+/// @brief Concurrent float additions on the same object are each applied
+///        exactly once.
+TEST_F(BtApiFloat, add_is_atomic_under_contention)
+{
+    // setup
+    using T = float;
+    const patomic_t pat = test::create_best<T>();
+    const auto fp_add = pat.ops.float_ops.fp_add;
+    if (fp_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; float ops are not supported";
+    }
+    constexpr unsigned int thread_count = 4;
+    constexpr unsigned int iterations = 10000;
+    T obj = 0.0f;
+
+    // test
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]() noexcept {
+            const T arg = 1.0f;
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                fp_add(&obj, &arg);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(static_cast<T>(thread_count * iterations), obj);
+}
+
+/// @brief Float operations are reported as either using a native atomic or a
+///        compare-exchange loop, consistently for void and fetch variants.
+TEST_F(BtApiFloat, describe_reports_method)
+{
+    // setup
+    const patomic_t pat = test::create_best<double>();
+    if (pat.ops.float_ops.fp_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; float operations are not supported";
+    }
+
+    // test
+    const auto void_add = patomic_describe(&pat, patomic_opcat_FLT_V, patomic_opkind_FADD);
+    const auto fetch_sub = patomic_describe(&pat, patomic_opcat_FLT_F, patomic_opkind_FSUB);
+    EXPECT_TRUE(void_add.method == patomic_method_DIRECT ||
+                void_add.method == patomic_method_CMPXCHG_LOOP);
+    EXPECT_EQ(void_add.method, fetch_sub.method);
+}
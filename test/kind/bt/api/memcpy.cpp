@@ -0,0 +1,175 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+#include <test/common/support.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiMemcpy : public testing::Test
+{
+public:
+    const std::vector<patomic_id_t> ids {
+        test::supported_ids()
+    };
+
+    static constexpr std::size_t buffer_size = 80;
+    static constexpr unsigned char guard = 0xA5u;
+};
+
+/// @brief Definition needed pre-C++17 since guard is bound to references.
+constexpr unsigned char BtApiMemcpy::guard;
+
+
+/// @brief Each implementation supports either both memcpy operations or
+///        neither.
+TEST_F(BtApiMemcpy, create_memcpy_is_all_or_nothing)
+{
+    // go through all ids
+    for (const patomic_id_t id : ids)
+    {
+        // setup
+        const patomic_memcpy_t ops = patomic_create_memcpy(patomic_kinds_ALL, id);
+
+        // test
+        EXPECT_EQ(ops.fp_load_memcpy == nullptr, ops.fp_store_memcpy == nullptr);
+    }
+}
+
+/// @brief Store memcpy followed by load memcpy round trips the bytes for all
+///        offsets and lengths, without touching bytes outside the range.
+TEST_F(BtApiMemcpy, memcpy_round_trips_any_offset_and_length)
+{
+    // setup
+    const patomic_memcpy_t ops = test::create_best_memcpy();
+    if (ops.fp_load_memcpy == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; atomic memcpy is not supported";
+    }
+    std::array<unsigned char, buffer_size> src {};
+    for (std::size_t i = 0; i < buffer_size; ++i)
+    {
+        src[i] = static_cast<unsigned char>(i + 1u);
+    }
+
+    // go through all offsets and lengths
+    for (std::size_t offset = 0; offset < 16; ++offset)
+    {
+        for (std::size_t len = 0; offset + len < buffer_size; ++len)
+        {
+            // setup
+            alignas(16) std::array<unsigned char, buffer_size> shared {};
+            std::array<unsigned char, buffer_size> dst {};
+            shared.fill(guard);
+            dst.fill(guard);
+
+            // test
+            ops.fp_store_memcpy(&shared[offset], src.data(), len, patomic_RELEASE);
+            ops.fp_load_memcpy(dst.data(), &shared[offset], len, patomic_ACQUIRE);
+            for (std::size_t i = 0; i < buffer_size; ++i)
+            {
+                const bool in_range = i >= offset && i < offset + len;
+                EXPECT_EQ(in_range ? src[i - offset] : guard, shared[i]);
+                EXPECT_EQ(i < len ? src[i] : guard, dst[i]);
+            }
+        }
+    }
+}
+
+/// @brief Memcpy operations accept all valid orders and a count of zero
+///        without accessing their pointer arguments, through both the created
+///        operations and the convenience functions.
+TEST_F(BtApiMemcpy, memcpy_accepts_valid_orders)
+{
+    // setup
+    const patomic_memcpy_t ops = test::create_best_memcpy();
+    if (ops.fp_load_memcpy == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; atomic memcpy is not supported";
+    }
+    std::uint64_t shared = 0;
+    std::uint64_t value = 0x0123456789abcdefu;
+    std::uint64_t result = 0;
+
+    // test
+    for (const int order : { patomic_RELAXED, patomic_RELEASE, patomic_SEQ_CST })
+    {
+        patomic_atomic_store_memcpy(nullptr, nullptr, 0u, order);
+        patomic_atomic_store_memcpy(&shared, &value, sizeof(value), order);
+    }
+    for (const int order : { patomic_RELAXED, patomic_CONSUME,
+                             patomic_ACQUIRE, patomic_SEQ_CST })
+    {
+        patomic_atomic_load_memcpy(nullptr, nullptr, 0u, order);
+        patomic_atomic_load_memcpy(&result, &shared, sizeof(shared), order);
+    }
+    EXPECT_EQ(value, shared);
+    EXPECT_EQ(value, result);
+}
+
+/// @brief A seqlock reader using load memcpy never accepts a torn payload
+///        while a writer uses store memcpy concurrently.
+TEST_F(BtApiMemcpy, seqlock_payload_is_never_torn)
+{
+    // setup
+    using T = std::uint32_t;
+    const patomic_memcpy_t ops = test::create_best_memcpy();
+    const patomic_explicit_t pat = patomic_create_explicit(
+        sizeof(T), 0u, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    if (ops.fp_load_memcpy == nullptr ||
+        pat.ops.fp_store == nullptr || pat.ops.fp_load == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; atomic memcpy or explicit ops are not supported";
+    }
+    constexpr T iterations = 5000;
+    constexpr std::size_t payload_count = 13;
+    T seq = 0;
+    std::array<T, payload_count> payload {};
+
+    // test
+    std::thread writer([&]() noexcept {
+        std::array<T, payload_count> values {};
+        for (T i = 1; i <= iterations; ++i)
+        {
+            const T odd = 2u * i - 1u;
+            const T even = 2u * i;
+            values.fill(i);
+            pat.ops.fp_store(&seq, &odd, patomic_RELAXED);
+            ops.fp_store_memcpy(payload.data(), values.data(),
+                                sizeof(values), patomic_RELEASE);
+            pat.ops.fp_store(&seq, &even, patomic_RELEASE);
+        }
+    });
+    T last = 0;
+    while (last != iterations)
+    {
+        std::array<T, payload_count> copy {};
+        T seq_before {};
+        T seq_after {};
+        pat.ops.fp_load(&seq, patomic_ACQUIRE, &seq_before);
+        ops.fp_load_memcpy(copy.data(), payload.data(),
+                           sizeof(copy), patomic_ACQUIRE);
+        pat.ops.fp_load(&seq, patomic_RELAXED, &seq_after);
+        if (seq_before != seq_after || (seq_before % 2u) != 0)
+        {
+            continue;
+        }
+        for (const T value : copy)
+        {
+            EXPECT_EQ(seq_before / 2u, value);
+        }
+        last = seq_before / 2u;
+    }
+    writer.join();
+}
@@ -0,0 +1,192 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+/// @brief Test fixture.
+class BtApiMinMax : public testing::Test
+{
+public:
+    template <class T>
+    static void
+    minmax_compare_negative_values(const patomic_ops_explicit_arithmetic_t& ops)
+    {
+        // setup
+        using S = typename std::make_signed<T>::type;
+        const T lowest = static_cast<T>(std::numeric_limits<S>::min());
+        const T minus_two = static_cast<T>(static_cast<S>(-2));
+        const T minus_one = static_cast<T>(static_cast<S>(-1));
+        const T highest = static_cast<T>(std::numeric_limits<S>::max());
+        T obj {};
+        T res {};
+
+        // test void
+        obj = minus_one;
+        ops.fp_min(&obj, &minus_two, patomic_RELAXED);
+        EXPECT_EQ(minus_two, obj);
+        ops.fp_max(&obj, &minus_one, patomic_SEQ_CST);
+        EXPECT_EQ(minus_one, obj);
+        ops.fp_min(&obj, &lowest, patomic_ACQ_REL);
+        EXPECT_EQ(lowest, obj);
+        ops.fp_max(&obj, &highest, patomic_RELEASE);
+        EXPECT_EQ(highest, obj);
+
+        // test fetch
+        obj = minus_two;
+        ops.fp_fetch_max(&obj, &minus_one, patomic_ACQUIRE, &res);
+        EXPECT_EQ(minus_two, res);
+        EXPECT_EQ(minus_one, obj);
+        ops.fp_fetch_min(&obj, &highest, patomic_SEQ_CST, &res);
+        EXPECT_EQ(minus_one, res);
+        EXPECT_EQ(minus_one, obj);
+        obj = highest;
+        ops.fp_fetch_min(&obj, &lowest, patomic_RELAXED, &res);
+        EXPECT_EQ(highest, res);
+        EXPECT_EQ(lowest, obj);
+    }
+
+    template <class T>
+    static void
+    fetch_minmax_compare_signedness(const patomic_ops_arithmetic_t& ops)
+    {
+        // setup
+        // as unsigned this is the largest value, as signed it is negative
+        const T negative = static_cast<T>(~static_cast<T>(0));
+        const T positive = 1;
+        T obj {};
+        T res {};
+        ASSERT_NE(nullptr, ops.fp_fetch_min);
+        ASSERT_NE(nullptr, ops.fp_fetch_max);
+        ASSERT_NE(nullptr, ops.fp_fetch_umin);
+        ASSERT_NE(nullptr, ops.fp_fetch_umax);
+
+        // test
+        obj = positive;
+        ops.fp_fetch_min(&obj, &negative, &res);
+        EXPECT_EQ(positive, res);
+        EXPECT_EQ(negative, obj);
+        obj = positive;
+        ops.fp_fetch_max(&obj, &negative, &res);
+        EXPECT_EQ(positive, res);
+        EXPECT_EQ(positive, obj);
+        obj = positive;
+        ops.fp_fetch_umin(&obj, &negative, &res);
+        EXPECT_EQ(positive, res);
+        EXPECT_EQ(positive, obj);
+        obj = positive;
+        ops.fp_fetch_umax(&obj, &negative, &res);
+        EXPECT_EQ(positive, res);
+        EXPECT_EQ(negative, obj);
+    }
+};
+
+
+/// @brief The MIN, MAX, UMIN, and UMAX ops are supported together for both
+///        void and fetch variants.
+TEST_F(BtApiMinMax, minmax_ops_are_all_or_nothing)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    constexpr unsigned int opkinds =
+        patomic_opkind_MIN  |
+        patomic_opkind_MAX  |
+        patomic_opkind_UMIN |
+        patomic_opkind_UMAX;
+    const unsigned int unsupported_void = patomic_feature_check_leaf(
+        &pat.ops, patomic_opcat_ARI_V, opkinds
+    );
+    const unsigned int unsupported_fetch = patomic_feature_check_leaf(
+        &pat.ops, patomic_opcat_ARI_F, opkinds
+    );
+
+    // test
+    EXPECT_TRUE(unsupported_void == 0u || unsupported_void == opkinds);
+    EXPECT_EQ(unsupported_void, unsupported_fetch);
+}
+
+/// @brief Signed minimum and maximum treat values with the top bit set as
+///        negative, unsigned minimum and maximum treat them as large.
+TEST_F(BtApiMinMax, fetch_minmax_compare_signedness)
+{
+    // setup
+    const patomic_t pat_8 = test::create_best<std::uint8_t>();
+    const patomic_t pat_16 = test::create_best<std::uint16_t>();
+    const patomic_t pat_32 = test::create_best<std::uint32_t>();
+    const patomic_t pat_64 = test::create_best<std::uint64_t>();
+    for (const patomic_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.arithmetic_ops.fp_fetch_min == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; min and max are not supported";
+        }
+    }
+
+    // test
+    fetch_minmax_compare_signedness<std::uint8_t>(pat_8.ops.arithmetic_ops);
+    fetch_minmax_compare_signedness<std::uint16_t>(pat_16.ops.arithmetic_ops);
+    fetch_minmax_compare_signedness<std::uint32_t>(pat_32.ops.arithmetic_ops);
+    fetch_minmax_compare_signedness<std::uint64_t>(pat_64.ops.arithmetic_ops);
+}
+
+/// @brief Explicit void minimum and maximum store the smaller or larger of the
+///        object and argument.
+TEST_F(BtApiMinMax, explicit_minmax_modify_object)
+{
+    // setup
+    const patomic_explicit_t pat = test::create_best_explicit<std::int32_t>();
+    const auto& ops = pat.ops.arithmetic_ops;
+    if (ops.fp_min == nullptr || ops.fp_umax == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; min and max are not supported";
+    }
+    std::int32_t obj = 10;
+    const std::int32_t small = -20;
+    const std::int32_t large = 30;
+
+    // test
+    ops.fp_max(&obj, &small, patomic_RELAXED);
+    EXPECT_EQ(10, obj);
+    ops.fp_min(&obj, &small, patomic_ACQ_REL);
+    EXPECT_EQ(-20, obj);
+    ops.fp_umin(&obj, &large, patomic_SEQ_CST);
+    EXPECT_EQ(30, obj);
+    ops.fp_umax(&obj, &small, patomic_RELEASE);
+    EXPECT_EQ(-20, obj);
+    ops.fp_max(&obj, &large, patomic_ACQUIRE);
+    EXPECT_EQ(30, obj);
+}
+
+/// @brief Signed minimum and maximum order negative values and the extremes
+///        of the signed range correctly at every width, which covers each
+///        signed type the direct implementation may reinterpret the object as.
+TEST_F(BtApiMinMax, explicit_minmax_compare_negative_values)
+{
+    // setup
+    const patomic_explicit_t pat_8 = test::create_best_explicit<std::uint8_t>();
+    const patomic_explicit_t pat_16 = test::create_best_explicit<std::uint16_t>();
+    const patomic_explicit_t pat_32 = test::create_best_explicit<std::uint32_t>();
+    const patomic_explicit_t pat_64 = test::create_best_explicit<std::uint64_t>();
+    for (const patomic_explicit_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.arithmetic_ops.fp_min == nullptr ||
+            pat->ops.arithmetic_ops.fp_fetch_min == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; min and max are not supported";
+        }
+    }
+
+    // test
+    minmax_compare_negative_values<std::uint8_t>(pat_8.ops.arithmetic_ops);
+    minmax_compare_negative_values<std::uint16_t>(pat_16.ops.arithmetic_ops);
+    minmax_compare_negative_values<std::uint32_t>(pat_32.ops.arithmetic_ops);
+    minmax_compare_negative_values<std::uint64_t>(pat_64.ops.arithmetic_ops);
+}
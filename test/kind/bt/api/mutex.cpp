@@ -0,0 +1,104 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiMutex : public testing::Test
+{
+public:
+    std::unique_ptr<patomic_elided_mutex_abi_unstable_t> mutex {
+        new patomic_elided_mutex_abi_unstable_t {}
+    };
+
+    void
+    init(unsigned long attempts)
+    {
+        if (patomic_elided_mutex_init(mutex.get(), attempts) == 0)
+        {
+            GTEST_SKIP() << "Skipping; flag operations are not supported";
+        }
+    }
+
+    unsigned long
+    total_count() const noexcept
+    {
+        unsigned long elided = 0;
+        unsigned long fallback = 0;
+        patomic_elided_mutex_stats(mutex.get(), &elided, &fallback);
+        return elided + fallback;
+    }
+};
+
+
+/// @brief Every critical section is counted as either elided or fallback.
+TEST_F(BtApiMutex, lock_unlock_counts_every_critical_section)
+{
+    // setup
+    init(4ul);
+    constexpr unsigned long iterations = 100;
+
+    // test
+    for (unsigned long i = 0; i < iterations; ++i)
+    {
+        patomic_elided_mutex_lock(mutex.get());
+        patomic_elided_mutex_unlock(mutex.get());
+    }
+#if PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H
+    EXPECT_EQ(iterations, total_count());
+#endif
+}
+
+/// @brief A mutex initialized with zero attempts is never elided.
+TEST_F(BtApiMutex, zero_attempts_never_elides)
+{
+    // setup
+    init(0ul);
+    unsigned long elided = 1;
+    unsigned long fallback = 0;
+
+    // test
+    patomic_elided_mutex_lock(mutex.get());
+    patomic_elided_mutex_unlock(mutex.get());
+    patomic_elided_mutex_stats(mutex.get(), &elided, &fallback);
+    EXPECT_EQ(0ul, elided);
+    EXPECT_EQ(0, mutex->holder.flag);
+}
+
+/// @brief Critical sections from multiple threads are mutually exclusive, so
+///        no non-atomic updates are lost.
+TEST_F(BtApiMutex, critical_sections_are_mutually_exclusive)
+{
+    // setup
+    init(4ul);
+    constexpr unsigned int thread_count = 4;
+    constexpr unsigned int iterations = 10000;
+    unsigned long counter = 0;
+
+    // test
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]() noexcept {
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                patomic_elided_mutex_lock(mutex.get());
+                ++counter;
+                patomic_elided_mutex_unlock(mutex.get());
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(thread_count * iterations, counter);
+    EXPECT_EQ(0, mutex->holder.flag);
+}
@@ -16,7 +16,10 @@ class BtApiOptions : public testing::Test
 {
 public:
     const std::vector<patomic_option_t> solo_options {
-        patomic_option_NONE
+        patomic_option_NONE,
+        patomic_option_PROFILE,
+        patomic_option_TRANSACTION_LOCK,
+        patomic_option_PROCESS_SHARED
     };
 
     const std::vector<patomic_option_t> combined_options {
@@ -0,0 +1,120 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#if defined(__unix__)
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+
+/// @brief Test fixture.
+class BtApiProcessShared : public testing::Test
+{
+public:
+    static constexpr auto shared =
+        static_cast<unsigned int>(patomic_option_PROCESS_SHARED);
+    static constexpr auto lock =
+        static_cast<unsigned int>(patomic_option_TRANSACTION_LOCK);
+};
+
+
+/// @brief Wait operations rely on process-local state, so they are never
+///        provided for process-shared use.
+TEST_F(BtApiProcessShared, wait_ops_are_not_provided)
+{
+    // setup
+    const patomic_t pat = test::create_best<int>(shared);
+    const patomic_explicit_t pat_explicit = test::create_best_explicit<int>(shared);
+    const auto opcat = static_cast<unsigned int>(patomic_opcat_WAIT);
+
+    // test
+    EXPECT_EQ(opcat, patomic_feature_check_any(&pat.ops, opcat));
+    EXPECT_EQ(opcat, patomic_feature_check_any_explicit(&pat_explicit.ops, opcat));
+}
+
+/// @brief Address-free operations are unaffected by process-shared use.
+TEST_F(BtApiProcessShared, other_ops_are_unchanged)
+{
+    // setup
+    const patomic_t plain = test::create_best<int>(0u);
+    const patomic_t pat = test::create_best<int>(shared);
+    const patomic_explicit_t plain_explicit = test::create_best_explicit<int>(0u);
+    const patomic_explicit_t pat_explicit = test::create_best_explicit<int>(shared);
+    const unsigned int opcats = patomic_opcats_IMPLICIT;
+
+    // test
+    EXPECT_EQ(patomic_feature_check_all(&plain.ops, opcats),
+              patomic_feature_check_all(&pat.ops, opcats));
+    EXPECT_EQ(patomic_feature_check_all_explicit(&plain_explicit.ops, opcats),
+              patomic_feature_check_all_explicit(&pat_explicit.ops, opcats));
+}
+
+/// @brief Transactions are not emulated with a process-local lock for
+///        process-shared use.
+TEST_F(BtApiProcessShared, transaction_lock_is_ignored)
+{
+    // setup
+    const patomic_transaction_t pat = patomic_create_transaction(
+        shared, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    const patomic_transaction_t pat_lock = patomic_create_transaction(
+        shared | lock, patomic_kinds_ALL, patomic_ids_ALL
+    );
+
+    // test
+    EXPECT_EQ(pat.ops.raw_ops.fp_tbegin, pat_lock.ops.raw_ops.fp_tbegin);
+    EXPECT_EQ(pat.ops.raw_ops.fp_tcommit, pat_lock.ops.raw_ops.fp_tcommit);
+}
+
+/// @brief Operations on an object in shared memory are atomic across
+///        processes.
+TEST_F(BtApiProcessShared, fetch_add_is_atomic_across_processes)
+{
+#if defined(__unix__)
+    // setup
+    const patomic_t pat = test::create_best<int>(shared);
+    const auto fp_fetch_add = pat.ops.arithmetic_ops.fp_fetch_add;
+    const auto fp_load = pat.ops.fp_load;
+    if (fp_fetch_add == nullptr || fp_load == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; fetch_add or load is not supported";
+    }
+    void *const mem = mmap(nullptr, sizeof(int), PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, mem);
+    auto *const obj = static_cast<int *>(mem);
+    *obj = 0;
+    constexpr int iterations = 10000;
+    const int arg = 1;
+    int ret = 0;
+
+    // test
+    const pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+    for (int i = 0; i < iterations; ++i)
+    {
+        fp_fetch_add(obj, &arg, &ret);
+    }
+    if (pid == 0)
+    {
+        _exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(pid, waitpid(pid, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status));
+    fp_load(obj, &ret);
+    EXPECT_EQ(2 * iterations, ret);
+
+    // cleanup
+    munmap(mem, sizeof(int));
+#else
+    GTEST_SKIP() << "Skipping; shared memory is only tested on POSIX";
+#endif
+}
@@ -0,0 +1,280 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+
+/// @brief Test fixture.
+class BtApiProfile : public testing::Test
+{
+public:
+    static constexpr auto profile = static_cast<unsigned int>(patomic_option_PROFILE);
+};
+
+
+/// @brief Snapshot of an invalid slot has all counters as zero.
+TEST_F(BtApiProfile, snapshot_invalid_slot_is_zero)
+{
+    // setup
+    const auto slot = static_cast<patomic_profile_slot_t>(-1);
+
+    // test
+    const patomic_profile_counters_t counters = patomic_profile_snapshot(slot);
+    EXPECT_EQ(0ul, counters.calls);
+    EXPECT_EQ(0ul, counters.failures);
+}
+
+/// @brief Profiling does not change which operations are supported.
+TEST_F(BtApiProfile, profile_option_preserves_supported_ops)
+{
+    // setup
+    const patomic_t plain = test::create_best<int>(0u);
+    const patomic_t profiled = test::create_best<int>(profile);
+    const patomic_explicit_t plain_explicit = test::create_best_explicit<int>(0u);
+    const patomic_explicit_t profiled_explicit = test::create_best_explicit<int>(profile);
+    const unsigned int opcats = patomic_opcats_IMPLICIT;
+
+    // test
+    EXPECT_EQ(patomic_feature_check_all(&plain.ops, opcats),
+              patomic_feature_check_all(&profiled.ops, opcats));
+    EXPECT_EQ(patomic_feature_check_all_explicit(&plain_explicit.ops, opcats),
+              patomic_feature_check_all_explicit(&profiled_explicit.ops, opcats));
+}
+
+/// @brief Calls through profiled operations are counted and forwarded.
+TEST_F(BtApiProfile, profiled_calls_are_counted)
+{
+    // setup
+    const patomic_t profiled = test::create_best<int>(profile);
+    const auto fp_fetch_add = profiled.ops.arithmetic_ops.fp_fetch_add;
+    if (!patomic_profile_is_supported() || fp_fetch_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; profiling or fetch_add is not supported";
+    }
+    const auto before = patomic_profile_snapshot(patomic_profile_slot_FETCH_ADD);
+    int obj = 5;
+    const int arg = 2;
+    int ret = 0;
+
+    // test
+    fp_fetch_add(&obj, &arg, &ret);
+    fp_fetch_add(&obj, &arg, &ret);
+    const auto after = patomic_profile_snapshot(patomic_profile_slot_FETCH_ADD);
+    EXPECT_EQ(7, ret);
+    EXPECT_EQ(9, obj);
+    EXPECT_EQ(2ul, after.calls - before.calls);
+    EXPECT_EQ(0ul, after.failures - before.failures);
+}
+
+/// @brief Calls through profiled explicit operations are counted.
+TEST_F(BtApiProfile, profiled_explicit_calls_are_counted)
+{
+    // setup
+    const patomic_explicit_t profiled = test::create_best_explicit<int>(profile);
+    const auto fp_store = profiled.ops.fp_store;
+    if (!patomic_profile_is_supported() || fp_store == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; profiling or store is not supported";
+    }
+    const auto before = patomic_profile_snapshot(patomic_profile_slot_STORE);
+    int obj = 0;
+    const int des = 3;
+
+    // test
+    fp_store(&obj, &des, patomic_RELAXED);
+    const auto after = patomic_profile_snapshot(patomic_profile_slot_STORE);
+    EXPECT_EQ(3, obj);
+    EXPECT_EQ(1ul, after.calls - before.calls);
+}
+
+/// @brief Failed compare-exchange calls are counted as failures.
+TEST_F(BtApiProfile, profiled_cmpxchg_failures_are_counted)
+{
+    // setup
+    const patomic_t profiled = test::create_best<int>(profile);
+    const auto fp_cmpxchg = profiled.ops.xchg_ops.fp_cmpxchg_strong;
+    if (!patomic_profile_is_supported() || fp_cmpxchg == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; profiling or cmpxchg_strong is not supported";
+    }
+    const auto before = patomic_profile_snapshot(patomic_profile_slot_CMPXCHG_STRONG);
+    int obj = 1;
+    int exp = 0;
+    const int des = 2;
+
+    // test
+    EXPECT_FALSE(fp_cmpxchg(&obj, &exp, &des));
+    EXPECT_EQ(1, exp);
+    EXPECT_TRUE(fp_cmpxchg(&obj, &exp, &des));
+    const auto after = patomic_profile_snapshot(patomic_profile_slot_CMPXCHG_STRONG);
+    EXPECT_EQ(2, obj);
+    EXPECT_EQ(2ul, after.calls - before.calls);
+    EXPECT_EQ(1ul, after.failures - before.failures);
+}
+
+/// @brief Calls through operations obtained without the option are not
+///        counted.
+TEST_F(BtApiProfile, unprofiled_calls_are_not_counted)
+{
+    // setup
+    const patomic_t plain = test::create_best<int>(0u);
+    const auto fp_load = plain.ops.fp_load;
+    if (fp_load == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; load is not supported";
+    }
+    const auto before = patomic_profile_snapshot(patomic_profile_slot_LOAD);
+    const int obj = 4;
+    int ret = 0;
+
+    // test
+    fp_load(&obj, &ret);
+    const auto after = patomic_profile_snapshot(patomic_profile_slot_LOAD);
+    EXPECT_EQ(4, ret);
+    EXPECT_EQ(before.calls, after.calls);
+}
+
+/// @brief Operations are only counted if they are reported as profiled, which
+///        stops being the case once every profiling instance is in use.
+TEST_F(BtApiProfile, profiled_calls_are_counted_only_if_described_as_profiled)
+{
+    // setup
+    if (!patomic_profile_is_supported())
+    {
+        GTEST_SKIP() << "Skipping; profiling is not supported";
+    }
+    constexpr std::size_t widths[] { 1u, 2u, 4u, 8u, 16u };
+    constexpr patomic_memory_order_t orders[] {
+        patomic_RELAXED, patomic_CONSUME, patomic_ACQUIRE,
+        patomic_RELEASE, patomic_ACQ_REL, patomic_SEQ_CST
+    };
+    int profiled_count = 0;
+
+    // test
+    for (const std::size_t width : widths)
+    {
+        for (const patomic_memory_order_t order : orders)
+        {
+            const patomic_t pat = patomic_create(
+                width, order, profile, patomic_kinds_ALL, patomic_ids_ALL
+            );
+            const auto fp_exchange = pat.ops.xchg_ops.fp_exchange;
+            if (fp_exchange == nullptr)
+            {
+                continue;
+            }
+            const patomic_provenance_t prov = patomic_describe(
+                &pat, patomic_opcat_XCHG, patomic_opkind_EXCHANGE
+            );
+            profiled_count += prov.is_profiled;
+            alignas(64) unsigned char obj[64] {};
+            const unsigned char des[64] {};
+            unsigned char ret[64] {};
+            const auto before = patomic_profile_snapshot(patomic_profile_slot_EXCHANGE);
+            fp_exchange(obj, des, ret);
+            const auto after = patomic_profile_snapshot(patomic_profile_slot_EXCHANGE);
+            EXPECT_EQ(prov.is_profiled ? 1ul : 0ul, after.calls - before.calls);
+        }
+    }
+    EXPECT_LE(profiled_count, PATOMIC_PROFILE_INSTANCE_COUNT_ABI_UNSTABLE);
+}
+
+/// @brief Histogram of an invalid slot or width has all buckets as zero.
+TEST_F(BtApiProfile, histogram_invalid_slot_or_width_is_zero)
+{
+    // setup
+    const auto slot = static_cast<patomic_profile_slot_t>(-1);
+    const patomic_profile_histogram_t zero {};
+
+    // test
+    for (const patomic_profile_histogram_t& hist : {
+        patomic_profile_cmpxchg_histogram(slot, sizeof(int)),
+        patomic_profile_cmpxchg_histogram(patomic_profile_slot_FETCH_NOT, 0u),
+        patomic_profile_cmpxchg_histogram(patomic_profile_slot_FETCH_NOT, 3u),
+        patomic_profile_cmpxchg_histogram(patomic_profile_slot_FETCH_NOT, 32u)
+    })
+    {
+        for (int i = 0; i < PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT; ++i)
+        {
+            EXPECT_EQ(zero.buckets[i], hist.buckets[i]);
+        }
+    }
+}
+
+/// @brief Cmpxchg loop iterations are recorded for emulated operations,
+///        regardless of whether they are profiled.
+TEST_F(BtApiProfile, histogram_records_cmpxchg_loop)
+{
+    // setup
+    const patomic_t plain = test::create_best<int>(0u);
+    const auto fp_fetch_not = plain.ops.binary_ops.fp_fetch_not;
+    if (!patomic_profile_histogram_is_enabled() || fp_fetch_not == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; histogram or fetch_not is not supported";
+    }
+    constexpr auto slot = patomic_profile_slot_FETCH_NOT;
+    const auto before = patomic_profile_cmpxchg_histogram(slot, sizeof(int));
+    int obj = 0;
+    int ret = 1;
+
+    // test
+    fp_fetch_not(&obj, &ret);
+    const auto after = patomic_profile_cmpxchg_histogram(slot, sizeof(int));
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(~0, obj);
+    unsigned long total = 0;
+    for (int i = 0; i < PATOMIC_PROFILE_HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        total += after.buckets[i] - before.buckets[i];
+    }
+    EXPECT_EQ(1ul, total);
+}
+
+/// @brief Report of hot addresses is empty when count is zero.
+TEST_F(BtApiProfile, hot_addresses_zero_count_is_empty)
+{
+    // test
+    EXPECT_EQ(0u, patomic_profile_hot_addresses(nullptr, 0u));
+}
+
+/// @brief Sampled addresses are reported with their op kinds and failures,
+///        most contended first.
+TEST_F(BtApiProfile, hot_addresses_are_reported)
+{
+    // setup
+    const patomic_t profiled = test::create_best<int>(profile);
+    const auto fp_load = profiled.ops.fp_load;
+    const auto fp_cmpxchg = profiled.ops.xchg_ops.fp_cmpxchg_strong;
+    if (!patomic_profile_is_supported() || fp_load == nullptr || fp_cmpxchg == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; profiling, load, or cmpxchg_strong is not supported";
+    }
+    static int hot = 0;
+    static int warm = 0;
+    int exp = 1;
+    const int des = 2;
+    int ret = 0;
+
+    // test
+    patomic_profile_set_sample_interval(1u);
+    fp_load(&warm, &ret);
+    fp_load(&hot, &ret);
+    fp_cmpxchg(&hot, &exp, &des);
+    patomic_profile_set_sample_interval(0u);
+    fp_cmpxchg(&hot, &exp, &des);
+    patomic_profile_hot_address_abi_unstable_t report[2] {};
+    ASSERT_EQ(2u, patomic_profile_hot_addresses(report, 2u));
+    EXPECT_EQ(&hot, report[0].address);
+    EXPECT_EQ(2ul, report[0].samples);
+    EXPECT_EQ(1ul, report[0].failures);
+    EXPECT_EQ(1ul, report[0].slot_samples[patomic_profile_slot_LOAD]);
+    EXPECT_EQ(1ul, report[0].slot_samples[patomic_profile_slot_CMPXCHG_STRONG]);
+    EXPECT_EQ(0ul, report[0].slot_samples[patomic_profile_slot_STORE]);
+    EXPECT_EQ(0ul, report[1].failures);
+}
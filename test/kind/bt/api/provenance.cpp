@@ -0,0 +1,116 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+
+/// @brief Test fixture.
+class BtApiProvenance : public testing::Test
+{};
+
+
+/// @brief Describing an unsupported operation gives an empty provenance.
+TEST_F(BtApiProvenance, describe_unsupported_is_empty)
+{
+    // setup
+    const patomic_t empty = patomic_create(
+        sizeof(int), patomic_SEQ_CST, 0u, patomic_kinds_ALL, patomic_id_NULL
+    );
+
+    // test
+    const patomic_provenance_t prov = patomic_describe(
+        &empty, patomic_opcat_ARI_F, patomic_opkind_ADD
+    );
+    EXPECT_EQ(patomic_id_NULL, prov.id);
+    EXPECT_EQ(patomic_kind_UNKN, prov.kind);
+    EXPECT_EQ(patomic_method_UNKN, prov.method);
+    EXPECT_EQ(0u, prov.byte_width);
+    EXPECT_EQ(0, prov.is_profiled);
+}
+
+/// @brief Describing a supported operation gives the implementation which
+///        supplied it and the width it was created for.
+TEST_F(BtApiProvenance, describe_supported_finds_impl)
+{
+    // setup
+    const patomic_t ops = test::create_best<int>(0u);
+    if (ops.ops.arithmetic_ops.fp_fetch_add == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; fetch_add is not supported";
+    }
+
+    // test
+    const patomic_provenance_t prov = patomic_describe(
+        &ops, patomic_opcat_ARI_F, patomic_opkind_ADD
+    );
+    EXPECT_NE(patomic_id_NULL, prov.id);
+    EXPECT_NE(patomic_kind_UNKN, prov.kind);
+    EXPECT_EQ(sizeof(int), prov.byte_width);
+    EXPECT_EQ(0, prov.is_profiled);
+    if (prov.id == patomic_id_STDC)
+    {
+        EXPECT_EQ(patomic_kind_BLTN, prov.kind);
+        EXPECT_EQ(patomic_method_DIRECT, prov.method);
+    }
+}
+
+/// @brief Operations emulated with a cmpxchg loop are described as such.
+TEST_F(BtApiProvenance, describe_emulated_op)
+{
+    // setup
+    const patomic_t ops = test::create_best<int>(0u);
+    const patomic_provenance_t prov = patomic_describe(
+        &ops, patomic_opcat_BIN_F, patomic_opkind_NOT
+    );
+    if (prov.id != patomic_id_STDC)
+    {
+        GTEST_SKIP() << "Skipping; fetch_not is not supplied by STDC";
+    }
+
+    // test
+    EXPECT_EQ(patomic_method_CMPXCHG_LOOP, prov.method);
+}
+
+/// @brief Profiled operations are described as the operations they wrap.
+TEST_F(BtApiProvenance, describe_sees_through_profiling)
+{
+    // setup
+    const patomic_t plain = test::create_best<int>(0u);
+    const patomic_t profiled = test::create_best<int>(static_cast<unsigned int>(patomic_option_PROFILE));
+    if (!patomic_profile_is_supported() || plain.ops.fp_load == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; profiling or load is not supported";
+    }
+
+    // test
+    const auto expected = patomic_describe(&plain, patomic_opcat_LDST, patomic_opkind_LOAD);
+    const auto actual = patomic_describe(&profiled, patomic_opcat_LDST, patomic_opkind_LOAD);
+    EXPECT_EQ(1, actual.is_profiled);
+    EXPECT_EQ(expected.id, actual.id);
+    EXPECT_EQ(expected.kind, actual.kind);
+    EXPECT_EQ(expected.method, actual.method);
+    EXPECT_EQ(expected.byte_width, actual.byte_width);
+}
+
+/// @brief Describing a supported explicit operation gives the implementation
+///        which supplied it and the width it was created for.
+TEST_F(BtApiProvenance, describe_explicit_supported_finds_impl)
+{
+    // setup
+    const patomic_explicit_t ops = test::create_best_explicit<int>(0u);
+    if (ops.ops.xchg_ops.fp_exchange == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; exchange is not supported";
+    }
+
+    // test
+    const patomic_provenance_t prov = patomic_describe_explicit(
+        &ops, patomic_opcat_XCHG, patomic_opkind_EXCHANGE
+    );
+    EXPECT_NE(patomic_id_NULL, prov.id);
+    EXPECT_EQ(sizeof(int), prov.byte_width);
+}
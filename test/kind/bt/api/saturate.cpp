@@ -0,0 +1,157 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+
+/// @brief Test fixture.
+class BtApiSaturate : public testing::Test
+{
+public:
+    template <class T>
+    static void
+    fetch_signed_saturates(const patomic_ops_arithmetic_t& ops)
+    {
+        // setup
+        constexpr T max = std::numeric_limits<T>::max();
+        constexpr T min = std::numeric_limits<T>::min();
+        const T one = 1;
+        const T two = 2;
+        T obj {};
+        T res {};
+        ASSERT_NE(nullptr, ops.fp_fetch_add_sat);
+        ASSERT_NE(nullptr, ops.fp_fetch_sub_sat);
+
+        // test
+        obj = static_cast<T>(max - 1);
+        ops.fp_fetch_add_sat(&obj, &two, &res);
+        EXPECT_EQ(static_cast<T>(max - 1), res);
+        EXPECT_EQ(max, obj);
+        obj = static_cast<T>(min + 1);
+        ops.fp_fetch_sub_sat(&obj, &two, &res);
+        EXPECT_EQ(static_cast<T>(min + 1), res);
+        EXPECT_EQ(min, obj);
+        obj = -1;
+        ops.fp_fetch_sub_sat(&obj, &max, &res);
+        EXPECT_EQ(-1, res);
+        EXPECT_EQ(min, obj);
+        obj = 0;
+        ops.fp_fetch_sub_sat(&obj, &min, &res);
+        EXPECT_EQ(0, res);
+        EXPECT_EQ(max, obj);
+        obj = -1;
+        ops.fp_fetch_add_sat(&obj, &one, &res);
+        EXPECT_EQ(-1, res);
+        EXPECT_EQ(0, obj);
+    }
+
+    template <class T>
+    static void
+    fetch_unsigned_saturates(const patomic_ops_arithmetic_t& ops)
+    {
+        // setup
+        constexpr T max = std::numeric_limits<T>::max();
+        const T one = 1;
+        const T two = 2;
+        T obj {};
+        T res {};
+        ASSERT_NE(nullptr, ops.fp_fetch_uadd_sat);
+        ASSERT_NE(nullptr, ops.fp_fetch_usub_sat);
+
+        // test
+        obj = static_cast<T>(max - 1);
+        ops.fp_fetch_uadd_sat(&obj, &two, &res);
+        EXPECT_EQ(static_cast<T>(max - 1), res);
+        EXPECT_EQ(max, obj);
+        obj = 1;
+        ops.fp_fetch_usub_sat(&obj, &two, &res);
+        EXPECT_EQ(1u, res);
+        EXPECT_EQ(0u, obj);
+        obj = 2;
+        ops.fp_fetch_usub_sat(&obj, &one, &res);
+        EXPECT_EQ(2u, res);
+        EXPECT_EQ(1u, obj);
+    }
+};
+
+
+/// @brief Signed saturating add and sub clamp to the range of the signed
+///        type, and otherwise behave like add and sub.
+TEST_F(BtApiSaturate, fetch_signed_saturates)
+{
+    // setup
+    const patomic_t pat_8 = test::create_best<std::int8_t>();
+    const patomic_t pat_16 = test::create_best<std::int16_t>();
+    const patomic_t pat_32 = test::create_best<std::int32_t>();
+    const patomic_t pat_64 = test::create_best<std::int64_t>();
+    for (const patomic_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.arithmetic_ops.fp_fetch_add_sat == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; saturating ops are not supported";
+        }
+    }
+
+    // test
+    fetch_signed_saturates<std::int8_t>(pat_8.ops.arithmetic_ops);
+    fetch_signed_saturates<std::int16_t>(pat_16.ops.arithmetic_ops);
+    fetch_signed_saturates<std::int32_t>(pat_32.ops.arithmetic_ops);
+    fetch_signed_saturates<std::int64_t>(pat_64.ops.arithmetic_ops);
+}
+
+/// @brief Unsigned saturating add and sub clamp to the range of the unsigned
+///        type, and otherwise behave like add and sub.
+TEST_F(BtApiSaturate, fetch_unsigned_saturates)
+{
+    // setup
+    const patomic_t pat_8 = test::create_best<std::uint8_t>();
+    const patomic_t pat_16 = test::create_best<std::uint16_t>();
+    const patomic_t pat_32 = test::create_best<std::uint32_t>();
+    const patomic_t pat_64 = test::create_best<std::uint64_t>();
+    for (const patomic_t *pat : { &pat_8, &pat_16, &pat_32, &pat_64 })
+    {
+        if (pat->ops.arithmetic_ops.fp_fetch_uadd_sat == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; saturating ops are not supported";
+        }
+    }
+
+    // test
+    fetch_unsigned_saturates<std::uint8_t>(pat_8.ops.arithmetic_ops);
+    fetch_unsigned_saturates<std::uint16_t>(pat_16.ops.arithmetic_ops);
+    fetch_unsigned_saturates<std::uint32_t>(pat_32.ops.arithmetic_ops);
+    fetch_unsigned_saturates<std::uint64_t>(pat_64.ops.arithmetic_ops);
+}
+
+/// @brief Explicit void saturating ops clamp the stored value.
+TEST_F(BtApiSaturate, explicit_saturating_ops_modify_object)
+{
+    // setup
+    const patomic_explicit_t pat = patomic_create_explicit(
+        sizeof(std::uint16_t), 0u, patomic_kinds_ALL, patomic_ids_ALL
+    );
+    const auto& ops = pat.ops.arithmetic_ops;
+    if (ops.fp_uadd_sat == nullptr || ops.fp_usub_sat == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; saturating ops are not supported";
+    }
+    std::uint16_t obj = 10;
+    const std::uint16_t large = 0xf000u;
+
+    // test
+    ops.fp_uadd_sat(&obj, &large, patomic_RELAXED);
+    EXPECT_EQ(0xf00au, obj);
+    ops.fp_uadd_sat(&obj, &large, patomic_ACQ_REL);
+    EXPECT_EQ(0xffffu, obj);
+    ops.fp_usub_sat(&obj, &large, patomic_RELEASE);
+    EXPECT_EQ(0x0fffu, obj);
+    ops.fp_usub_sat(&obj, &large, patomic_SEQ_CST);
+    EXPECT_EQ(0u, obj);
+}
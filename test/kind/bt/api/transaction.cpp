@@ -39,6 +39,13 @@ public:
             patomic_TINFO_NESTED
         };
     }
+
+    static unsigned long
+    make_status(patomic_transaction_exit_code_t code, unsigned int info) noexcept
+    {
+        return static_cast<unsigned long>(code) |
+               (static_cast<unsigned long>(info) << 16ul);
+    }
 };
 
 
@@ -136,3 +143,93 @@ TEST_F(BtApiTransaction, abort_reason_is_second_8_bits_of_status)
     EXPECT_EQ(0ul, patomic_transaction_status_abort_reason(status));
     EXPECT_EQ(0ul, PATOMIC_TRANSACTION_STATUS_ABORT_REASON(status));
 }
+
+/// @brief Without a policy, every aborted attempt is retried and all
+///        attempts are made.
+TEST_F(BtApiTransaction, policy_null_always_retries)
+{
+    // test
+    for (auto code : supported_exit_codes())
+    {
+        EXPECT_NE(0, patomic_transaction_policy_retry(
+            nullptr, make_status(code, patomic_TINFO_NONE), 1ul
+        ));
+    }
+    EXPECT_EQ(7ul, patomic_transaction_policy_attempts(nullptr, 7ul));
+    patomic_transaction_policy_record(nullptr, 1ul);
+}
+
+/// @brief Explicit aborts are not retried, capacity and debug aborts are only
+///        retried when hinted, and conflict and unknown aborts are retried.
+TEST_F(BtApiTransaction, policy_retry_depends_on_exit_code)
+{
+    // setup
+    patomic_transaction_policy_t policy {};
+    patomic_transaction_policy_init(&policy, 8ul, 1ul);
+    const auto retry = [&](patomic_transaction_exit_code_t code,
+                           unsigned int info) noexcept {
+        return patomic_transaction_policy_retry(
+            &policy, make_status(code, info), 2ul
+        );
+    };
+
+    // test
+    EXPECT_EQ(0, retry(patomic_TABORT_EXPLICIT, patomic_TINFO_NONE));
+    EXPECT_EQ(0, retry(patomic_TABORT_EXPLICIT, patomic_TINFO_FLAG_SET));
+    EXPECT_EQ(0, retry(patomic_TABORT_CAPACITY, patomic_TINFO_NONE));
+    EXPECT_NE(0, retry(patomic_TABORT_CAPACITY, patomic_TINFO_RETRY));
+    EXPECT_EQ(0, retry(patomic_TABORT_DEBUG, patomic_TINFO_NONE));
+    EXPECT_NE(0, retry(patomic_TABORT_DEBUG, patomic_TINFO_RETRY));
+    EXPECT_NE(0, retry(patomic_TABORT_CONFLICT, patomic_TINFO_NONE));
+    EXPECT_NE(0, retry(patomic_TABORT_UNKNOWN, patomic_TINFO_NONE));
+}
+
+/// @brief The adaptive budget halves on failure, grows by one on success up
+///        to the maximum, and ignores explicit aborts.
+TEST_F(BtApiTransaction, policy_budget_adapts_to_results)
+{
+    // setup
+    patomic_transaction_policy_t policy {};
+    patomic_transaction_policy_init(&policy, 8ul, 0ul);
+    const unsigned long conflict =
+        make_status(patomic_TABORT_CONFLICT, patomic_TINFO_NONE);
+    const unsigned long flag_set =
+        make_status(patomic_TABORT_EXPLICIT, patomic_TINFO_FLAG_SET);
+    if (patomic_transaction_policy_attempts(&policy, 100ul) != 8ul)
+    {
+        FAIL() << "Budget does not start at max_attempts";
+    }
+    patomic_transaction_policy_record(&policy, conflict);
+    if (patomic_transaction_policy_attempts(&policy, 100ul) == 8ul)
+    {
+        GTEST_SKIP() << "Skipping; adaptive budget is not supported";
+    }
+
+    // test
+    EXPECT_EQ(4ul, patomic_transaction_policy_attempts(&policy, 100ul));
+    EXPECT_EQ(3ul, patomic_transaction_policy_attempts(&policy, 3ul));
+    patomic_transaction_policy_record(&policy, flag_set);
+    EXPECT_EQ(4ul, patomic_transaction_policy_attempts(&policy, 100ul));
+    for (int i = 0; i < 4; ++i)
+    {
+        patomic_transaction_policy_record(&policy, conflict);
+    }
+    EXPECT_EQ(1ul, patomic_transaction_policy_attempts(&policy, 100ul));
+    for (int i = 0; i < 20; ++i)
+    {
+        patomic_transaction_policy_record(&policy, 0ul);
+    }
+    EXPECT_EQ(8ul, patomic_transaction_policy_attempts(&policy, 100ul));
+}
+
+/// @brief A zero maximum number of attempts is treated as one.
+TEST_F(BtApiTransaction, policy_init_zero_max_attempts_is_one)
+{
+    // setup
+    patomic_transaction_policy_t policy {};
+    patomic_transaction_policy_init(&policy, 0ul, 0ul);
+
+    // test
+    EXPECT_EQ(1ul, policy.max_attempts);
+    EXPECT_EQ(1ul, patomic_transaction_policy_attempts(&policy, 5ul));
+}
@@ -0,0 +1,315 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <vector>
+
+
+/// @brief Test fixture.
+class BtApiTransactionLock : public testing::Test
+{
+public:
+    static constexpr auto option =
+        static_cast<unsigned int>(patomic_option_TRANSACTION_LOCK);
+
+    patomic_transaction_t pat {};
+
+    void
+    SetUp() override
+    {
+        pat = patomic_create_transaction(
+            option, patomic_kinds_ALL, patomic_ids_ALL
+        );
+        if (pat.ops.raw_ops.fp_tbegin == nullptr)
+        {
+            GTEST_SKIP() << "Skipping; transactions are not supported";
+        }
+    }
+
+    static patomic_transaction_config_t
+    make_config(std::size_t width) noexcept
+    {
+        patomic_transaction_config_t config {};
+        config.width = width;
+        config.attempts = 1ul;
+        config.flag_nullable = nullptr;
+        return config;
+    }
+};
+
+
+/// @brief Emulated transactions provide begin, commit, depth, and flag
+///        operations, but not explicit aborts.
+TEST_F(BtApiTransactionLock, raw_ops_without_abort)
+{
+    // test
+    EXPECT_NE(nullptr, pat.ops.raw_ops.fp_tcommit);
+    EXPECT_NE(nullptr, pat.ops.raw_ops.fp_tdepth);
+    EXPECT_EQ(pat.ops.raw_ops.fp_ttest, pat.ops.raw_ops.fp_tdepth);
+    EXPECT_EQ(nullptr, pat.ops.raw_ops.fp_tabort_all);
+    EXPECT_EQ(nullptr, pat.ops.raw_ops.fp_tabort_single);
+    EXPECT_NE(nullptr, pat.ops.flag_ops.fp_test);
+    EXPECT_NE(nullptr, pat.ops.flag_ops.fp_test_set);
+    EXPECT_NE(nullptr, pat.ops.flag_ops.fp_clear);
+}
+
+/// @brief Nested transactions always begin successfully, and the depth tracks
+///        the nesting level.
+TEST_F(BtApiTransactionLock, nested_transactions_track_depth)
+{
+    // setup
+    const patomic_ops_transaction_raw_t& raw = pat.ops.raw_ops;
+
+    // test
+    EXPECT_EQ(0, raw.fp_tdepth());
+    EXPECT_EQ(0ul, raw.fp_tbegin());
+    EXPECT_EQ(1, raw.fp_tdepth());
+    EXPECT_EQ(0ul, raw.fp_tbegin());
+    EXPECT_EQ(2, raw.fp_tdepth());
+    raw.fp_tcommit();
+    EXPECT_EQ(1, raw.fp_tdepth());
+    raw.fp_tcommit();
+    EXPECT_EQ(0, raw.fp_tdepth());
+}
+
+/// @brief Operations run exactly once and succeed on the first attempt, unless
+///        the flag is set.
+TEST_F(BtApiTransactionLock, ops_succeed_unless_flag_set)
+{
+    // setup
+    using T = std::uint32_t;
+    patomic_transaction_config_t config = make_config(sizeof(T));
+    patomic_transaction_result_t result {};
+    patomic_transaction_flag_t flag = 0;
+    T obj = 5;
+    T arg = 3;
+    T res {};
+
+    // test
+    pat.ops.arithmetic_ops.fp_fetch_add(&obj, &arg, &res, config, &result);
+    EXPECT_EQ(0ul, result.status);
+    EXPECT_EQ(1ul, result.attempts_made);
+    EXPECT_EQ(5u, res);
+    EXPECT_EQ(8u, obj);
+    EXPECT_EQ(0, pat.ops.flag_ops.fp_test_set(&flag));
+    EXPECT_EQ(1, pat.ops.flag_ops.fp_test(&flag));
+    config.flag_nullable = &flag;
+    pat.ops.arithmetic_ops.fp_fetch_add(&obj, &arg, &res, config, &result);
+    EXPECT_NE(0ul, result.status);
+    EXPECT_EQ(8u, obj);
+    pat.ops.flag_ops.fp_clear(&flag);
+    EXPECT_EQ(0, pat.ops.flag_ops.fp_test(&flag));
+}
+
+/// @brief Emulated minimum and maximum compare signed values by their two's
+///        complement representation, and unsigned values by magnitude, at
+///        widths that are not a native integer size.
+TEST_F(BtApiTransactionLock, minmax_compare_signedness)
+{
+    // setup
+    const patomic_ops_transaction_arithmetic_t& ops = pat.ops.arithmetic_ops;
+    ASSERT_NE(nullptr, ops.fp_min);
+    ASSERT_NE(nullptr, ops.fp_umax);
+    ASSERT_NE(nullptr, ops.fp_fetch_max);
+    ASSERT_NE(nullptr, ops.fp_fetch_umin);
+    const patomic_transaction_config_t config = make_config(3u);
+    patomic_transaction_result_t result {};
+    // as unsigned this is the largest value, as signed it is -1
+    const unsigned char negative[3] = { 0xff, 0xff, 0xff };
+    const unsigned char positive[3] = { 1, 0, 0 };
+    unsigned char obj[3] {};
+    unsigned char res[3] {};
+    const auto set = [](unsigned char (&dst)[3],
+                        const unsigned char (&src)[3]) noexcept {
+        std::copy(std::begin(src), std::end(src), std::begin(dst));
+    };
+    // little endian byte order is assumed for the values above
+    const unsigned int one = 1u;
+    if (*reinterpret_cast<const unsigned char *>(&one) != 1u)
+    {
+        GTEST_SKIP() << "Skipping; test values assume little endian";
+    }
+
+    // test
+    set(obj, positive);
+    ops.fp_min(obj, negative, config, &result);
+    EXPECT_EQ(0ul, result.status);
+    EXPECT_TRUE(std::equal(std::begin(obj), std::end(obj), negative));
+    set(obj, positive);
+    ops.fp_umax(obj, negative, config, &result);
+    EXPECT_TRUE(std::equal(std::begin(obj), std::end(obj), negative));
+    set(obj, positive);
+    ops.fp_fetch_max(obj, negative, res, config, &result);
+    EXPECT_TRUE(std::equal(std::begin(res), std::end(res), positive));
+    EXPECT_TRUE(std::equal(std::begin(obj), std::end(obj), positive));
+    set(obj, negative);
+    ops.fp_fetch_umin(obj, positive, res, config, &result);
+    EXPECT_TRUE(std::equal(std::begin(res), std::end(res), negative));
+    EXPECT_TRUE(std::equal(std::begin(obj), std::end(obj), positive));
+}
+
+/// @brief Emulated saturating addition and subtraction clamp the result to
+///        the range of the signed or unsigned type.
+TEST_F(BtApiTransactionLock, saturating_ops_clamp)
+{
+    // setup
+    using T = std::uint16_t;
+    using S = std::int16_t;
+    const patomic_ops_transaction_arithmetic_t& ops = pat.ops.arithmetic_ops;
+    ASSERT_NE(nullptr, ops.fp_add_sat);
+    ASSERT_NE(nullptr, ops.fp_sub_sat);
+    ASSERT_NE(nullptr, ops.fp_uadd_sat);
+    ASSERT_NE(nullptr, ops.fp_usub_sat);
+    ASSERT_NE(nullptr, ops.fp_fetch_add_sat);
+    ASSERT_NE(nullptr, ops.fp_fetch_sub_sat);
+    ASSERT_NE(nullptr, ops.fp_fetch_uadd_sat);
+    ASSERT_NE(nullptr, ops.fp_fetch_usub_sat);
+    const patomic_transaction_config_t config = make_config(sizeof(T));
+    patomic_transaction_result_t result {};
+    const auto as_unsigned = [](S value) noexcept -> T {
+        return static_cast<T>(value);
+    };
+    constexpr S s_max = std::numeric_limits<S>::max();
+    constexpr S s_min = std::numeric_limits<S>::min();
+    constexpr T u_max = std::numeric_limits<T>::max();
+    const T two = 2;
+    const T minus_two = as_unsigned(-2);
+    T obj {};
+    T res {};
+
+    // test signed
+    obj = as_unsigned(s_max - 1);
+    ops.fp_add_sat(&obj, &two, config, &result);
+    EXPECT_EQ(0ul, result.status);
+    EXPECT_EQ(as_unsigned(s_max), obj);
+    obj = as_unsigned(s_min + 1);
+    ops.fp_fetch_sub_sat(&obj, &two, &res, config, &result);
+    EXPECT_EQ(as_unsigned(s_min + 1), res);
+    EXPECT_EQ(as_unsigned(s_min), obj);
+    obj = as_unsigned(s_min + 1);
+    ops.fp_fetch_add_sat(&obj, &minus_two, &res, config, &result);
+    EXPECT_EQ(as_unsigned(s_min), obj);
+    obj = as_unsigned(s_max - 1);
+    ops.fp_sub_sat(&obj, &minus_two, config, &result);
+    EXPECT_EQ(as_unsigned(s_max), obj);
+    obj = as_unsigned(-1);
+    ops.fp_add_sat(&obj, &two, config, &result);
+    EXPECT_EQ(1u, obj);
+    obj = 0;
+    ops.fp_sub_sat(&obj, &two, config, &result);
+    EXPECT_EQ(minus_two, obj);
+    const T lowest = as_unsigned(s_min);
+    ops.fp_sub_sat(&obj, &lowest, config, &result);
+    EXPECT_EQ(as_unsigned(s_max - 1), obj);
+    obj = 0;
+    ops.fp_sub_sat(&obj, &lowest, config, &result);
+    EXPECT_EQ(as_unsigned(s_max), obj);
+
+    // test unsigned
+    obj = static_cast<T>(u_max - 1u);
+    ops.fp_fetch_uadd_sat(&obj, &two, &res, config, &result);
+    EXPECT_EQ(static_cast<T>(u_max - 1u), res);
+    EXPECT_EQ(u_max, obj);
+    obj = 1;
+    ops.fp_usub_sat(&obj, &two, config, &result);
+    EXPECT_EQ(0u, obj);
+    obj = 5;
+    ops.fp_uadd_sat(&obj, &two, config, &result);
+    EXPECT_EQ(7u, obj);
+    ops.fp_fetch_usub_sat(&obj, &two, &res, config, &result);
+    EXPECT_EQ(7u, res);
+    EXPECT_EQ(5u, obj);
+}
+
+/// @brief Concurrent emulated transactions are serialized, so no updates are
+///        lost.
+TEST_F(BtApiTransactionLock, concurrent_ops_are_serialized)
+{
+    // setup
+    using T = std::uint64_t;
+    const auto fp_add = pat.ops.arithmetic_ops.fp_add;
+    const auto fp_generic = pat.ops.special_ops.fp_generic;
+    constexpr unsigned int thread_count = 4;
+    constexpr unsigned int iterations = 10000;
+    T obj = 0;
+    T plain = 0;
+
+    // test
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]() noexcept {
+            const T one = 1;
+            const patomic_transaction_config_t config = make_config(sizeof(T));
+            patomic_transaction_result_t result {};
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                fp_add(&obj, &one, config, &result);
+                fp_generic([](void *ctx) noexcept {
+                    ++*static_cast<T *>(ctx);
+                }, &plain, config, &result);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(thread_count * iterations, obj);
+    EXPECT_EQ(thread_count * iterations, plain);
+}
+
+/// @brief Multi op applies heterogeneous operations in order and reports the
+///        original values, or applies none of them if a comparison fails.
+TEST_F(BtApiTransactionLock, multi_op_applies_all_or_none)
+{
+    // setup
+    using T = std::uint32_t;
+    const auto fp_multi_op = pat.ops.special_ops.fp_multi_op;
+    ASSERT_NE(nullptr, fp_multi_op);
+    patomic_transaction_config_wfb_t config {};
+    config.width = sizeof(T);
+    config.attempts = 1ul;
+    config.fallback_attempts = 1ul;
+    patomic_transaction_result_wfb_t result {};
+    T objs[4] = { 10, 0x0f, 7, 1 };
+    const T args[4] = { 5, 0xf0, 9, 2 };
+    T rets[4] = {};
+    rets[3] = 1;
+    const patomic_transaction_op_t ops[4] = {
+        { patomic_transaction_op_ADD, &objs[0], &args[0], &rets[0] },
+        { patomic_transaction_op_OR, &objs[1], &args[1], &rets[1] },
+        { patomic_transaction_op_STORE, &objs[2], &args[2], nullptr },
+        { patomic_transaction_op_CMPXCHG, &objs[3], &args[3], &rets[3] }
+    };
+
+    // test all applied
+    EXPECT_EQ(1, fp_multi_op(ops, 4u, config, &result));
+    EXPECT_EQ(0ul, result.status);
+    EXPECT_EQ(15u, objs[0]);
+    EXPECT_EQ(0xffu, objs[1]);
+    EXPECT_EQ(9u, objs[2]);
+    EXPECT_EQ(2u, objs[3]);
+    EXPECT_EQ(10u, rets[0]);
+    EXPECT_EQ(0x0fu, rets[1]);
+    EXPECT_EQ(1u, rets[3]);
+
+    // test none applied
+    EXPECT_EQ(0, fp_multi_op(ops, 4u, config, &result));
+    EXPECT_EQ(0ul, result.status);
+    EXPECT_EQ(0ul, result.fallback_status);
+    EXPECT_EQ(15u, objs[0]);
+    EXPECT_EQ(0xffu, objs[1]);
+    EXPECT_EQ(2u, objs[3]);
+    EXPECT_EQ(15u, rets[0]);
+    EXPECT_EQ(0xffu, rets[1]);
+    EXPECT_EQ(2u, rets[3]);
+}
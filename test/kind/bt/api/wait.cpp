@@ -0,0 +1,137 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <patomic/patomic.h>
+
+#include <test/common/create.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+
+/// @brief Test fixture.
+class BtApiWait : public testing::Test
+{
+public:
+    template <class T>
+    static void
+    wait_is_woken_by_notify(const patomic_t& pat)
+    {
+        // setup
+        const auto& ops = pat.ops;
+        const auto& wait_ops = pat.ops.wait_ops;
+        T obj = 0;
+        const T old = 0;
+        const T desired = 1;
+        ASSERT_NE(nullptr, ops.fp_store);
+        ASSERT_NE(nullptr, ops.fp_load);
+
+        // test
+        std::thread waiter([&]() noexcept {
+            wait_ops.fp_wait(&obj, &old);
+        });
+        ops.fp_store(&obj, &desired);
+        wait_ops.fp_notify_all(&obj);
+        waiter.join();
+        T res = 0;
+        ops.fp_load(&obj, &res);
+        EXPECT_EQ(desired, res);
+    }
+};
+
+
+/// @brief The WAIT ops are either all null or all non-null.
+TEST_F(BtApiWait, wait_ops_are_all_or_nothing)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    const patomic_explicit_t pat_explicit = test::create_best_explicit<std::uint32_t>();
+    constexpr unsigned int opcat = patomic_opcat_WAIT;
+
+    // test
+    EXPECT_EQ(patomic_feature_check_any(&pat.ops, opcat),
+              patomic_feature_check_all(&pat.ops, opcat));
+    EXPECT_EQ(patomic_feature_check_any_explicit(&pat_explicit.ops, opcat),
+              patomic_feature_check_all_explicit(&pat_explicit.ops, opcat));
+}
+
+/// @brief Waiting with a value which already differs returns immediately.
+TEST_F(BtApiWait, wait_returns_immediately_if_value_differs)
+{
+    // setup
+    const patomic_t pat = test::create_best<std::uint32_t>();
+    if (pat.ops.wait_ops.fp_wait_timed == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; wait is not supported";
+    }
+    std::uint32_t obj = 5;
+    const std::uint32_t old = 4;
+
+    // test
+    pat.ops.wait_ops.fp_wait(&obj, &old);
+    EXPECT_EQ(1, pat.ops.wait_ops.fp_wait_timed(&obj, &old, 0ul));
+}
+
+/// @brief Waiting with a timeout on a value which does not change times out.
+TEST_F(BtApiWait, wait_timed_times_out_if_value_unchanged)
+{
+    // setup
+    const patomic_t pat_32 = test::create_best<std::uint32_t>();
+    const patomic_t pat_8 = test::create_best<std::uint8_t>();
+    if (pat_32.ops.wait_ops.fp_wait_timed == nullptr ||
+        pat_8.ops.wait_ops.fp_wait_timed == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; wait is not supported";
+    }
+    std::uint32_t obj_32 = 5;
+    std::uint8_t obj_8 = 5;
+
+    // test
+    EXPECT_EQ(0, pat_32.ops.wait_ops.fp_wait_timed(&obj_32, &obj_32, 1000ul));
+    EXPECT_EQ(0, pat_8.ops.wait_ops.fp_wait_timed(&obj_8, &obj_8, 1000ul));
+}
+
+/// @brief A thread blocked in wait is unblocked by a store followed by a
+///        notify, for objects waited on both directly and indirectly.
+TEST_F(BtApiWait, wait_is_woken_by_notify)
+{
+    // setup
+    const patomic_t pat_32 = test::create_best<std::uint32_t>();
+    const patomic_t pat_16 = test::create_best<std::uint16_t>();
+    if (pat_32.ops.wait_ops.fp_wait == nullptr ||
+        pat_16.ops.wait_ops.fp_wait == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; wait is not supported";
+    }
+
+    // test
+    wait_is_woken_by_notify<std::uint32_t>(pat_32);
+    wait_is_woken_by_notify<std::uint16_t>(pat_16);
+}
+
+/// @brief A thread blocked in an explicit wait is unblocked by a store
+///        followed by a notify.
+TEST_F(BtApiWait, explicit_wait_is_woken_by_notify)
+{
+    // setup
+    const patomic_explicit_t pat = test::create_best_explicit<std::uint64_t>();
+    const auto& ops = pat.ops;
+    if (ops.wait_ops.fp_wait == nullptr || ops.fp_store == nullptr)
+    {
+        GTEST_SKIP() << "Skipping; wait or store is not supported";
+    }
+    std::uint64_t obj = 0;
+    const std::uint64_t old = 0;
+    const std::uint64_t desired = 1;
+
+    // test
+    std::thread waiter([&]() noexcept {
+        ops.wait_ops.fp_wait(&obj, &old, patomic_ACQUIRE);
+    });
+    ops.fp_store(&obj, &desired, patomic_RELEASE);
+    ops.wait_ops.fp_notify_one(&obj);
+    waiter.join();
+    EXPECT_EQ(1, ops.wait_ops.fp_wait_timed(&obj, &old, patomic_ACQUIRE, 0ul));
+}
@@ -91,6 +91,8 @@ TEST_F(BtDeathInvalidOrder, explicit_any)
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_strong, p, p, p, param.order, patomic_RELAXED);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_weak, p, p, p, patomic_SEQ_CST, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_strong, p, p, p, patomic_SEQ_CST, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, p, test::decline_update, nullptr, param.order, patomic_RELAXED, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, p, test::decline_update, nullptr, patomic_SEQ_CST, param.order, p);
 
         // bitwise
         ASSERT_DEATH_IF_NON_NULL(ops.bitwise_ops.fp_test, p, 0, param.order);
@@ -114,11 +116,27 @@ TEST_F(BtDeathInvalidOrder, explicit_any)
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_inc, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_dec, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_neg, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_min, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_max, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umin, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umax, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_add_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_sub_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_uadd_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_usub_sat, p, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add, p, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub, p, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_inc, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_dec, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_neg, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_min, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_max, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umin, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umax, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_uadd_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_usub_sat, p, p, param.order, p);
     }
 }
 
@@ -164,6 +182,7 @@ TEST_F(BtDeathInvalidOrder, explicit_fail)
             // attempt to call cmpxchg operations if non-null with invalid fail order
             ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_weak, p, p, p, param.order, fail_order);
             ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_strong, p, p, p, param.order, fail_order);
+            ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, p, test::decline_update, nullptr, param.order, fail_order, p);
         }
     }
 }
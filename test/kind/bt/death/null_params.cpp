@@ -76,6 +76,8 @@ TEST_F(BtDeathNullParams, implicit)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_exchange, a, b, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_cmpxchg_weak, a, b, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_cmpxchg_strong, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.xchg_ops.fp_fetch_update, a, test::decline_update, nullptr, b);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, a, nullptr, nullptr, b);
 
         // bitwise
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.bitwise_ops.fp_test, a, 0);
@@ -99,11 +101,27 @@ TEST_F(BtDeathNullParams, implicit)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_inc, a);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_dec, a);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_neg, a);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_min, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_max, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_umin, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_umax, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_add_sat, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_sub_sat, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_uadd_sat, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_usub_sat, a, b);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_add, a, b, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_sub, a, b, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_inc, a, b);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_dec, a, b);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_neg, a, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_min, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_max, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_umin, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_umax, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_add_sat, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_sub_sat, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_uadd_sat, a, b, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_usub_sat, a, b, c);
     }
 }
 
@@ -152,6 +170,8 @@ TEST_F(BtDeathNullParams, explicit)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_exchange, a, b, param.order, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_cmpxchg_weak, a, b, c, param.order, patomic_RELAXED);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.xchg_ops.fp_cmpxchg_strong, a, b, c, param.order, patomic_RELAXED);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.xchg_ops.fp_fetch_update, a, test::decline_update, nullptr, param.order, patomic_RELAXED, b);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, a, nullptr, nullptr, param.order, patomic_RELAXED, b);
 
         // bitwise
         if (patomic_is_valid_load_order(param.order))
@@ -178,11 +198,27 @@ TEST_F(BtDeathNullParams, explicit)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_inc, a, param.order);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_dec, a, param.order);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 1, ops.arithmetic_ops.fp_neg, a, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_min, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_max, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_umin, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_umax, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_add_sat, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_sub_sat, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_uadd_sat, a, b, param.order);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_usub_sat, a, b, param.order);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_add, a, b, param.order, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_sub, a, b, param.order, c);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_inc, a, param.order, b);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_dec, a, param.order, b);
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_fetch_neg, a, param.order, b);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_min, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_max, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_umin, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_umax, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_add_sat, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_sub_sat, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_uadd_sat, a, b, param.order, c);
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_usub_sat, a, b, param.order, c);
     }
 }
 
@@ -238,6 +274,26 @@ TEST_F(BtDeathNullParams, transaction)
             cxs[1] = as_cx(s, t, u);
             return &cxs[0];
         };
+        const auto as_lds = [](void *p, void *q, void *r, void *s) noexcept {
+            static patomic_transaction_load_t lds[2] {};
+            lds[0].obj = p;
+            lds[0].ret = q;
+            lds[1].obj = r;
+            lds[1].ret = s;
+            return &lds[0];
+        };
+        const auto as_ops = [](void *p, void *q, void *r, void *s, void *t, void *u) noexcept {
+            static patomic_transaction_op_t ops[2] {};
+            ops[0].kind = patomic_transaction_op_CMPXCHG;
+            ops[0].obj = p;
+            ops[0].arg = q;
+            ops[0].ret = r;
+            ops[1].kind = patomic_transaction_op_CMPXCHG;
+            ops[1].obj = s;
+            ops[1].arg = t;
+            ops[1].ret = u;
+            return &ops[0];
+        };
         const auto as_fn = [](void *p) noexcept {
             return reinterpret_cast<void(*)(void *)>(p);
         };
@@ -287,11 +343,27 @@ TEST_F(BtDeathNullParams, transaction)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_inc, a, cfg, as_res(b));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_dec, a, cfg, as_res(b));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.arithmetic_ops.fp_neg, a, cfg, as_res(b));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_min, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_max, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_umin, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_umax, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_add_sat, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_sub_sat, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_uadd_sat, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_usub_sat, a, b, cfg, as_res(c));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_add, a, b, c, cfg, as_res(d));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_sub, a, b, c, cfg, as_res(d));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_inc, a, b, cfg, as_res(c));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_dec, a, b, cfg, as_res(c));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.arithmetic_ops.fp_fetch_neg, a, b, cfg, as_res(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_min, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_max, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_umin, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_umax, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_add_sat, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_sub_sat, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_uadd_sat, a, b, c, cfg, as_res(d));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 4, ops.arithmetic_ops.fp_fetch_usub_sat, a, b, c, cfg, as_res(d));
 
         // special
         unsigned char unused {};
@@ -300,10 +372,12 @@ TEST_F(BtDeathNullParams, transaction)
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 7, ops.special_ops.fp_multi_cmpxchg, as_cxs(a, b, c, d, e, f), 2, cfg_wfb, as_res_wfb(g));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 2, ops.special_ops.fp_generic, as_fn(a), _, cfg, as_res(b));
         ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 3, ops.special_ops.fp_generic_wfb, as_fn(a), _, as_fn(b), _, cfg_wfb, as_res_wfb(c));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 5, ops.special_ops.fp_multi_load, as_lds(a, b, c, d), 2, cfg, as_res(e));
+        ASSERT_DEATH_IF_NON_NULL_VEC(ptrs, 7, ops.special_ops.fp_multi_op, as_ops(a, b, c, d, e, f), 2, cfg_wfb, as_res_wfb(g));
 
         // flag
-        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_test, as_flag(a));
-        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_test_set, as_flag(a));
-        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_clear, as_flag(a));
+        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_test, as_flag(nullptr));
+        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_test_set, as_flag(nullptr));
+        ASSERT_DEATH_IF_NON_NULL(ops.flag_ops.fp_clear, as_flag(nullptr));
     }
 }
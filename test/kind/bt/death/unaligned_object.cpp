@@ -57,6 +57,7 @@ TEST_F(BtDeathUnalignedObject, implicit)
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_exchange, p, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_weak, p, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_strong, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, p, test::decline_update, nullptr, p);
 
         // bitwise
         ASSERT_DEATH_IF_NON_NULL(ops.bitwise_ops.fp_test, p, 0);
@@ -80,11 +81,27 @@ TEST_F(BtDeathUnalignedObject, implicit)
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_inc, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_dec, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_neg, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_min, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_max, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umin, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umax, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_add_sat, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_sub_sat, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_uadd_sat, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_usub_sat, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add, p, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub, p, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_inc, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_dec, p, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_neg, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_min, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_max, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umin, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umax, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add_sat, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub_sat, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_uadd_sat, p, p, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_usub_sat, p, p, p);
     }
 }
 
@@ -135,6 +152,7 @@ TEST_F(BtDeathUnalignedObject, explicit)
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_exchange, p, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_weak, p, p, p, param.order, patomic_RELAXED);
         ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_cmpxchg_strong, p, p, p, param.order, patomic_RELAXED);
+        ASSERT_DEATH_IF_NON_NULL(ops.xchg_ops.fp_fetch_update, p, test::decline_update, nullptr, param.order, patomic_RELAXED, p);
 
         // bitwise
         if (patomic_is_valid_load_order(param.order))
@@ -161,10 +179,26 @@ TEST_F(BtDeathUnalignedObject, explicit)
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_inc, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_dec, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_neg, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_min, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_max, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umin, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_umax, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_add_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_sub_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_uadd_sat, p, p, param.order);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_usub_sat, p, p, param.order);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add, p, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub, p, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_inc, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_dec, p, param.order, p);
         ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_neg, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_min, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_max, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umin, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_umax, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_add_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_sub_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_uadd_sat, p, p, param.order, p);
+        ASSERT_DEATH_IF_NON_NULL(ops.arithmetic_ops.fp_fetch_usub_sat, p, p, param.order, p);
     }
 }
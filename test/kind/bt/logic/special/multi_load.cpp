@@ -0,0 +1,56 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <test/common/skip.hpp>
+#include <test/common/transaction.hpp>
+
+#include <test/suite/bt_logic.hpp>
+
+#include <vector>
+
+
+#define SKIP_NULL_OP_FP_MULTI_LOAD(id, ops) \
+    SKIP_NULL_OP_FP(id, (ops).special_ops.fp_multi_load, "multi_load")
+
+
+/// @brief Check that the non-atomic logic of transaction multi_load works
+///        correctly.
+TEST_P(BtLogicTransaction, fp_multi_load)
+{
+    // check pre-condition
+    const auto& p = GetParam();
+    SKIP_NULL_OP_FP_MULTI_LOAD(p.id, m_ops);
+
+    // test zero
+    ASSERT_TSX_ZERO(m_ops.special_ops.fp_multi_load);
+
+    // test flag set
+    ASSERT_TSX_FLAG_SET(m_ops.special_ops.fp_multi_load);
+
+    // make sure width is non-zero
+    m_config.width = 4;
+
+    // setup params
+    constexpr std::size_t count = 5;
+    std::vector<unsigned char> objs(count * m_config.width);
+    std::vector<unsigned char> rets(count * m_config.width);
+    std::vector<patomic_transaction_load_t> lds(count);
+    for (std::size_t i = 0; i < objs.size(); ++i)
+    {
+        objs[i] = static_cast<unsigned char>(i + 1u);
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        lds[i].obj = &objs[i * m_config.width];
+        lds[i].ret = &rets[i * m_config.width];
+    }
+
+    // test
+    patomic_transaction_result_t result {};
+    m_ops.special_ops.fp_multi_load(lds.data(), lds.size(), m_config, &result);
+    ADD_FAILURE_TSX_SUCCESS(m_config, result);
+    if (result.status == 0ul)
+    {
+        ASSERT_EQ(objs, rets);
+    }
+}
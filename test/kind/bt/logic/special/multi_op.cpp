@@ -0,0 +1,94 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+#include <test/common/skip.hpp>
+#include <test/common/transaction.hpp>
+
+#include <test/suite/bt_logic.hpp>
+
+#include <cstdint>
+#include <vector>
+
+
+#define SKIP_NULL_OP_FP_MULTI_OP(id, ops) \
+    SKIP_NULL_OP_FP(id, (ops).special_ops.fp_multi_op, "multi_op")
+
+
+/// @brief Check that the non-atomic logic of transaction multi_op works
+///        correctly.
+TEST_P(BtLogicTransaction, fp_multi_op)
+{
+    // check pre-condition
+    const auto& p = GetParam();
+    SKIP_NULL_OP_FP_MULTI_OP(p.id, m_ops);
+
+    // test zero
+    ASSERT_TSX_ZERO_WFB(m_ops.special_ops.fp_multi_op);
+
+    // test flag set
+    ASSERT_TSX_FLAG_SET_WFB(m_ops.special_ops.fp_multi_op);
+
+    // make sure width is non-zero
+    using T = std::uint32_t;
+    m_config_wfb.width = sizeof(T);
+
+    // setup params
+    const std::vector<int> kinds {
+        patomic_transaction_op_STORE,
+        patomic_transaction_op_EXCHANGE,
+        patomic_transaction_op_CMPXCHG,
+        patomic_transaction_op_ADD,
+        patomic_transaction_op_SUB,
+        patomic_transaction_op_AND,
+        patomic_transaction_op_OR,
+        patomic_transaction_op_XOR
+    };
+    const T init = 0x0ff0u;
+    const T arg = 0x3c3cu;
+    const std::vector<T> expected {
+        arg, arg, arg,
+        static_cast<T>(init + arg),
+        static_cast<T>(init - arg),
+        static_cast<T>(init & arg),
+        static_cast<T>(init | arg),
+        static_cast<T>(init ^ arg)
+    };
+    std::vector<T> objs(kinds.size(), init);
+    std::vector<T> args(kinds.size(), arg);
+    std::vector<T> rets(kinds.size(), init);
+    std::vector<patomic_transaction_op_t> ops(kinds.size());
+    for (std::size_t i = 0; i < kinds.size(); ++i)
+    {
+        ops[i].kind = kinds[i];
+        ops[i].obj = &objs[i];
+        ops[i].arg = &args[i];
+        ops[i].ret = &rets[i];
+    }
+
+    // test all applied
+    patomic_transaction_result_wfb_t result {};
+    int ok = m_ops.special_ops.fp_multi_op(
+        ops.data(), ops.size(), m_config_wfb, &result
+    );
+    ADD_FAILURE_TSX_SUCCESS_WFB(m_config_wfb, result);
+    if (result.status == 0ul)
+    {
+        ASSERT_EQ(1, ok);
+        ASSERT_EQ(expected, objs);
+        ASSERT_EQ(std::vector<T>(kinds.size(), init), rets);
+    }
+
+    // test none applied when a comparison fails
+    objs = std::vector<T>(kinds.size(), init);
+    rets[2] = static_cast<T>(~init);
+    ok = m_ops.special_ops.fp_multi_op(
+        ops.data(), ops.size(), m_config_wfb, &result
+    );
+    ADD_FAILURE_TSX_SUCCESS_WFB(m_config_wfb, result);
+    ASSERT_EQ(0, ok);
+    ASSERT_EQ(std::vector<T>(kinds.size(), init), objs);
+    if (result.fallback_status == 0ul)
+    {
+        ASSERT_EQ(std::vector<T>(kinds.size(), init), rets);
+    }
+}
@@ -0,0 +1,200 @@
+// Copyright (c) doodspav.
+// SPDX-License-Identifier: LGPL-3.0-or-later WITH LGPL-3.0-linking-exception
+
+extern "C" {
+#include <patomic/config.h>
+#include <patomic/internal/transaction.h>
+}
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+
+/// @brief Test fixture.
+class UtInternalTransaction : public testing::Test
+{
+public:
+    static constexpr bool is_supported =
+        PATOMIC_HAS_ATOMIC && PATOMIC_HAS_STDATOMIC_H;
+
+    void
+    SetUp() override
+    {
+        if (!is_supported)
+        {
+            GTEST_SKIP() << "Skipping; transaction stats are not supported";
+        }
+        patomic_transaction_stats_snapshot(before.get());
+    }
+
+    std::unique_ptr<patomic_transaction_stats_t> before {
+        new patomic_transaction_stats_t {}
+    };
+    std::unique_ptr<patomic_transaction_stats_t> after {
+        new patomic_transaction_stats_t {}
+    };
+};
+
+
+/// @brief Test fixture for transaction safe memory kernels.
+class UtInternalTransactionKernels : public testing::Test
+{
+public:
+    static constexpr std::size_t max_offset = 32;
+    static constexpr std::size_t max_count = 80;
+    static constexpr unsigned char guard = 0xA5;
+
+    static std::vector<unsigned char>
+    make_pattern(std::size_t size)
+    {
+        std::vector<unsigned char> buf(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            buf[i] = static_cast<unsigned char>((i * 7u) + 3u);
+        }
+        return buf;
+    }
+};
+
+/// @brief Definition needed pre-C++17 since guard is bound to references.
+constexpr unsigned char UtInternalTransactionKernels::guard;
+
+
+/// @brief Recording a primary path updates the calls, attempts, exit code,
+///        and exit info counters.
+TEST_F(UtInternalTransaction, stats_record_primary)
+{
+    // setup
+    const unsigned long status = PATOMIC_INTERNAL_TRANSACTION_STATUS_CREATE(
+        patomic_TABORT_CONFLICT, patomic_TINFO_RETRY | patomic_TINFO_NESTED, 0
+    );
+
+    // test
+    patomic_internal_transaction_stats_record(status, 3ul, 0);
+    patomic_transaction_stats_snapshot(after.get());
+    EXPECT_EQ(1ul, after->calls - before->calls);
+    EXPECT_EQ(3ul, after->attempts_made - before->attempts_made);
+    EXPECT_EQ(0ul, after->fallback_calls - before->fallback_calls);
+    EXPECT_EQ(1ul, after->exit_codes[patomic_TABORT_CONFLICT] -
+                   before->exit_codes[patomic_TABORT_CONFLICT]);
+    EXPECT_EQ(1ul, after->exit_info[0] - before->exit_info[0]);
+    EXPECT_EQ(1ul, after->exit_info[1] - before->exit_info[1]);
+    EXPECT_EQ(before->abort_reasons[0], after->abort_reasons[0]);
+}
+
+/// @brief Recording an explicitly aborted fallback path updates the fallback
+///        and abort reason counters.
+TEST_F(UtInternalTransaction, stats_record_fallback_explicit_abort)
+{
+    // setup
+    const unsigned long status = PATOMIC_INTERNAL_TRANSACTION_STATUS_CREATE(
+        patomic_TABORT_EXPLICIT, patomic_TINFO_NONE, 7
+    );
+
+    // test
+    patomic_internal_transaction_stats_record(status, 2ul, 1);
+    patomic_transaction_stats_snapshot(after.get());
+    EXPECT_EQ(0ul, after->calls - before->calls);
+    EXPECT_EQ(1ul, after->fallback_calls - before->fallback_calls);
+    EXPECT_EQ(2ul, after->fallback_attempts_made - before->fallback_attempts_made);
+    EXPECT_EQ(1ul, after->exit_codes[patomic_TABORT_EXPLICIT] -
+                   before->exit_codes[patomic_TABORT_EXPLICIT]);
+    EXPECT_EQ(1ul, after->abort_reasons[7] - before->abort_reasons[7]);
+}
+
+/// @brief Recording a successful path updates only the success exit code.
+TEST_F(UtInternalTransaction, stats_record_success)
+{
+    // test
+    patomic_internal_transaction_stats_record(0ul, 1ul, 0);
+    patomic_transaction_stats_snapshot(after.get());
+    EXPECT_EQ(1ul, after->exit_codes[patomic_TSUCCESS] -
+                   before->exit_codes[patomic_TSUCCESS]);
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(before->exit_info[i], after->exit_info[i]);
+    }
+}
+
+/// @brief Copying matches memcpy for all relative alignments and counts, and
+///        does not write outside the destination.
+TEST_F(UtInternalTransactionKernels, memcpy_matches_memcpy)
+{
+    // setup
+    const std::size_t size = max_offset + max_count + max_offset;
+    const std::vector<unsigned char> src = make_pattern(size);
+    std::vector<unsigned char> dest(size);
+
+    // test
+    for (std::size_t dest_off = 0; dest_off < max_offset; ++dest_off)
+    {
+        for (std::size_t src_off = 0; src_off < max_offset; ++src_off)
+        {
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                std::memset(dest.data(), guard, size);
+                patomic_internal_transaction_memcpy(
+                    dest.data() + dest_off, src.data() + src_off, count
+                );
+                ASSERT_EQ(0, std::memcmp(dest.data() + dest_off,
+                                         src.data() + src_off, count));
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if (i < dest_off || i >= dest_off + count)
+                    {
+                        ASSERT_EQ(guard, dest[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// @brief Comparing gives the same ordering as memcmp for a difference at
+///        every position, for all relative alignments.
+TEST_F(UtInternalTransactionKernels, memcmp_matches_memcmp)
+{
+    // setup
+    const std::size_t size = max_offset + max_count;
+    const std::vector<unsigned char> pattern = make_pattern(size);
+    std::vector<unsigned char> lhs = pattern;
+    std::vector<unsigned char> rhs = pattern;
+    const auto sign = [](int i) noexcept -> int {
+        return (i > 0) - (i < 0);
+    };
+
+    // test
+    for (std::size_t lhs_off = 0; lhs_off < max_offset; ++lhs_off)
+    {
+        for (std::size_t rhs_off = 0; rhs_off < max_offset; ++rhs_off)
+        {
+            const std::size_t count = max_count;
+            std::memcpy(rhs.data() + rhs_off, lhs.data() + lhs_off, count);
+            ASSERT_EQ(0, patomic_internal_transaction_memcmp(
+                lhs.data() + lhs_off, rhs.data() + rhs_off, count
+            ));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                for (const unsigned char delta : { 1u, 0xFFu })
+                {
+                    unsigned char& byte = rhs[rhs_off + i];
+                    const unsigned char old = byte;
+                    byte = static_cast<unsigned char>(old + delta);
+                    const int expected = sign(std::memcmp(
+                        lhs.data() + lhs_off, rhs.data() + rhs_off, count
+                    ));
+                    ASSERT_EQ(expected, patomic_internal_transaction_memcmp(
+                        lhs.data() + lhs_off, rhs.data() + rhs_off, count
+                    ));
+                    ASSERT_EQ(0, patomic_internal_transaction_memcmp(
+                        lhs.data() + lhs_off, rhs.data() + rhs_off, i
+                    ));
+                    byte = old;
+                }
+            }
+        }
+    }
+}
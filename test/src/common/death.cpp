@@ -38,4 +38,11 @@ KilledByAbort()
 }
 
 
+int
+decline_update(const void *, void *, void *) noexcept
+{
+    return 0;
+}
+
+
 }  // namespace test
@@ -130,6 +130,7 @@ make_ops_all_nonnull_except_transaction_specific(void(*nonnull_value)()) noexcep
     ops.xchg_ops.fp_exchange       = non_null;
     ops.xchg_ops.fp_cmpxchg_weak   = non_null;
     ops.xchg_ops.fp_cmpxchg_strong = non_null;
+    ops.xchg_ops.fp_fetch_update   = non_null;
     // BIT
     ops.bitwise_ops.fp_test       = non_null;
     ops.bitwise_ops.fp_test_compl = non_null;
@@ -151,12 +152,28 @@ make_ops_all_nonnull_except_transaction_specific(void(*nonnull_value)()) noexcep
     ops.arithmetic_ops.fp_inc = non_null;
     ops.arithmetic_ops.fp_dec = non_null;
     ops.arithmetic_ops.fp_neg = non_null;
+    ops.arithmetic_ops.fp_min = non_null;
+    ops.arithmetic_ops.fp_max = non_null;
+    ops.arithmetic_ops.fp_umin = non_null;
+    ops.arithmetic_ops.fp_umax = non_null;
+    ops.arithmetic_ops.fp_add_sat = non_null;
+    ops.arithmetic_ops.fp_sub_sat = non_null;
+    ops.arithmetic_ops.fp_uadd_sat = non_null;
+    ops.arithmetic_ops.fp_usub_sat = non_null;
     // ARI_F
     ops.arithmetic_ops.fp_fetch_add = non_null;
     ops.arithmetic_ops.fp_fetch_sub = non_null;
     ops.arithmetic_ops.fp_fetch_inc = non_null;
     ops.arithmetic_ops.fp_fetch_dec = non_null;
     ops.arithmetic_ops.fp_fetch_neg = non_null;
+    ops.arithmetic_ops.fp_fetch_min = non_null;
+    ops.arithmetic_ops.fp_fetch_max = non_null;
+    ops.arithmetic_ops.fp_fetch_umin = non_null;
+    ops.arithmetic_ops.fp_fetch_umax = non_null;
+    ops.arithmetic_ops.fp_fetch_add_sat = non_null;
+    ops.arithmetic_ops.fp_fetch_sub_sat = non_null;
+    ops.arithmetic_ops.fp_fetch_uadd_sat = non_null;
+    ops.arithmetic_ops.fp_fetch_usub_sat = non_null;
 
     // return fully initialized object
     return ops;
@@ -277,6 +294,67 @@ make_ops_combinations(const std::vector<setters_vf<T>>& setters, void(*nonnull_v
 }
 
 
+template <class T>
+std::vector<test::ops_any_all_vf<T>>
+make_ops_combinations(const std::vector<void(*)(T&, unsigned int&, void(*)())>& setters_void,
+                      const std::vector<void(*)(T&, unsigned int&, void(*)())>& setters_fetch,
+                      void(*nonnull_value)())
+{
+    // setup
+    const auto size_void = (1u << setters_void.size());
+    const auto size_fetch = (1u << setters_fetch.size());
+    std::vector<test::ops_any_all_vf<T>> combinations;
+    combinations.resize(size_void * size_fetch);
+
+    // go through all combinations
+    for (std::size_t i_fetch = 0; i_fetch < size_fetch; ++i_fetch)
+    {
+        for (std::size_t i_void = 0; i_void < size_void; ++i_void)
+        {
+            // set initial values
+            const auto i = i_void + (i_fetch * size_void);
+            combinations[i].all_void = true;
+            combinations[i].all_fetch = true;
+            combinations[i].any_void = false;
+            combinations[i].any_fetch = false;
+
+            // conditionally set void operations
+            for (std::size_t j = 0; j < setters_void.size(); ++j)
+            {
+                if (i_void & (1ull << j))
+                {
+                    setters_void[j](
+                        combinations[i].ops, combinations[i].opkinds_void, nonnull_value);
+                    combinations[i].any_void = true;
+                }
+                else
+                {
+                    combinations[i].all_void = false;
+                }
+            }
+
+            // conditionally set fetch operations
+            for (std::size_t j = 0; j < setters_fetch.size(); ++j)
+            {
+                if (i_fetch & (1ull << j))
+                {
+                    setters_fetch[j](
+                        combinations[i].ops, combinations[i].opkinds_fetch, nonnull_value);
+                    combinations[i].any_fetch = true;
+                }
+                else
+                {
+                    combinations[i].all_fetch = false;
+                }
+            }
+        }
+    }
+
+    // return
+    return combinations;
+}
+
+
 template <class T>
 std::vector<test::ops_any_all<T>>
 make_ops_ldst_combinations(void(*nonnull_value)())
@@ -302,10 +380,12 @@ make_ops_xchg_combinations(void(*nonnull_value)())
     CREATE_SETTER_LAMBDA(exchange, EXCHANGE);
     CREATE_SETTER_LAMBDA(cmpxchg_weak, CMPXCHG_WEAK);
     CREATE_SETTER_LAMBDA(cmpxchg_strong, CMPXCHG_STRONG);
+    CREATE_SETTER_LAMBDA(fetch_update, FETCH_UPDATE);
     const std::vector<void(*)(T&, unsigned int&, void(*)())> setters {
         set_exchange,
         set_cmpxchg_weak,
-        set_cmpxchg_strong
+        set_cmpxchg_strong,
+        set_fetch_update
     };
 
     // create all combinations
@@ -364,22 +444,67 @@ std::vector<test::ops_any_all_vf<T>>
 make_ops_arithmetic_combinations(void(*nonnull_value)())
 {
     // lambda helpers
-    CREATE_SETTER_LAMBDA(add, ADD);
-    CREATE_SETTER_LAMBDA(sub, SUB);
     CREATE_SETTER_LAMBDA(inc, INC);
     CREATE_SETTER_LAMBDA(dec, DEC);
-    CREATE_SETTER_LAMBDA(neg, NEG);
-    CREATE_SETTER_LAMBDA(fetch_add, ADD);
-    CREATE_SETTER_LAMBDA(fetch_sub, SUB);
     CREATE_SETTER_LAMBDA(fetch_inc, INC);
     CREATE_SETTER_LAMBDA(fetch_dec, DEC);
-    CREATE_SETTER_LAMBDA(fetch_neg, NEG);
+    // saturating ops are set alongside add and sub, and min and max ops are
+    // set alongside neg, since each extra setter quadruples the number of
+    // combinations
+    const auto set_add_sat = [](T& ops, unsigned int& opkinds,
+                                void(*nonnull_value)()) noexcept -> void {
+        ops.fp_add = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_add_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_uadd_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_ADD | patomic_opkind_ADD_SAT | patomic_opkind_UADD_SAT;
+    };
+    const auto set_sub_sat = [](T& ops, unsigned int& opkinds,
+                                void(*nonnull_value)()) noexcept -> void {
+        ops.fp_sub = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_sub_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_usub_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_SUB | patomic_opkind_SUB_SAT | patomic_opkind_USUB_SAT;
+    };
+    const auto set_fetch_add_sat = [](T& ops, unsigned int& opkinds,
+                                      void(*nonnull_value)()) noexcept -> void {
+        ops.fp_fetch_add = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_add_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_uadd_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_ADD | patomic_opkind_ADD_SAT | patomic_opkind_UADD_SAT;
+    };
+    const auto set_fetch_sub_sat = [](T& ops, unsigned int& opkinds,
+                                      void(*nonnull_value)()) noexcept -> void {
+        ops.fp_fetch_sub = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_sub_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_usub_sat = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_SUB | patomic_opkind_SUB_SAT | patomic_opkind_USUB_SAT;
+    };
+    const auto set_neg_minmax = [](T& ops, unsigned int& opkinds,
+                                   void(*nonnull_value)()) noexcept -> void {
+        ops.fp_neg = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_min = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_max = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_umin = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_umax = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_NEG | patomic_opkind_MIN | patomic_opkind_MAX |
+                   patomic_opkind_UMIN | patomic_opkind_UMAX;
+    };
+    const auto set_fetch_neg_minmax = [](T& ops, unsigned int& opkinds,
+                                         void(*nonnull_value)()) noexcept -> void {
+        ops.fp_fetch_neg = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_min = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_max = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_umin = test::convertible_to_any<void(*)()> { nonnull_value };
+        ops.fp_fetch_umax = test::convertible_to_any<void(*)()> { nonnull_value };
+        opkinds |= patomic_opkind_NEG | patomic_opkind_MIN | patomic_opkind_MAX |
+                   patomic_opkind_UMIN | patomic_opkind_UMAX;
+    };
     const std::vector<setters_vf<T>> setters {
-        setters_vf<T>().v(set_add).f(set_fetch_add),
-        setters_vf<T>().v(set_sub).f(set_fetch_sub),
+        setters_vf<T>().v(set_add_sat).f(set_fetch_add_sat),
+        setters_vf<T>().v(set_sub_sat).f(set_fetch_sub_sat),
         setters_vf<T>().v(set_inc).f(set_fetch_inc),
         setters_vf<T>().v(set_dec).f(set_fetch_dec),
-        setters_vf<T>().v(set_neg).f(set_fetch_neg),
+        setters_vf<T>().v(set_neg_minmax).f(set_fetch_neg_minmax),
     };
 
     // create all combinations
@@ -420,17 +545,19 @@ make_ops_ldst_array(const T& ldst_ops) noexcept
 
 
 template <class T>
-std::array<void(*)(), 3>
+std::array<void(*)(), 4>
 make_ops_xchg_array(const T& xchg_ops) noexcept
 {
     // lambda helpers
     CREATE_GETTER_LAMBDA(exchange);
     CREATE_GETTER_LAMBDA(cmpxchg_weak);
     CREATE_GETTER_LAMBDA(cmpxchg_strong);
-    const std::array<void(*(*)(const T&))(), 3> getters {
+    CREATE_GETTER_LAMBDA(fetch_update);
+    const std::array<void(*(*)(const T&))(), 4> getters {
         get_exchange,
         get_cmpxchg_weak,
-        get_cmpxchg_strong
+        get_cmpxchg_strong,
+        get_fetch_update
     };
 
     // create array
@@ -489,7 +616,7 @@ make_ops_binary_array(const T& binary_ops) noexcept
 
 
 template <class T>
-std::array<void(*)(), 10>
+std::array<void(*)(), 26>
 make_ops_arithmetic_array(const T& arithmetic_ops) noexcept
 {
     // lambda helpers
@@ -498,22 +625,54 @@ make_ops_arithmetic_array(const T& arithmetic_ops) noexcept
     CREATE_GETTER_LAMBDA(inc);
     CREATE_GETTER_LAMBDA(dec);
     CREATE_GETTER_LAMBDA(neg);
+    CREATE_GETTER_LAMBDA(min);
+    CREATE_GETTER_LAMBDA(max);
+    CREATE_GETTER_LAMBDA(umin);
+    CREATE_GETTER_LAMBDA(umax);
+    CREATE_GETTER_LAMBDA(add_sat);
+    CREATE_GETTER_LAMBDA(sub_sat);
+    CREATE_GETTER_LAMBDA(uadd_sat);
+    CREATE_GETTER_LAMBDA(usub_sat);
     CREATE_GETTER_LAMBDA(fetch_add);
     CREATE_GETTER_LAMBDA(fetch_sub);
     CREATE_GETTER_LAMBDA(fetch_inc);
     CREATE_GETTER_LAMBDA(fetch_dec);
     CREATE_GETTER_LAMBDA(fetch_neg);
-    const std::array<void(*(*)(const T&))(), 10> getters {
+    CREATE_GETTER_LAMBDA(fetch_min);
+    CREATE_GETTER_LAMBDA(fetch_max);
+    CREATE_GETTER_LAMBDA(fetch_umin);
+    CREATE_GETTER_LAMBDA(fetch_umax);
+    CREATE_GETTER_LAMBDA(fetch_add_sat);
+    CREATE_GETTER_LAMBDA(fetch_sub_sat);
+    CREATE_GETTER_LAMBDA(fetch_uadd_sat);
+    CREATE_GETTER_LAMBDA(fetch_usub_sat);
+    const std::array<void(*(*)(const T&))(), 26> getters {
         get_add,
         get_sub,
         get_inc,
         get_dec,
         get_neg,
+        get_min,
+        get_max,
+        get_umin,
+        get_umax,
+        get_add_sat,
+        get_sub_sat,
+        get_uadd_sat,
+        get_usub_sat,
         get_fetch_add,
         get_fetch_sub,
         get_fetch_inc,
         get_fetch_dec,
-        get_fetch_neg
+        get_fetch_neg,
+        get_fetch_min,
+        get_fetch_max,
+        get_fetch_umin,
+        get_fetch_umax,
+        get_fetch_add_sat,
+        get_fetch_sub_sat,
+        get_fetch_uadd_sat,
+        get_fetch_usub_sat
     };
 
     // create array
@@ -521,6 +680,177 @@ make_ops_arithmetic_array(const T& arithmetic_ops) noexcept
 }
 
 
+template <class T>
+std::vector<test::ops_any_all<T>>
+make_ops_wait_combinations(void(*nonnull_value)())
+{
+    // lambda helpers
+    CREATE_SETTER_LAMBDA(wait, WAIT);
+    CREATE_SETTER_LAMBDA(wait_timed, WAIT_TIMED);
+    CREATE_SETTER_LAMBDA(notify_one, NOTIFY_ONE);
+    CREATE_SETTER_LAMBDA(notify_all, NOTIFY_ALL);
+    const std::vector<void(*)(T&, unsigned int&, void(*)())> setters {
+        set_wait,
+        set_wait_timed,
+        set_notify_one,
+        set_notify_all
+    };
+
+    // create all combinations
+    return make_ops_combinations(setters, nonnull_value);
+}
+
+
+template <class T>
+std::array<void(*)(), 4>
+make_ops_wait_array(const T& wait_ops) noexcept
+{
+    // lambda helpers
+    CREATE_GETTER_LAMBDA(wait);
+    CREATE_GETTER_LAMBDA(wait_timed);
+    CREATE_GETTER_LAMBDA(notify_one);
+    CREATE_GETTER_LAMBDA(notify_all);
+    const std::array<void(*(*)(const T&))(), 4> getters {
+        get_wait,
+        get_wait_timed,
+        get_notify_one,
+        get_notify_all
+    };
+
+    // create array
+    return make_ops_array(wait_ops, getters);
+}
+
+
+template <class T>
+std::vector<test::ops_any_all_vf<T>>
+make_ops_batch_combinations(void(*nonnull_value)())
+{
+    // lambda helpers
+    CREATE_SETTER_LAMBDA(add_n, ADD_N);
+    CREATE_SETTER_LAMBDA(sub_n, SUB_N);
+    CREATE_SETTER_LAMBDA(or_n, OR_N);
+    CREATE_SETTER_LAMBDA(xor_n, XOR_N);
+    CREATE_SETTER_LAMBDA(and_n, AND_N);
+    CREATE_SETTER_LAMBDA(fetch_add_n, ADD_N);
+    CREATE_SETTER_LAMBDA(fetch_sub_n, SUB_N);
+    CREATE_SETTER_LAMBDA(fetch_or_n, OR_N);
+    CREATE_SETTER_LAMBDA(fetch_xor_n, XOR_N);
+    CREATE_SETTER_LAMBDA(fetch_and_n, AND_N);
+    CREATE_SETTER_LAMBDA(exchange_n, EXCHANGE_N);
+    CREATE_SETTER_LAMBDA(cmpxchg_n, CMPXCHG_N);
+    CREATE_SETTER_LAMBDA(store_array, STORE_ARRAY);
+    CREATE_SETTER_LAMBDA(load_array, LOAD_ARRAY);
+    // exchange_n and cmpxchg_n have no void counterpart
+    const std::vector<void(*)(T&, unsigned int&, void(*)())> setters_void {
+        set_add_n,
+        set_sub_n,
+        set_or_n,
+        set_xor_n,
+        set_and_n,
+        set_store_array
+    };
+    const std::vector<void(*)(T&, unsigned int&, void(*)())> setters_fetch {
+        set_fetch_add_n,
+        set_fetch_sub_n,
+        set_fetch_or_n,
+        set_fetch_xor_n,
+        set_fetch_and_n,
+        set_exchange_n,
+        set_cmpxchg_n,
+        set_load_array
+    };
+
+    // create all combinations
+    return make_ops_combinations(setters_void, setters_fetch, nonnull_value);
+}
+
+
+template <class T>
+std::array<void(*)(), 14>
+make_ops_batch_array(const T& batch_ops) noexcept
+{
+    // lambda helpers
+    CREATE_GETTER_LAMBDA(add_n);
+    CREATE_GETTER_LAMBDA(sub_n);
+    CREATE_GETTER_LAMBDA(or_n);
+    CREATE_GETTER_LAMBDA(xor_n);
+    CREATE_GETTER_LAMBDA(and_n);
+    CREATE_GETTER_LAMBDA(fetch_add_n);
+    CREATE_GETTER_LAMBDA(fetch_sub_n);
+    CREATE_GETTER_LAMBDA(fetch_or_n);
+    CREATE_GETTER_LAMBDA(fetch_xor_n);
+    CREATE_GETTER_LAMBDA(fetch_and_n);
+    CREATE_GETTER_LAMBDA(exchange_n);
+    CREATE_GETTER_LAMBDA(cmpxchg_n);
+    CREATE_GETTER_LAMBDA(store_array);
+    CREATE_GETTER_LAMBDA(load_array);
+    const std::array<void(*(*)(const T&))(), 14> getters {
+        get_add_n,
+        get_sub_n,
+        get_or_n,
+        get_xor_n,
+        get_and_n,
+        get_fetch_add_n,
+        get_fetch_sub_n,
+        get_fetch_or_n,
+        get_fetch_xor_n,
+        get_fetch_and_n,
+        get_exchange_n,
+        get_cmpxchg_n,
+        get_store_array,
+        get_load_array
+    };
+
+    // create array
+    return make_ops_array(batch_ops, getters);
+}
+
+
+template <class T>
+std::vector<test::ops_any_all_vf<T>>
+make_ops_float_combinations(void(*nonnull_value)())
+{
+    // lambda helpers
+    CREATE_SETTER_LAMBDA(add, FADD);
+    CREATE_SETTER_LAMBDA(sub, FSUB);
+    CREATE_SETTER_LAMBDA(fetch_add, FADD);
+    CREATE_SETTER_LAMBDA(fetch_sub, FSUB);
+    const std::vector<void(*)(T&, unsigned int&, void(*)())> setters_void {
+        set_add,
+        set_sub
+    };
+    const std::vector<void(*)(T&, unsigned int&, void(*)())> setters_fetch {
+        set_fetch_add,
+        set_fetch_sub
+    };
+
+    // create all combinations
+    return make_ops_combinations(setters_void, setters_fetch, nonnull_value);
+}
+
+
+template <class T>
+std::array<void(*)(), 4>
+make_ops_float_array(const T& float_ops) noexcept
+{
+    // lambda helpers
+    CREATE_GETTER_LAMBDA(add);
+    CREATE_GETTER_LAMBDA(sub);
+    CREATE_GETTER_LAMBDA(fetch_add);
+    CREATE_GETTER_LAMBDA(fetch_sub);
+    const std::array<void(*(*)(const T&))(), 4> getters {
+        get_add,
+        get_sub,
+        get_fetch_add,
+        get_fetch_sub
+    };
+
+    // create array
+    return make_ops_array(float_ops, getters);
+}
+
+
 }  // namespace
 
 
@@ -559,7 +889,12 @@ make_opcats_all_solo()
         patomic_opcat_ARI_F,
         patomic_opcat_TSPEC,
         patomic_opcat_TFLAG,
-        patomic_opcat_TRAW
+        patomic_opcat_TRAW,
+        patomic_opcat_WAIT,
+        patomic_opcat_BATCH_V,
+        patomic_opcat_BATCH_F,
+        patomic_opcat_FLT_V,
+        patomic_opcat_FLT_F
     };
 }
 
@@ -570,6 +905,8 @@ make_opcats_all_combined()
     return {
         patomic_opcats_BIN,
         patomic_opcats_ARI,
+        patomic_opcats_BATCH,
+        patomic_opcats_FLT,
         patomic_opcats_IMPLICIT,
         patomic_opcats_EXPLICIT,
         patomic_opcats_TRANSACTION
@@ -587,6 +924,7 @@ make_opkinds_all_solo()
         patomic_opkind_EXCHANGE,
         patomic_opkind_CMPXCHG_WEAK,
         patomic_opkind_CMPXCHG_STRONG,
+        patomic_opkind_FETCH_UPDATE,
         patomic_opkind_TEST,
         patomic_opkind_TEST_SET,
         patomic_opkind_TEST_RESET,
@@ -601,16 +939,41 @@ make_opkinds_all_solo()
         patomic_opkind_INC,
         patomic_opkind_DEC,
         patomic_opkind_NEG,
+        patomic_opkind_MIN,
+        patomic_opkind_MAX,
+        patomic_opkind_UMIN,
+        patomic_opkind_UMAX,
+        patomic_opkind_ADD_SAT,
+        patomic_opkind_SUB_SAT,
+        patomic_opkind_UADD_SAT,
+        patomic_opkind_USUB_SAT,
         patomic_opkind_DOUBLE_CMPXCHG,
         patomic_opkind_MULTI_CMPXCHG,
         patomic_opkind_GENERIC,
         patomic_opkind_GENERIC_WFB,
+        patomic_opkind_MULTI_LOAD,
+        patomic_opkind_MULTI_OP,
         patomic_opkind_TBEGIN,
         patomic_opkind_TCOMMIT,
         patomic_opkind_TABORT_ALL,
         patomic_opkind_TABORT_SINGLE,
         patomic_opkind_TTEST,
-        patomic_opkind_TDEPTH
+        patomic_opkind_TDEPTH,
+        patomic_opkind_WAIT,
+        patomic_opkind_WAIT_TIMED,
+        patomic_opkind_NOTIFY_ONE,
+        patomic_opkind_NOTIFY_ALL,
+        patomic_opkind_ADD_N,
+        patomic_opkind_SUB_N,
+        patomic_opkind_OR_N,
+        patomic_opkind_XOR_N,
+        patomic_opkind_AND_N,
+        patomic_opkind_EXCHANGE_N,
+        patomic_opkind_CMPXCHG_N,
+        patomic_opkind_STORE_ARRAY,
+        patomic_opkind_LOAD_ARRAY,
+        patomic_opkind_FADD,
+        patomic_opkind_FSUB
     };
 }
 
@@ -626,7 +989,10 @@ make_opkinds_all_combined()
         patomic_opkinds_ARI,
         patomic_opkinds_TSPEC,
         patomic_opkinds_TFLAG,
-        patomic_opkinds_TRAW
+        patomic_opkinds_TRAW,
+        patomic_opkinds_WAIT,
+        patomic_opkinds_BATCH,
+        patomic_opkinds_FLT
     };
 }
 
@@ -636,7 +1002,42 @@ patomic_ops_t
 make_ops_all_nonnull<ops_domain::IMPLICIT>(void(*nonnull_value)()) noexcept
 {
     using ops_t = patomic_ops_t;
-    return ::make_ops_all_nonnull_except_transaction_specific<ops_t>(nonnull_value);
+    ops_t ops = ::make_ops_all_nonnull_except_transaction_specific<ops_t>(nonnull_value);
+    const test::convertible_to_any<void(*)()> non_null {
+        nonnull_value
+    };
+
+    // initialize all wait, batch, and float members to be non-null
+    // WAIT
+    ops.wait_ops.fp_wait       = non_null;
+    ops.wait_ops.fp_wait_timed = non_null;
+    ops.wait_ops.fp_notify_one = non_null;
+    ops.wait_ops.fp_notify_all = non_null;
+    // BATCH_V
+    ops.batch_ops.fp_add_n = non_null;
+    ops.batch_ops.fp_sub_n = non_null;
+    ops.batch_ops.fp_or_n  = non_null;
+    ops.batch_ops.fp_xor_n = non_null;
+    ops.batch_ops.fp_and_n = non_null;
+    ops.batch_ops.fp_store_array = non_null;
+    // BATCH_F
+    ops.batch_ops.fp_fetch_add_n = non_null;
+    ops.batch_ops.fp_fetch_sub_n = non_null;
+    ops.batch_ops.fp_fetch_or_n  = non_null;
+    ops.batch_ops.fp_fetch_xor_n = non_null;
+    ops.batch_ops.fp_fetch_and_n = non_null;
+    ops.batch_ops.fp_exchange_n  = non_null;
+    ops.batch_ops.fp_cmpxchg_n   = non_null;
+    ops.batch_ops.fp_load_array  = non_null;
+    // FLT_V
+    ops.float_ops.fp_add = non_null;
+    ops.float_ops.fp_sub = non_null;
+    // FLT_F
+    ops.float_ops.fp_fetch_add = non_null;
+    ops.float_ops.fp_fetch_sub = non_null;
+
+    // return fully nonnull ops
+    return ops;
 }
 
 
@@ -645,7 +1046,42 @@ patomic_ops_explicit_t
 make_ops_all_nonnull<ops_domain::EXPLICIT>(void(*nonnull_value)()) noexcept
 {
     using ops_t = patomic_ops_explicit_t;
-    return ::make_ops_all_nonnull_except_transaction_specific<ops_t>(nonnull_value);
+    ops_t ops = ::make_ops_all_nonnull_except_transaction_specific<ops_t>(nonnull_value);
+    const test::convertible_to_any<void(*)()> non_null {
+        nonnull_value
+    };
+
+    // initialize all wait, batch, and float members to be non-null
+    // WAIT
+    ops.wait_ops.fp_wait       = non_null;
+    ops.wait_ops.fp_wait_timed = non_null;
+    ops.wait_ops.fp_notify_one = non_null;
+    ops.wait_ops.fp_notify_all = non_null;
+    // BATCH_V
+    ops.batch_ops.fp_add_n = non_null;
+    ops.batch_ops.fp_sub_n = non_null;
+    ops.batch_ops.fp_or_n  = non_null;
+    ops.batch_ops.fp_xor_n = non_null;
+    ops.batch_ops.fp_and_n = non_null;
+    ops.batch_ops.fp_store_array = non_null;
+    // BATCH_F
+    ops.batch_ops.fp_fetch_add_n = non_null;
+    ops.batch_ops.fp_fetch_sub_n = non_null;
+    ops.batch_ops.fp_fetch_or_n  = non_null;
+    ops.batch_ops.fp_fetch_xor_n = non_null;
+    ops.batch_ops.fp_fetch_and_n = non_null;
+    ops.batch_ops.fp_exchange_n  = non_null;
+    ops.batch_ops.fp_cmpxchg_n   = non_null;
+    ops.batch_ops.fp_load_array  = non_null;
+    // FLT_V
+    ops.float_ops.fp_add = non_null;
+    ops.float_ops.fp_sub = non_null;
+    // FLT_F
+    ops.float_ops.fp_fetch_add = non_null;
+    ops.float_ops.fp_fetch_sub = non_null;
+
+    // return fully nonnull ops
+    return ops;
 }
 
 
@@ -665,6 +1101,8 @@ make_ops_all_nonnull<ops_domain::TRANSACTION>(void(*nonnull_value)()) noexcept
     ops.special_ops.fp_multi_cmpxchg  = non_null;
     ops.special_ops.fp_generic        = non_null;
     ops.special_ops.fp_generic_wfb    = non_null;
+    ops.special_ops.fp_multi_load     = non_null;
+    ops.special_ops.fp_multi_op       = non_null;
     // TFLAG
     ops.flag_ops.fp_test     = non_null;
     ops.flag_ops.fp_test_set = non_null;
@@ -733,11 +1171,15 @@ make_ops_special_combinations_transaction(void(*nonnull_value)())
     CREATE_SETTER_LAMBDA(multi_cmpxchg, MULTI_CMPXCHG);
     CREATE_SETTER_LAMBDA(generic, GENERIC);
     CREATE_SETTER_LAMBDA(generic_wfb, GENERIC_WFB);
+    CREATE_SETTER_LAMBDA(multi_load, MULTI_LOAD);
+    CREATE_SETTER_LAMBDA(multi_op, MULTI_OP);
     const std::vector<void(*)(T&, unsigned int&, void(*)())> setters {
         set_double_cmpxchg,
         set_multi_cmpxchg,
         set_generic,
-        set_generic_wfb
+        set_generic_wfb,
+        set_multi_load,
+        set_multi_op
     };
 
     // create all combinations
@@ -816,7 +1258,7 @@ make_ops_raw_combinations_transaction()
 DEFINE_MAKE_OPS_ARRAY_IET(ldst, _, 2);
 
 
-DEFINE_MAKE_OPS_ARRAY_IET(xchg, _xchg_, 3);
+DEFINE_MAKE_OPS_ARRAY_IET(xchg, _xchg_, 4);
 
 
 DEFINE_MAKE_OPS_ARRAY_IET(bitwise, _bitwise_, 4);
@@ -825,10 +1267,166 @@ DEFINE_MAKE_OPS_ARRAY_IET(bitwise, _bitwise_, 4);
 DEFINE_MAKE_OPS_ARRAY_IET(binary, _binary_, 8);
 
 
-DEFINE_MAKE_OPS_ARRAY_IET(arithmetic, _arithmetic_, 10);
+DEFINE_MAKE_OPS_ARRAY_IET(arithmetic, _arithmetic_, 26);
+
+
+template <>
+std::vector<ops_any_all<patomic_ops_wait_t>>
+make_ops_wait_combinations<ops_domain::IMPLICIT>()
+{
+    using T = patomic_ops_wait_t;
+    return ::make_ops_wait_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all<patomic_ops_wait_t>>
+make_ops_wait_combinations<ops_domain::IMPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_wait_t;
+    return ::make_ops_wait_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::vector<ops_any_all<patomic_ops_explicit_wait_t>>
+make_ops_wait_combinations<ops_domain::EXPLICIT>()
+{
+    using T = patomic_ops_explicit_wait_t;
+    return ::make_ops_wait_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all<patomic_ops_explicit_wait_t>>
+make_ops_wait_combinations<ops_domain::EXPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_explicit_wait_t;
+    return ::make_ops_wait_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::array<void(*)(), 4>
+make_ops_wait_array<ops_domain::IMPLICIT>(const patomic_ops_wait_t& wait) noexcept
+{
+    return ::make_ops_wait_array(wait);
+}
+
+
+template <>
+std::array<void(*)(), 4>
+make_ops_wait_array<ops_domain::EXPLICIT>(const patomic_ops_explicit_wait_t& wait) noexcept
+{
+    return ::make_ops_wait_array(wait);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_batch_t>>
+make_ops_batch_combinations<ops_domain::IMPLICIT>()
+{
+    using T = patomic_ops_batch_t;
+    return ::make_ops_batch_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_batch_t>>
+make_ops_batch_combinations<ops_domain::IMPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_batch_t;
+    return ::make_ops_batch_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_explicit_batch_t>>
+make_ops_batch_combinations<ops_domain::EXPLICIT>()
+{
+    using T = patomic_ops_explicit_batch_t;
+    return ::make_ops_batch_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_explicit_batch_t>>
+make_ops_batch_combinations<ops_domain::EXPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_explicit_batch_t;
+    return ::make_ops_batch_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::array<void(*)(), 14>
+make_ops_batch_array<ops_domain::IMPLICIT>(const patomic_ops_batch_t& batch) noexcept
+{
+    return ::make_ops_batch_array(batch);
+}
+
+
+template <>
+std::array<void(*)(), 14>
+make_ops_batch_array<ops_domain::EXPLICIT>(const patomic_ops_explicit_batch_t& batch) noexcept
+{
+    return ::make_ops_batch_array(batch);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_float_t>>
+make_ops_float_combinations<ops_domain::IMPLICIT>()
+{
+    using T = patomic_ops_float_t;
+    return ::make_ops_float_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_float_t>>
+make_ops_float_combinations<ops_domain::IMPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_float_t;
+    return ::make_ops_float_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_explicit_float_t>>
+make_ops_float_combinations<ops_domain::EXPLICIT>()
+{
+    using T = patomic_ops_explicit_float_t;
+    return ::make_ops_float_combinations<T>(&::only_for_address);
+}
+
+
+template <>
+std::vector<ops_any_all_vf<patomic_ops_explicit_float_t>>
+make_ops_float_combinations<ops_domain::EXPLICIT>(void(*nonnull_value)())
+{
+    using T = patomic_ops_explicit_float_t;
+    return ::make_ops_float_combinations<T>(nonnull_value);
+}
+
+
+template <>
+std::array<void(*)(), 4>
+make_ops_float_array<ops_domain::IMPLICIT>(const patomic_ops_float_t& float_ops) noexcept
+{
+    return ::make_ops_float_array(float_ops);
+}
 
 
+template <>
 std::array<void(*)(), 4>
+make_ops_float_array<ops_domain::EXPLICIT>(const patomic_ops_explicit_float_t& float_ops) noexcept
+{
+    return ::make_ops_float_array(float_ops);
+}
+
+
+std::array<void(*)(), 6>
 make_ops_special_array_transaction(
     const patomic_ops_transaction_special_t& special) noexcept
 {
@@ -838,11 +1436,15 @@ make_ops_special_array_transaction(
     CREATE_GETTER_LAMBDA(multi_cmpxchg);
     CREATE_GETTER_LAMBDA(generic);
     CREATE_GETTER_LAMBDA(generic_wfb);
-    const std::array<void(*(*)(const T&))(), 4> getters {
+    CREATE_GETTER_LAMBDA(multi_load);
+    CREATE_GETTER_LAMBDA(multi_op);
+    const std::array<void(*(*)(const T&))(), 6> getters {
         get_double_cmpxchg,
         get_multi_cmpxchg,
         get_generic,
-        get_generic_wfb
+        get_generic_wfb,
+        get_multi_load,
+        get_multi_op
     };
 
     // create array
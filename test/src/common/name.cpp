@@ -34,6 +34,12 @@ name_options(unsigned int options)
     {
         case patomic_option_NONE:
             return "NONE";
+        case patomic_option_PROFILE:
+            return "PROFILE";
+        case patomic_option_TRANSACTION_LOCK:
+            return "TRANSACTION_LOCK";
+        case patomic_option_PROCESS_SHARED:
+            return "PROCESS_SHARED";
         default:
             return "(unknown)";
     }
@@ -37,8 +37,11 @@ std::vector<unsigned int>
 supported_options()
 {
     // get options to combine
-    const std::array<patomic_option_t, 1> single_bit_options {
-         patomic_option_NONE
+    const std::array<patomic_option_t, 4> single_bit_options {
+         patomic_option_NONE,
+         patomic_option_PROFILE,
+         patomic_option_TRANSACTION_LOCK,
+         patomic_option_PROCESS_SHARED
     };
 
     // create cartesian product of options
@@ -123,6 +123,20 @@ DEFN_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_generic_wfb_t)
     fp(noop, ptr, noop, ptr, config, result);
 }
 
+DEFN_OVERLOAD_CALL_PATOMIC_OP(patomic_opsig_transaction_multi_load_t)
+{
+    const patomic_transaction_load_t ld { ptr, ptr };
+    fp(&ld, 1u, config, result);
+}
+
+DEFN_OVERLOAD_CALL_PATOMIC_OP_WFB(patomic_opsig_transaction_multi_op_t)
+{
+    const patomic_transaction_op_t op {
+        patomic_transaction_op_CMPXCHG, ptr, ptr, ptr
+    };
+    fp(&op, 1u, config, result);
+}
+
 
 }  // namespace _detail
 }   // namespace test
\ No newline at end of file